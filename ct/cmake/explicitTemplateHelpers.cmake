@@ -95,6 +95,11 @@ function(ct_configureFiles ConfigDir STATE_DIM_PRESPEC, CONTROL_DIM_PRESPEC, SCA
         if((SCALAR_PRESPEC MATCHES "double") OR (SCALAR_PRESPEC MATCHES "float")) #STREQUAL did not work
             set(DOUBLE_OR_FLOAT true)
         endif()
+        # for classes which are implemented in double precision only
+        set(DOUBLE_ONLY false)
+        if(SCALAR_PRESPEC MATCHES "double")
+            set(DOUBLE_ONLY true)
+        endif()
         configure_file(${file} ${outputFile})
         list(APPEND CURRENT_SRCS ${outputFile})
     endforeach()
@@ -0,0 +1,136 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Benchmarks of the Integrator, the IntegratorSymplectic and the SystemDiscretizer on chains of 1, 6 and 18
+ * pendulums (state dimensions 2, 12 and 36).
+ */
+
+#include <ct/core/core.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+#include "PendulumChain.h"
+
+using namespace ct::core;
+
+const double dt = 0.001;
+const size_t nSteps = 100;
+
+template <size_t N>
+std::shared_ptr<PendulumChain<N>> createSystem()
+{
+    std::shared_ptr<ConstantController<2 * N, N>> controller(new ConstantController<2 * N, N>());
+    controller->setControl(ControlVector<N>::Random());
+    return std::shared_ptr<PendulumChain<N>>(new PendulumChain<N>(controller));
+}
+
+//! integrates nSteps fixed steps, the integration type is the benchmark argument
+template <size_t N>
+void Integrator_n_steps(benchmark::State& state)
+{
+    const IntegrationType type = static_cast<IntegrationType>(state.range(0));
+    Integrator<2 * N> integrator(createSystem<N>(), type);
+
+    const StateVector<2 * N> x0 = StateVector<2 * N>::Random();
+    StateVector<2 * N> x;
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        x = x0;
+        integrator.integrate_n_steps(x, 0.0, nSteps, dt);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * nSteps);
+}
+
+//! integrates the same interval with an adaptive step size
+template <size_t N>
+void Integrator_adaptive(benchmark::State& state)
+{
+    const IntegrationType type = static_cast<IntegrationType>(state.range(0));
+    Integrator<2 * N> integrator(createSystem<N>(), type);
+
+    const StateVector<2 * N> x0 = StateVector<2 * N>::Random();
+    StateVector<2 * N> x;
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        x = x0;
+        integrator.integrate_adaptive(x, 0.0, nSteps * dt, dt);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+
+template <size_t N>
+void IntegratorSymplectic_n_steps(benchmark::State& state)
+{
+    const bool rk = state.range(0) == RK_SYM;
+    std::shared_ptr<PendulumChain<N>> system = createSystem<N>();
+    IntegratorSymplecticEuler<N, N, N> euler(system);
+    IntegratorSymplecticRk<N, N, N> rk4(system);
+
+    const StateVector<2 * N> x0 = StateVector<2 * N>::Random();
+    StateVector<2 * N> x;
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        x = x0;
+        if (rk)
+            rk4.integrate_n_steps(x, 0.0, nSteps, dt);
+        else
+            euler.integrate_n_steps(x, 0.0, nSteps, dt);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * nSteps);
+}
+
+//! one discrete-time step with nSteps sub-integration steps, as in the forward rollout of the NLOC solvers
+template <size_t N>
+void SystemDiscretizer_propagate(benchmark::State& state)
+{
+    const IntegrationType type = static_cast<IntegrationType>(state.range(0));
+    SystemDiscretizer<2 * N, N, N, N> discretizer(createSystem<N>(), nSteps * dt, type, nSteps);
+    discretizer.initialize();
+
+    const StateVector<2 * N> x0 = StateVector<2 * N>::Random();
+    const ControlVector<N> u = ControlVector<N>::Random();
+    StateVector<2 * N> x;
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        discretizer.propagateControlledDynamics(x0, 0, u, x);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+
+//! the integration types benchmarked, with the ct statistics
+void fixedStepTypes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("type")->Arg(EULERCT)->Arg(RK4CT)->Arg(EULER)->Arg(RK4)->Apply(benchmarkStatistics);
+}
+void adaptiveTypes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("type")->Arg(ODE45)->Arg(RK78)->Apply(benchmarkStatistics);
+}
+void symplecticTypes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("type")->Arg(EULER_SYM)->Arg(RK_SYM)->Apply(benchmarkStatistics);
+}
+void discretizerTypes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("type")->Arg(RK4CT)->Arg(EULER_SYM)->Arg(RK_SYM)->Apply(benchmarkStatistics);
+}
+
+#define CT_BENCHMARK_INTEGRATORS(N)                                            \
+    BENCHMARK_TEMPLATE(Integrator_n_steps, N)->Apply(fixedStepTypes);           \
+    BENCHMARK_TEMPLATE(Integrator_adaptive, N)->Apply(adaptiveTypes);           \
+    BENCHMARK_TEMPLATE(IntegratorSymplectic_n_steps, N)->Apply(symplecticTypes); \
+    BENCHMARK_TEMPLATE(SystemDiscretizer_propagate, N)->Apply(discretizerTypes)
+
+CT_BENCHMARK_INTEGRATORS(1);
+CT_BENCHMARK_INTEGRATORS(6);
+CT_BENCHMARK_INTEGRATORS(18);
+
+CT_BENCHMARK_MAIN()
@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Benchmarks of the linearizers on chains of 1, 6 and 18 pendulums: numerical differentiation, auto-differentiation
+ * (if CppAD is available) and just-in-time compiled auto-differentiation code (if CppADCodeGen is available).
+ * The just-in-time compilation itself is not part of the measurement.
+ */
+
+#include <ct/core/core.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+#include "PendulumChain.h"
+
+using namespace ct::core;
+
+//! evaluates both Jacobians of the linearizer at a random state and control
+template <size_t N, typename LINEARIZER>
+void evaluateJacobians(benchmark::State& state, LINEARIZER& linearizer)
+{
+    const StateVector<2 * N> x = StateVector<2 * N>::Random();
+    const ControlVector<N> u = ControlVector<N>::Random();
+
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(linearizer.getDerivativeState(x, u, 0.0).data());
+        benchmark::DoNotOptimize(linearizer.getDerivativeControl(x, u, 0.0).data());
+    }
+}
+
+//! numerical differentiation, single or double sided as given by the benchmark argument
+template <size_t N>
+void SystemLinearizer_numDiff(benchmark::State& state)
+{
+    SystemLinearizer<2 * N, N> linearizer(std::shared_ptr<PendulumChain<N>>(new PendulumChain<N>()), state.range(0));
+    evaluateJacobians<N>(state, linearizer);
+}
+
+#ifdef CPPAD
+template <size_t N>
+void AutoDiffLinearizer_evaluate(benchmark::State& state)
+{
+    typedef tpl::PendulumChain<N, ADScalar> PendulumChainAD;
+    AutoDiffLinearizer<2 * N, N> linearizer(std::shared_ptr<PendulumChainAD>(new PendulumChainAD()));
+    evaluateJacobians<N>(state, linearizer);
+}
+#endif
+
+#ifdef CPPADCG
+template <size_t N>
+void ADCodegenLinearizer_JIT(benchmark::State& state)
+{
+    typedef typename ADCodegenLinearizer<2 * N, N>::ADCGScalar Scalar;
+    typedef tpl::PendulumChain<N, Scalar> PendulumChainADCG;
+    ADCodegenLinearizer<2 * N, N> linearizer(std::shared_ptr<PendulumChainADCG>(new PendulumChainADCG()));
+    linearizer.compileJIT("PendulumChainLinearizer" + std::to_string(N));
+    evaluateJacobians<N>(state, linearizer);
+}
+#endif
+
+void numDiffTypes(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("doubleSided")->Arg(0)->Arg(1)->Apply(benchmarkStatistics);
+}
+
+#define CT_BENCHMARK_NUMDIFF(N) BENCHMARK_TEMPLATE(SystemLinearizer_numDiff, N)->Apply(numDiffTypes)
+CT_BENCHMARK_NUMDIFF(1);
+CT_BENCHMARK_NUMDIFF(6);
+CT_BENCHMARK_NUMDIFF(18);
+
+#ifdef CPPAD
+#define CT_BENCHMARK_AD(N) BENCHMARK_TEMPLATE(AutoDiffLinearizer_evaluate, N)->Apply(benchmarkStatistics)
+CT_BENCHMARK_AD(1);
+CT_BENCHMARK_AD(6);
+CT_BENCHMARK_AD(18);
+#endif
+
+#ifdef CPPADCG
+#define CT_BENCHMARK_JIT(N) BENCHMARK_TEMPLATE(ADCodegenLinearizer_JIT, N)->Apply(benchmarkStatistics)
+CT_BENCHMARK_JIT(1);
+CT_BENCHMARK_JIT(6);
+CT_BENCHMARK_JIT(18);
+#endif
+
+CT_BENCHMARK_MAIN()
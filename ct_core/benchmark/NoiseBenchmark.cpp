@@ -0,0 +1,71 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Benchmarks of generating Gaussian noise for trajectories of 12-dimensional states, scalar by scalar with
+ * GaussianNoise::gen(), in bulk with GaussianNoise::fill() and with the covariance-shaped MultivariateGaussianNoise.
+ * The trajectory length is the benchmark argument.
+ */
+
+#include <ct/core/core.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+using namespace ct::core;
+
+const size_t dim = 12;
+
+void GaussianNoise_scalar(benchmark::State& state)
+{
+    StateVectorArray<dim> x(state.range(0), StateVector<dim>::Zero());
+    GaussianNoise noise(0.0, 1.0, 1234);
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < x.size(); i++)
+            x[i] = noise.gen<dim>();
+        benchmark::DoNotOptimize(x.front().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * dim);
+}
+
+void GaussianNoise_bulk(benchmark::State& state)
+{
+    StateVectorArray<dim> x(state.range(0), StateVector<dim>::Zero());
+    GaussianNoise noise(0.0, 1.0, 1234);
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        noise.fill(x);
+        benchmark::DoNotOptimize(x.front().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * dim);
+}
+
+void MultivariateGaussianNoise_bulk(benchmark::State& state)
+{
+    StateVectorArray<dim> x(state.range(0), StateVector<dim>::Zero());
+    Eigen::Matrix<double, dim, dim> A = Eigen::Matrix<double, dim, dim>::Random();
+    MultivariateGaussianNoise<dim> noise(Eigen::Matrix<double, dim, 1>::Zero(),
+        A * A.transpose() + Eigen::Matrix<double, dim, dim>::Identity(), 1234);
+    AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        noise.fill(x);
+        benchmark::DoNotOptimize(x.front().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * dim);
+}
+
+//! the trajectory lengths benchmarked, with the ct statistics
+void lengths(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("N")->Arg(10)->Arg(1000)->Apply(benchmarkStatistics);
+}
+
+BENCHMARK(GaussianNoise_scalar)->Apply(lengths);
+BENCHMARK(GaussianNoise_bulk)->Apply(lengths);
+BENCHMARK(MultivariateGaussianNoise_bulk)->Apply(lengths);
+
+CT_BENCHMARK_MAIN()
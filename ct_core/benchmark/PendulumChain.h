@@ -0,0 +1,63 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace core {
+namespace tpl {
+
+//! a chain of N actuated pendulums coupled by torsional springs, a scalable nonlinear system for benchmarking
+/*!
+ * The state consists of the N angles followed by the N angular velocities, every pendulum is actuated.
+ */
+template <size_t N, typename SCALAR = double>
+class PendulumChain : public SymplecticSystem<N, N, N, SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t STATE_DIM = 2 * N;
+    static const size_t CONTROL_DIM = N;
+
+    PendulumChain(std::shared_ptr<Controller<2 * N, N, SCALAR>> controller = nullptr)
+        : SymplecticSystem<N, N, N, SCALAR>(controller)
+    {
+    }
+
+    PendulumChain(const PendulumChain& arg) : SymplecticSystem<N, N, N, SCALAR>(arg) {}
+    PendulumChain* clone() const override { return new PendulumChain(*this); }
+    void computePdot(const StateVector<2 * N, SCALAR>& x,
+        const StateVector<N, SCALAR>& v,
+        const ControlVector<N, SCALAR>& control,
+        StateVector<N, SCALAR>& pDot) override
+    {
+        pDot = v;
+    }
+
+    void computeVdot(const StateVector<2 * N, SCALAR>& x,
+        const StateVector<N, SCALAR>& p,
+        const ControlVector<N, SCALAR>& control,
+        StateVector<N, SCALAR>& vDot) override
+    {
+        using std::sin;
+        for (size_t i = 0; i < N; i++)
+        {
+            vDot(i) = -SCALAR(9.81) * sin(p(i)) - SCALAR(0.1) * x(N + i) + control(i);
+            if (i > 0)
+                vDot(i) -= SCALAR(2.0) * sin(p(i) - p(i - 1));
+            if (i + 1 < N)
+                vDot(i) -= SCALAR(2.0) * sin(p(i) - p(i + 1));
+        }
+    }
+};
+
+}  // namespace tpl
+
+template <size_t N>
+using PendulumChain = tpl::PendulumChain<N, double>;
+
+}  // namespace core
+}  // namespace ct
@@ -0,0 +1,224 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+/*!
+ * Common main function of the ct microbenchmarks, based on Google Benchmark.
+ *
+ * Include this header in exactly one translation unit of a benchmark executable and call CT_BENCHMARK_MAIN() there.
+ * Benchmarks registered with ->Apply(ct::core::benchmarkStatistics) report median, min, max, 90th and 99th percentile
+ * over the repetitions. Unless specified on the command line, every benchmark is repeated 10 times and only the
+ * aggregates are reported. Machine-readable results are written with
+ *
+ *     ./bench_Integrators --benchmark_out=integrators.json --benchmark_out_format=json
+ *
+ * On glibc, heap allocations (including those of Eigen, which bypass operator new) are counted within an
+ * AllocationCounter::Scope, placed right before the benchmark loop, and reported as the counters allocs_per_iter,
+ * bytes_per_iter and peak_bytes (the peak heap growth).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+#endif
+
+namespace ct {
+namespace core {
+
+//! counts heap allocations while active
+class AllocationCounter
+{
+public:
+    //! records the allocations during the lifetime of the scope as counters of a benchmark
+    class Scope
+    {
+    public:
+        explicit Scope(::benchmark::State& state) : state_(state) { AllocationCounter::instance().start(); }
+        ~Scope()
+        {
+            AllocationCounter& counter = AllocationCounter::instance();
+            counter.stop();
+#ifdef __GLIBC__
+            state_.counters["allocs_per_iter"] =
+                ::benchmark::Counter(counter.allocations(), ::benchmark::Counter::kAvgIterations);
+            state_.counters["bytes_per_iter"] =
+                ::benchmark::Counter(counter.bytes(), ::benchmark::Counter::kAvgIterations);
+            state_.counters["peak_bytes"] = ::benchmark::Counter(counter.peakBytes());
+#endif
+        }
+
+    private:
+        ::benchmark::State& state_;
+    };
+
+    static AllocationCounter& instance()
+    {
+        static AllocationCounter counter;
+        return counter;
+    }
+
+    void start()
+    {
+        allocations_.store(0, std::memory_order_relaxed);
+        bytes_.store(0, std::memory_order_relaxed);
+        liveBytes_.store(0, std::memory_order_relaxed);
+        peakBytes_.store(0, std::memory_order_relaxed);
+        active_.store(true, std::memory_order_release);
+    }
+
+    void stop() { active_.store(false, std::memory_order_release); }
+    //! number of allocations since start()
+    double allocations() const { return allocations_.load(std::memory_order_relaxed); }
+    //! allocated bytes since start()
+    double bytes() const { return bytes_.load(std::memory_order_relaxed); }
+    //! the peak heap growth since start()
+    double peakBytes() const { return peakBytes_.load(std::memory_order_relaxed); }
+    //! record an allocation of usable size bytes
+    void allocated(size_t bytes)
+    {
+        if (!active_.load(std::memory_order_relaxed))
+            return;
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        const int64_t live = liveBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        int64_t peak = peakBytes_.load(std::memory_order_relaxed);
+        while (live > peak && !peakBytes_.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    //! record a deallocation of usable size bytes
+    void freed(size_t bytes)
+    {
+        if (active_.load(std::memory_order_relaxed))
+            liveBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    AllocationCounter() : active_(false), allocations_(0), bytes_(0), liveBytes_(0), peakBytes_(0) {}
+    std::atomic<bool> active_;
+    std::atomic<int64_t> allocations_;
+    std::atomic<int64_t> bytes_;
+    std::atomic<int64_t> liveBytes_;
+    std::atomic<int64_t> peakBytes_;
+};
+
+
+//! percentile of the repetitions, with nearest rank
+template <int PERCENT>
+double percentile(const std::vector<double>& v)
+{
+    if (v.empty())
+        return 0.0;
+    std::vector<double> sorted(v);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[(sorted.size() - 1) * PERCENT / 100];
+}
+
+//! adds the statistics reported by all ct benchmarks, use as BENCHMARK(...)->Apply(benchmarkStatistics)
+inline void benchmarkStatistics(::benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ComputeStatistics("min", percentile<0>)
+        ->ComputeStatistics("p90", percentile<90>)
+        ->ComputeStatistics("p99", percentile<99>)
+        ->ComputeStatistics("max", percentile<100>);
+}
+
+//! runs all registered benchmarks, with ct defaults for the repetitions
+inline int runBenchmarks(int argc, char** argv)
+{
+    // defaults come first, such that they can be overridden on the command line
+    std::vector<char*> args(argv, argv + argc);
+    std::string repetitions = "--benchmark_repetitions=10";
+    std::string aggregates = "--benchmark_report_aggregates_only=true";
+    args.insert(args.begin() + 1, &aggregates[0]);
+    args.insert(args.begin() + 1, &repetitions[0]);
+    int nArgs = static_cast<int>(args.size());
+
+    ::benchmark::Initialize(&nArgs, args.data());
+    if (::benchmark::ReportUnrecognizedArguments(nArgs, args.data()))
+        return 1;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
+
+}  // namespace core
+}  // namespace ct
+
+
+#ifdef __GLIBC__
+//! replaces the glibc allocation functions by counting ones
+#define CT_BENCHMARK_ALLOCATION_HOOKS                                                                   \
+    extern "C" {                                                                                        \
+    void* malloc(size_t size)                                                                           \
+    {                                                                                                   \
+        void* ptr = __libc_malloc(size);                                                                \
+        if (ptr)                                                                                        \
+            ct::core::AllocationCounter::instance().allocated(malloc_usable_size(ptr));                 \
+        return ptr;                                                                                     \
+    }                                                                                                   \
+    void* calloc(size_t n, size_t size)                                                                 \
+    {                                                                                                   \
+        void* ptr = __libc_calloc(n, size);                                                             \
+        if (ptr)                                                                                        \
+            ct::core::AllocationCounter::instance().allocated(malloc_usable_size(ptr));                 \
+        return ptr;                                                                                     \
+    }                                                                                                   \
+    void* realloc(void* old, size_t size)                                                               \
+    {                                                                                                   \
+        if (old)                                                                                        \
+            ct::core::AllocationCounter::instance().freed(malloc_usable_size(old));                     \
+        void* ptr = __libc_realloc(old, size);                                                          \
+        if (ptr)                                                                                        \
+            ct::core::AllocationCounter::instance().allocated(malloc_usable_size(ptr));                 \
+        return ptr;                                                                                     \
+    }                                                                                                   \
+    void* memalign(size_t alignment, size_t size)                                                       \
+    {                                                                                                   \
+        void* ptr = __libc_memalign(alignment, size);                                                   \
+        if (ptr)                                                                                        \
+            ct::core::AllocationCounter::instance().allocated(malloc_usable_size(ptr));                 \
+        return ptr;                                                                                     \
+    }                                                                                                   \
+    void* aligned_alloc(size_t alignment, size_t size) { return memalign(alignment, size); }            \
+    int posix_memalign(void** ptr, size_t alignment, size_t size)                                       \
+    {                                                                                                   \
+        *ptr = memalign(alignment, size);                                                               \
+        return *ptr ? 0 : ENOMEM;                                                                       \
+    }                                                                                                   \
+    void free(void* ptr)                                                                                \
+    {                                                                                                   \
+        if (ptr)                                                                                        \
+            ct::core::AllocationCounter::instance().freed(malloc_usable_size(ptr));                     \
+        __libc_free(ptr);                                                                               \
+    }                                                                                                   \
+    }
+#else
+#define CT_BENCHMARK_ALLOCATION_HOOKS
+#endif
+
+//! defines main() of a benchmark executable, use in exactly one translation unit
+#define CT_BENCHMARK_MAIN()                                                \
+    CT_BENCHMARK_ALLOCATION_HOOKS                                          \
+    int main(int argc, char** argv) { return ct::core::runBenchmarks(argc, argv); }
@@ -0,0 +1,66 @@
+/*!
+ * Converts a binary solver trace to NumPy or CSV files, one file per record named <name>_<iteration>.
+ *
+ * usage: ex_TraceConvert <trace file> [list | npy <output dir> | csv <output dir>]
+ *
+ * \example TraceConvert.cpp
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include <ct/core/core.h>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " <trace file> [list | npy <output dir> | csv <output dir>]" << std::endl;
+        return 1;
+    }
+
+    const std::string mode = argc > 2 ? argv[2] : "list";
+    if (mode != "list" && argc < 4)
+    {
+        std::cout << "missing output directory" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        ct::core::TraceReader reader(argv[1]);
+        ct::core::TraceRecord record;
+        while (reader.next(record))
+        {
+            if (mode == "list")
+            {
+                std::cout << record.iteration << "\t" << record.name << "\t" << record.count << " x " << record.rows
+                          << " x " << record.cols << std::endl;
+                continue;
+            }
+
+            const std::string baseName =
+                std::string(argv[3]) + "/" + record.name + "_" + std::to_string(record.iteration);
+            if (mode == "npy")
+            {
+                ct::core::TraceReader::writeNpy(baseName + ".npy", record);
+            }
+            else if (mode == "csv")
+            {
+                std::ofstream out(baseName + ".csv");
+                ct::core::TraceReader::writeCsv(out, record);
+            }
+            else
+            {
+                std::cout << "unknown mode " << mode << std::endl;
+                return 1;
+            }
+        }
+    } catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
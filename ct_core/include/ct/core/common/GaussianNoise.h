@@ -6,16 +6,63 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #pragma once
 
 #include <time.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <random>
 
+#include "Philox.h"
+
 namespace ct {
 namespace core {
 
+namespace internal {
+//! layer boundaries of the 128 layer ziggurat of the standard normal distribution, see GaussianNoise::ziggurat()
+struct ZigguratTables
+{
+    static const size_t LAYERS = 128;
+
+    static const ZigguratTables& instance()
+    {
+        static const ZigguratTables tables;
+        return tables;
+    }
+
+    double x[LAYERS + 1];  //! right edges of the layers, x[0] is the edge of the base layer including the tail
+    double ratio[LAYERS];  //! x[i + 1] / x[i], points below this fraction of layer i are accepted directly
+
+private:
+    ZigguratTables()
+    {
+        // right edge of the base layer and common area of all layers
+        const double r = 3.442619855899;
+        const double area = 9.91256303526217e-3;
+
+        double f = std::exp(-0.5 * r * r);
+        x[0] = area / f;
+        x[1] = r;
+        x[LAYERS] = 0.0;
+        for (size_t i = 2; i < LAYERS; i++)
+        {
+            x[i] = std::sqrt(-2.0 * std::log(area / x[i - 1] + f));
+            f = std::exp(-0.5 * x[i] * x[i]);
+        }
+        for (size_t i = 0; i < LAYERS; i++)
+            ratio[i] = x[i + 1] / x[i];
+    }
+};
+}  // namespace internal
+
 //! Gaussian noise generator
 /*!
  * This class generates random Gaussian noise given a mean and a distribution. It can
  * either create a single (pseudo) random variable or an entire vector.
  *
+ * The bulk functions fill() and noisify() of matrices and arrays draw from a separate counter-based Philox4x32
+ * engine and use the ziggurat method, which is considerably faster than drawing scalar by scalar. The
+ * bulk engine is seeded with the same seed as the scalar one and additionally takes a stream id, such that
+ * generators with the same seed and different streams (e.g. one per thread) are independent and reproducible.
+ *
  * Unit test \ref NoiseTest.cpp illustrates the use of GaussianNoise
  */
 
@@ -28,8 +75,40 @@ public:
 	 * @param standardDeviation the standard deviation of the distribution
 	 */
     GaussianNoise(double mean = 0.0, double standardDeviation = 1.0)
-        : rd_(), eng_(rd_()), distr_(mean, standardDeviation)
+        : rd_(), eng_(rd_()), distr_(mean, standardDeviation), bulkEng_((uint64_t(rd_()) << 32) | rd_())
+    {
+    }
+
+    //! Seeded constructor
+    /*!
+	 * Creates a reproducible sequence of random variables, e.g. for Monte-Carlo simulations
+	 * @param mean the mean of the Gaussian distribution
+	 * @param standardDeviation the standard deviation of the distribution
+	 * @param seed seed of the random engine
+	 */
+    GaussianNoise(double mean, double standardDeviation, unsigned int seed)
+        : rd_(), eng_(seed), distr_(mean, standardDeviation), bulkEng_(seed)
+    {
+    }
+
+    //! Seeded constructor with a stream id
+    /*!
+	 * @param mean the mean of the Gaussian distribution
+	 * @param standardDeviation the standard deviation of the distribution
+	 * @param seed seed of the random engines
+	 * @param stream stream of the bulk engine, bulk noise of different streams is independent
+	 */
+    GaussianNoise(double mean, double standardDeviation, unsigned int seed, uint64_t stream)
+        : rd_(), eng_(seed), distr_(mean, standardDeviation), bulkEng_(seed, stream)
+    {
+    }
+
+    //! re-seed the random engines
+    void seed(unsigned int seed, uint64_t stream = 0)
     {
+        eng_.seed(seed);
+        distr_.reset();
+        bulkEng_.seed(seed, stream);
     }
 
     //! Scalar generator
@@ -69,11 +148,119 @@ public:
         value += this->gen<size>();
     }
 
+    //! Bulk generator, fills n doubles with random variables
+    void fill(double* data, size_t n)
+    {
+        const double mean = distr_.mean();
+        const double stdDev = distr_.stddev();
+
+        // every variable consumes two 32 bit numbers, unless it gets rejected (about 1.2% of the cases)
+        const size_t chunk = 128;
+        uint32_t bits[2 * chunk];
+        while (n > 0)
+        {
+            const size_t m = std::min(n, chunk);
+            bulkEng_.fill(bits, 2 * m);
+            for (size_t i = 0; i < m; i++)
+                data[i] = mean + stdDev * ziggurat(bits[2 * i], bits[2 * i + 1]);
+            data += m;
+            n -= m;
+        }
+    }
+
+    //! Bulk generator, fills all entries of a (fixed or dynamic size) matrix with random variables
+    template <typename Derived>
+    void fill(Eigen::PlainObjectBase<Derived>& value)
+    {
+        fill(value.data(), value.size());
+    }
+
+    //! Bulk generator, fills all entries of all matrices in an array, e.g. a StateVectorArray
+    template <typename T, typename ALLOC, template <typename, typename> class ARRAY>
+    void fill(ARRAY<T, ALLOC>& array)
+    {
+        for (size_t i = 0; i < array.size(); i++)
+            fill(array[i]);
+    }
+
+    //! adds Gaussian noise to all entries of a matrix, using the bulk generator (unlike noisify())
+    template <typename Derived>
+    void noisifyBulk(Eigen::PlainObjectBase<Derived>& value)
+    {
+        Derived noise;
+        noise.resizeLike(value);
+        fill(noise);
+        value += noise;
+    }
+
+    //! adds Gaussian noise to all entries of all matrices in an array, e.g. process noise on a StateVectorArray
+    template <typename T, typename ALLOC, template <typename, typename> class ARRAY>
+    void noisify(ARRAY<T, ALLOC>& array)
+    {
+        for (size_t i = 0; i < array.size(); i++)
+            noisifyBulk(array[i]);
+    }
+
 
 private:
+    //! uniform random variable in [0, 1) with 53 bit resolution
+    static double uniform(uint32_t w0, uint32_t w1)
+    {
+        return double(((uint64_t(w1) << 32) | w0) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    //! next uniform random variable in [0, 1) from the bulk engine
+    double nextUniform()
+    {
+        const uint32_t w0 = bulkEng_();
+        const uint32_t w1 = bulkEng_();
+        return uniform(w0, w1);
+    }
+
+    //! standard normal variable from two 32 bit random numbers with the ziggurat method (Doornik, 2005)
+    /*!
+     * In the common case, the random numbers select a layer of the ziggurat and a point within it, which is accepted
+     * without evaluating any transcendental function. Rejected points draw further numbers from the bulk engine.
+     */
+    double ziggurat(uint32_t w0, uint32_t w1)
+    {
+        const internal::ZigguratTables& zig = internal::ZigguratTables::instance();
+        while (true)
+        {
+            // the layer is taken from the low bits of w0, which are not part of the uniform variable
+            const double u = 2.0 * uniform(w0, w1) - 1.0;
+            const size_t layer = w0 & (internal::ZigguratTables::LAYERS - 1);
+            if (std::fabs(u) < zig.ratio[layer])
+                return u * zig.x[layer];
+
+            if (layer == 0)
+            {
+                // the tail beyond x[1], sampled with Marsaglia's method
+                double xTail, yTail;
+                do
+                {
+                    xTail = std::log(1.0 - nextUniform()) / zig.x[1];
+                    yTail = std::log(1.0 - nextUniform());
+                } while (-2.0 * yTail < xTail * xTail);
+                return u < 0 ? xTail - zig.x[1] : zig.x[1] - xTail;
+            }
+
+            // the wedge between the layer and the density
+            const double x = u * zig.x[layer];
+            const double f0 = std::exp(-0.5 * (zig.x[layer] * zig.x[layer] - x * x));
+            const double f1 = std::exp(-0.5 * (zig.x[layer + 1] * zig.x[layer + 1] - x * x));
+            if (f1 + nextUniform() * (f0 - f1) < 1.0)
+                return x;
+
+            w0 = bulkEng_();
+            w1 = bulkEng_();
+        }
+    }
+
     std::random_device rd_;
     std::mt19937 eng_;
     std::normal_distribution<> distr_;
+    Philox4x32 bulkEng_;
 };
 
 
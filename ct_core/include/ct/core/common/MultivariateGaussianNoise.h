@@ -0,0 +1,120 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <stdexcept>
+
+#include <Eigen/Cholesky>
+
+#include "GaussianNoise.h"
+
+namespace ct {
+namespace core {
+
+//! Multivariate Gaussian noise generator with a full covariance matrix
+/*!
+ * Samples are generated as mean + L * w, where w is white noise from the bulk generator of GaussianNoise and L is the
+ * Cholesky factor of the covariance, which is computed once when the covariance is set. Arrays of samples are
+ * shaped with a single triangular matrix product over all samples.
+ *
+ * Unit test \ref NoiseTest.cpp illustrates the use of MultivariateGaussianNoise
+ */
+template <size_t DIM>
+class MultivariateGaussianNoise
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef Eigen::Matrix<double, DIM, 1> vector_t;
+    typedef Eigen::Matrix<double, DIM, DIM> matrix_t;
+
+    //! constructor
+    /*!
+     * @param mean the mean of the distribution
+     * @param covariance the covariance of the distribution, must be positive definite
+     */
+    MultivariateGaussianNoise(const vector_t& mean, const matrix_t& covariance) : mean_(mean), white_(0.0, 1.0)
+    {
+        setCovariance(covariance);
+    }
+
+    //! seeded constructor
+    /*!
+     * @param mean the mean of the distribution
+     * @param covariance the covariance of the distribution, must be positive definite
+     * @param seed seed of the random engine
+     * @param stream stream of the random engine, noise of different streams is independent
+     */
+    MultivariateGaussianNoise(const vector_t& mean,
+        const matrix_t& covariance,
+        unsigned int seed,
+        uint64_t stream = 0)
+        : mean_(mean), white_(0.0, 1.0, seed, stream)
+    {
+        setCovariance(covariance);
+    }
+
+    //! re-seed the random engine
+    void seed(unsigned int seed, uint64_t stream = 0) { white_.seed(seed, stream); }
+    //! set the mean
+    void setMean(const vector_t& mean) { mean_ = mean; }
+    //! set the covariance and update its Cholesky factor
+    void setCovariance(const matrix_t& covariance)
+    {
+        Eigen::LLT<matrix_t> llt(covariance);
+        if (llt.info() != Eigen::Success)
+            throw std::runtime_error("MultivariateGaussianNoise: covariance is not positive definite.");
+        L_ = llt.matrixL();
+    }
+
+    //! the lower triangular Cholesky factor of the covariance
+    const matrix_t& getCholeskyFactor() const { return L_; }
+    //! a single sample
+    vector_t gen()
+    {
+        vector_t w;
+        white_.fill(w);
+        return mean_ + L_.template triangularView<Eigen::Lower>() * w;
+    }
+
+    //! fills every entry of an array with a sample, e.g. a StateVectorArray
+    template <typename T, typename ALLOC, template <typename, typename> class ARRAY>
+    void fill(ARRAY<T, ALLOC>& array)
+    {
+        sample(array.size());
+        for (size_t i = 0; i < array.size(); i++)
+            array[i] = mean_ + samples_.col(i);
+    }
+
+    //! adds a sample to every entry of an array, e.g. process noise on a StateVectorArray
+    template <typename T, typename ALLOC, template <typename, typename> class ARRAY>
+    void noisify(ARRAY<T, ALLOC>& array)
+    {
+        sample(array.size());
+        for (size_t i = 0; i < array.size(); i++)
+            array[i] += mean_ + samples_.col(i);
+    }
+
+private:
+    //! generates n zero-mean samples as columns of samples_, reuses the buffers for arrays of the same length
+    void sample(size_t n)
+    {
+        whiteSamples_.resize(DIM, n);
+        samples_.resize(DIM, n);
+        white_.fill(whiteSamples_);
+        samples_.noalias() = L_.template triangularView<Eigen::Lower>() * whiteSamples_;
+    }
+
+    vector_t mean_;
+    matrix_t L_;
+    GaussianNoise white_;
+
+    Eigen::Matrix<double, DIM, Eigen::Dynamic> whiteSamples_;
+    Eigen::Matrix<double, DIM, Eigen::Dynamic> samples_;
+};
+
+}  // namespace core
+}  // namespace ct
@@ -0,0 +1,146 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ct {
+namespace core {
+
+//! Philox4x32-10 counter-based random number engine
+/*!
+ * Philox (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011) computes a block of four 32 bit
+ * random numbers as a keyed bijection of a 128 bit counter. Blocks do not depend on each other, hence bulk generation
+ * with fill() computes several blocks side by side and the engine has no state besides the key and the counter.
+ *
+ * The key is the 64 bit seed. The upper half of the counter is the stream id, hence engines with the same seed and
+ * different streams produce independent sequences, e.g. one per thread or per Monte-Carlo scenario.
+ *
+ * Satisfies the requirements of a UniformRandomBitGenerator, i.e. it can be used with the std distributions.
+ */
+class Philox4x32
+{
+public:
+    typedef uint32_t result_type;
+
+    //! constructor
+    /*!
+     * @param seed the key of the engine
+     * @param stream the stream id
+     */
+    explicit Philox4x32(uint64_t seed = 0, uint64_t stream = 0) { this->seed(seed, stream); }
+
+    //! restart the engine at the beginning of the given stream
+    void seed(uint64_t seed, uint64_t stream = 0)
+    {
+        key_[0] = static_cast<uint32_t>(seed);
+        key_[1] = static_cast<uint32_t>(seed >> 32);
+        stream_ = stream;
+        counter_ = 0;
+        bufferPos_ = 4;
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    //! next random number
+    result_type operator()()
+    {
+        if (bufferPos_ == 4)
+        {
+            generateBlock(counter_++, buffer_);
+            bufferPos_ = 0;
+        }
+        return buffer_[bufferPos_++];
+    }
+
+    //! generate n random numbers, equivalent to n calls of operator()
+    void fill(result_type* data, size_t n)
+    {
+        // use up the current block first, then generate whole blocks directly into the output
+        while (n > 0 && bufferPos_ < 4)
+        {
+            *data++ = buffer_[bufferPos_++];
+            n--;
+        }
+
+        const size_t nBlocks = n / 4;
+        size_t b = 0;
+        for (; b + 8 <= nBlocks; b += 8)
+            generateBlocks<8>(counter_ + b, data + 4 * b);
+        for (; b < nBlocks; b++)
+            generateBlocks<1>(counter_ + b, data + 4 * b);
+        counter_ += nBlocks;
+
+        for (size_t i = 4 * nBlocks; i < n; i++)
+            data[i] = this->operator()();
+    }
+
+    //! skip n blocks of four numbers
+    void discardBlocks(uint64_t n)
+    {
+        counter_ += n;
+        bufferPos_ = 4;
+    }
+
+    //! the block of four numbers at position counter of the stream
+    void generateBlock(uint64_t counter, result_type* out) const { generateBlocks<1>(counter, out); }
+    //! the LANES consecutive blocks starting at position counter of the stream
+    /*!
+     * The blocks are computed side by side in structure-of-arrays layout, such that the compiler can vectorize the
+     * rounds across the lanes.
+     */
+    template <size_t LANES>
+    void generateBlocks(uint64_t counter, result_type* out) const
+    {
+        uint32_t c0[LANES], c1[LANES], c2[LANES], c3[LANES];
+        for (size_t l = 0; l < LANES; l++)
+        {
+            c0[l] = static_cast<uint32_t>(counter + l);
+            c1[l] = static_cast<uint32_t>((counter + l) >> 32);
+            c2[l] = static_cast<uint32_t>(stream_);
+            c3[l] = static_cast<uint32_t>(stream_ >> 32);
+        }
+        uint32_t k0 = key_[0];
+        uint32_t k1 = key_[1];
+
+        for (int round = 0; round < 10; round++)
+        {
+            for (size_t l = 0; l < LANES; l++)
+            {
+                const uint64_t p0 = uint64_t(0xD2511F53) * c0[l];
+                const uint64_t p1 = uint64_t(0xCD9E8D57) * c2[l];
+                c0[l] = static_cast<uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+                c1[l] = static_cast<uint32_t>(p1);
+                c2[l] = static_cast<uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+                c3[l] = static_cast<uint32_t>(p0);
+            }
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+
+        for (size_t l = 0; l < LANES; l++)
+        {
+            out[4 * l] = c0[l];
+            out[4 * l + 1] = c1[l];
+            out[4 * l + 2] = c2[l];
+            out[4 * l + 3] = c3[l];
+        }
+    }
+
+private:
+    uint32_t key_[2];
+    uint64_t stream_;
+    uint64_t counter_;  //! the next block to generate
+
+    result_type buffer_[4];
+    int bufferPos_;
+};
+
+}  // namespace core
+}  // namespace ct
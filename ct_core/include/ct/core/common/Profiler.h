@@ -0,0 +1,200 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ct {
+namespace core {
+
+//! a timed zone recorded by the Profiler, times in nanoseconds since the start of the profiler
+struct ProfileEvent
+{
+    const char* name;
+    int64_t start;
+    int64_t duration;
+};
+
+//! statistics of all recorded zones of the same name, in milliseconds
+struct PhaseStatistics
+{
+    size_t count;
+    double total;
+    double mean;
+    double min;
+    double max;
+    double p50;  //!< median
+    double p99;  //!< 99th percentile
+};
+
+//! Records timed zones of the solver hot paths into per-thread ring buffers
+/*!
+ * Zones are recorded with the CT_PROFILE_SCOPE macro, which expands to nothing unless ct is compiled with
+ * CT_PROFILING (cmake option). Every thread writes into its own ring buffer without locking, hence recording a
+ * zone costs two clock reads and one store. The ring buffers keep the last BUFFER_CAPACITY zones of each thread.
+ *
+ * The recorded zones can be exported in the Chrome trace event format (chrome://tracing, Perfetto) or aggregated
+ * into per-phase statistics. Exporting while other threads record zones may return partially updated zones.
+ */
+class Profiler
+{
+public:
+    static const size_t BUFFER_CAPACITY = 1 << 15;  //!< number of zones kept per thread
+
+    //! the process wide profiler
+    static Profiler& instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    //! the current time in nanoseconds since the start of the profiler
+    static int64_t now()
+    {
+        static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    //! record a zone of the calling thread, name must be a string literal
+    void record(const char* name, int64_t start, int64_t end)
+    {
+        ThreadBuffer& buffer = threadBuffer();
+        const size_t count = buffer.count.load(std::memory_order_relaxed);
+        buffer.events[count % BUFFER_CAPACITY] = ProfileEvent{name, start, end - start};
+        buffer.count.store(count + 1, std::memory_order_release);
+    }
+
+    //! all recorded zones, grouped by thread
+    std::vector<std::vector<ProfileEvent>> getEvents() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::vector<ProfileEvent>> events(buffers_.size());
+        for (size_t i = 0; i < buffers_.size(); i++)
+        {
+            const size_t count = buffers_[i]->count.load(std::memory_order_acquire);
+            const size_t first = count > BUFFER_CAPACITY ? count - BUFFER_CAPACITY : 0;
+            for (size_t j = first; j < count; j++)
+                events[i].push_back(buffers_[i]->events[j % BUFFER_CAPACITY]);
+        }
+        return events;
+    }
+
+    //! aggregates the recorded zones by name
+    std::map<std::string, PhaseStatistics> computeStatistics() const
+    {
+        std::map<std::string, std::vector<double>> durations;
+        for (const auto& threadEvents : getEvents())
+            for (const ProfileEvent& event : threadEvents)
+                durations[event.name].push_back(event.duration * 1e-6);
+
+        std::map<std::string, PhaseStatistics> statistics;
+        for (auto& phase : durations)
+        {
+            std::vector<double>& d = phase.second;
+            std::sort(d.begin(), d.end());
+            PhaseStatistics& s = statistics[phase.first];
+            s.count = d.size();
+            s.total = 0.0;
+            for (double duration : d)
+                s.total += duration;
+            s.mean = s.total / d.size();
+            s.min = d.front();
+            s.max = d.back();
+            s.p50 = d[(d.size() - 1) / 2];
+            s.p99 = d[(d.size() - 1) * 99 / 100];
+        }
+        return statistics;
+    }
+
+    //! writes all recorded zones in the Chrome trace event format (JSON)
+    void writeChromeTrace(std::ostream& out) const
+    {
+        const std::vector<std::vector<ProfileEvent>> events = getEvents();
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        for (size_t tid = 0; tid < events.size(); tid++)
+        {
+            for (const ProfileEvent& event : events[tid])
+            {
+                out << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                    << tid << ",\"ts\":" << event.start * 1e-3 << ",\"dur\":" << event.duration * 1e-3 << "}";
+                first = false;
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    //! discards all recorded zones
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& buffer : buffers_)
+            buffer->count.store(0, std::memory_order_release);
+    }
+
+private:
+    struct ThreadBuffer
+    {
+        ThreadBuffer() : events(BUFFER_CAPACITY), count(0) {}
+        std::vector<ProfileEvent> events;
+        std::atomic<size_t> count;
+    };
+
+    Profiler() = default;
+
+    //! the buffer of the calling thread, registered on first use
+    ThreadBuffer& threadBuffer()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers_.emplace_back(new ThreadBuffer());
+            buffer = buffers_.back().get();
+        }
+        return *buffer;
+    }
+
+    mutable std::mutex mutex_;                           //!< guards the list of buffers
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;  //!< buffers of all threads, kept after threads exit
+};
+
+//! records the lifetime of the scope as a zone of the Profiler
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name) : name_(name), start_(Profiler::now()) {}
+    ~ProfileScope() { Profiler::instance().record(name_, start_, Profiler::now()); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+    int64_t start_;
+};
+
+}  // namespace core
+}  // namespace ct
+
+#define CT_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CT_PROFILE_CONCAT(a, b) CT_PROFILE_CONCAT_IMPL(a, b)
+
+//! records the remainder of the enclosing scope as a zone named name (a string literal), if compiled with CT_PROFILING
+#ifdef CT_PROFILING
+#define CT_PROFILE_SCOPE(name) ::ct::core::ProfileScope CT_PROFILE_CONCAT(ctProfileScope, __LINE__)(name)
+#else
+#define CT_PROFILE_SCOPE(name)
+#endif
@@ -0,0 +1,140 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ct {
+namespace core {
+
+/*!
+ * Utilities for placing threads on cores.
+ *
+ * On Linux, memory is by default allocated on the NUMA node of the thread that first writes to it. Threads pinned to
+ * cores of one node which allocate their own data hence work on node-local memory. On other platforms, pinning is not
+ * supported and the functions below return false.
+ */
+
+//! parse a list of cores such as "0-3,8,10-11" into the core indices {0, 1, 2, 3, 8, 10, 11}
+inline std::vector<int> parseCoreList(const std::string& list)
+{
+    std::vector<int> cores;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ','))
+    {
+        if (range.find_first_not_of(" \t") == std::string::npos)
+            continue;
+
+        size_t dash = range.find('-');
+        try
+        {
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            if (first < 0 || last < first)
+                throw std::invalid_argument(range);
+            for (int core = first; core <= last; core++)
+                cores.push_back(core);
+        } catch (const std::logic_error&)
+        {
+            throw std::runtime_error("parseCoreList: invalid core range '" + range + "' in '" + list + "'");
+        }
+    }
+    return cores;
+}
+
+#ifdef __linux__
+namespace internal {
+inline cpu_set_t toCpuSet(const std::vector<int>& cores)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cores.empty())
+    {
+        for (int core = 0; core < CPU_SETSIZE; core++)
+            CPU_SET(core, &set);
+    }
+    for (int core : cores)
+        CPU_SET(core, &set);
+    return set;
+}
+}  // namespace internal
+#endif
+
+//! restrict a thread to the given cores, an empty list allows all cores
+/*!
+ * @return true if the affinity was set
+ */
+inline bool setThreadAffinity(std::thread& thread, const std::vector<int>& cores)
+{
+#ifdef __linux__
+    cpu_set_t set = internal::toCpuSet(cores);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+//! restrict the calling thread to the given cores, an empty list allows all cores
+/*!
+ * @return true if the affinity was set
+ */
+inline bool setCurrentThreadAffinity(const std::vector<int>& cores)
+{
+#ifdef __linux__
+    cpu_set_t set = internal::toCpuSet(cores);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+//! pin the calling thread to the core assigned to worker workerId, i.e. cores[workerId % cores.size()]
+/*!
+ * Does nothing if cores is empty or if the thread is already pinned to that core by an earlier call, hence this
+ * can be called cheaply at the beginning of every parallel region.
+ * @return true if the calling thread is pinned to the core
+ */
+inline bool pinCurrentThread(const std::vector<int>& cores, size_t workerId)
+{
+    if (cores.empty())
+        return false;
+
+    thread_local int pinnedCore = -1;
+    const int core = cores[workerId % cores.size()];
+    if (core == pinnedCore)
+        return true;
+
+    if (!setCurrentThreadAffinity(std::vector<int>(1, core)))
+        return false;
+    pinnedCore = core;
+    return true;
+}
+
+//! pin worker workerId of a pool in which worker 0 is the calling thread, such as an OpenMP team or a ThreadPool
+/*!
+ * Worker 0 is left untouched, such that entering a parallel region does not change the affinity of the user's
+ * thread. All other workers are pinned as in pinCurrentThread().
+ * @return true if the calling thread is pinned to the core
+ */
+inline bool pinPoolWorker(const std::vector<int>& cores, size_t workerId)
+{
+    if (workerId == 0)
+        return false;
+    return pinCurrentThread(cores, workerId);
+}
+
+}  // namespace core
+}  // namespace ct
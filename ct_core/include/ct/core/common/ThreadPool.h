@@ -0,0 +1,161 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ct {
+namespace core {
+
+//! A pool of persistent worker threads for fork-join parallel loops
+/*!
+ * The workers are created once and sleep on a condition variable in between jobs, which avoids the cost of
+ * spawning threads in every call. The calling thread participates in every job, hence a pool of size N uses N-1
+ * worker threads. Jobs are distributed dynamically, i.e. every thread fetches the next index as soon as it is done.
+ *
+ * parallelFor() must not be called concurrently or recursively on the same pool.
+ */
+class ThreadPool
+{
+public:
+    //! the job type, called with the id of the executing thread (in [0, nThreads)) and the loop index
+    using Job = std::function<void(size_t threadId, size_t index)>;
+
+    //! constructor
+    /*!
+     * @param nThreads total number of threads including the calling thread, at least one
+     */
+    explicit ThreadPool(size_t nThreads = 1) : nThreads_(nThreads < 1 ? 1 : nThreads), shutdown_(false), generation_(0)
+    {
+        for (size_t i = 1; i < nThreads_; i++)
+            workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! destructor, terminates all workers
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+        wakeup_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    //! total number of threads, including the calling thread
+    size_t getNumThreads() const { return nThreads_; }
+
+    //! execute job(threadId, i) for all i in [0, n), blocks until all indices are processed
+    /*!
+     * Exceptions thrown by the job are rethrown in the calling thread (the first one wins).
+     */
+    void parallelFor(size_t n, const Job& job)
+    {
+        if (n == 0)
+            return;
+
+        // run serially if there is nothing to distribute
+        if (nThreads_ == 1 || n == 1)
+        {
+            for (size_t i = 0; i < n; i++)
+                job(0, i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            n_ = n;
+            next_ = 0;
+            busyWorkers_ = workers_.size();
+            error_ = nullptr;
+            generation_++;
+        }
+        wakeup_.notify_all();
+
+        work(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busyWorkers_ == 0; });
+        job_ = nullptr;
+
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+private:
+    void work(size_t threadId)
+    {
+        size_t i;
+        while ((i = next_++) < n_)
+        {
+            try
+            {
+                (*job_)(threadId, i);
+            } catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex_);
+                if (!error_)
+                    error_ = std::current_exception();
+                next_ = n_;
+            }
+        }
+    }
+
+    void workerLoop(size_t threadId)
+    {
+        size_t lastGeneration = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeup_.wait(lock, [&] { return shutdown_ || generation_ != lastGeneration; });
+                if (shutdown_)
+                    return;
+                lastGeneration = generation_;
+            }
+
+            work(threadId);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                busyWorkers_--;
+            }
+            done_.notify_one();
+        }
+    }
+
+    size_t nThreads_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::condition_variable done_;
+    bool shutdown_;
+    size_t generation_;
+    size_t busyWorkers_;
+
+    const Job* job_;
+    size_t n_;
+    std::atomic<size_t> next_;
+
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+}  // namespace core
+}  // namespace ct
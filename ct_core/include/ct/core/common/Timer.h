@@ -5,13 +5,13 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
-#include <sys/time.h>
+#include <chrono>
 
 namespace ct {
 namespace core {
 namespace tpl {
 
-//! A timer ("stop watch") to record elapsed time based on the system clock
+//! A timer ("stop watch") to record elapsed time based on a monotonic clock
 /*!
  * Keeps track of time in a stop watch fashion.
  */
@@ -26,12 +26,12 @@ public:
 	 * Starts the time measurement.
 	 * Can be re-triggered without calling stop(). Simply overrides the start timestamp.
 	 */
-    inline void start() { gettimeofday(&start_time, NULL); }
+    inline void start() { start_time = std::chrono::steady_clock::now(); }
     //! Trigger stop
     /*!
 	 * Stops the time measurement.
 	 */
-    inline void stop() { gettimeofday(&stop_time, NULL); }
+    inline void stop() { stop_time = std::chrono::steady_clock::now(); }
     //! Get the elapsed time between calls to start() and stop()
     /*!
 	 *
@@ -39,7 +39,7 @@ public:
 	 */
     SCALAR getElapsedTime() const
     {
-        return (stop_time.tv_sec - start_time.tv_sec) + (stop_time.tv_usec - start_time.tv_usec) * 1e-6;
+        return std::chrono::duration<SCALAR>(stop_time - start_time).count();
     }
 
     //! Resets the clock.
@@ -48,15 +48,13 @@ public:
 	 */
     void reset()
     {
-        start_time.tv_sec = 0;
-        start_time.tv_usec = 0;
-        stop_time.tv_sec = 0;
-        stop_time.tv_usec = 0;
+        start_time = std::chrono::steady_clock::time_point();
+        stop_time = std::chrono::steady_clock::time_point();
     }
 
 private:
-    struct timeval start_time; /*!< start time */
-    struct timeval stop_time;  /*!< stop time */
+    std::chrono::steady_clock::time_point start_time; /*!< start time */
+    std::chrono::steady_clock::time_point stop_time;  /*!< stop time */
 };
 }
 
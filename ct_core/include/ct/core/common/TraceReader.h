@@ -0,0 +1,154 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+#include "TraceWriter.h"
+
+namespace ct {
+namespace core {
+
+//! a record of a trace file, the data is converted to double
+struct TraceRecord
+{
+    std::string name;
+    uint64_t iteration;
+    size_t rows;
+    size_t cols;
+    size_t count;
+    TraceScalar scalar;       //!< the scalar type the record was written with
+    std::vector<double> data;  //!< count matrices of size rows x cols, each in column-major order
+
+    //! the i-th matrix of the record
+    Eigen::Map<const Eigen::MatrixXd> matrix(size_t i) const
+    {
+        return Eigen::Map<const Eigen::MatrixXd>(data.data() + i * rows * cols, rows, cols);
+    }
+};
+
+//! Reads trace files written by TraceWriter and converts records to CSV and NumPy files
+/*!
+ * \ingroup Trace
+ */
+class TraceReader
+{
+public:
+    //! opens the trace file and checks its header
+    TraceReader(const std::string& fileName) : file_(fileName, std::ios::binary)
+    {
+        if (!file_)
+            throw std::runtime_error("TraceReader: could not open " + fileName);
+
+        TraceFileHeader header;
+        file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file_ || std::string(header.magic) != "CTTRACE")
+            throw std::runtime_error("TraceReader: " + fileName + " is not a trace file");
+        if (header.version != TRACE_FORMAT_VERSION)
+            throw std::runtime_error("TraceReader: unsupported trace format version " + std::to_string(header.version));
+    }
+
+    //! reads the next record, returns false at the end of the file
+    bool next(TraceRecord& record)
+    {
+        TraceRecordHeader header;
+        file_.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file_.gcount() == 0)
+            return false;
+        if (!file_ || header.magic != TRACE_RECORD_MAGIC)
+            throw std::runtime_error("TraceReader: corrupt record");
+
+        std::vector<char> name((header.nameLength + 7) / 8 * 8);
+        file_.read(name.data(), name.size());
+        record.name.assign(name.data(), header.nameLength);
+        record.iteration = header.iteration;
+        record.rows = header.rows;
+        record.cols = header.cols;
+        record.count = header.count;
+        record.scalar = static_cast<TraceScalar>(header.scalar);
+
+        const size_t size = record.rows * record.cols * record.count;
+        record.data.resize(size);
+        switch (record.scalar)
+        {
+            case TraceScalar::FLOAT64:
+                file_.read(reinterpret_cast<char*>(record.data.data()), size * sizeof(double));
+                break;
+            case TraceScalar::FLOAT32:
+            {
+                std::vector<float> data(size);
+                file_.read(reinterpret_cast<char*>(data.data()), size * sizeof(float));
+                record.data.assign(data.begin(), data.end());
+                break;
+            }
+            default:
+                throw std::runtime_error("TraceReader: unknown scalar type in record " + record.name);
+        }
+        if (!file_)
+            throw std::runtime_error("TraceReader: truncated record " + record.name);
+        return true;
+    }
+
+    //! reads all remaining records
+    std::vector<TraceRecord> readAll()
+    {
+        std::vector<TraceRecord> records;
+        TraceRecord record;
+        while (next(record))
+            records.push_back(record);
+        return records;
+    }
+
+    //! writes a record as CSV, one line per matrix with its elements in column-major order
+    static void writeCsv(std::ostream& out, const TraceRecord& record)
+    {
+        out << std::setprecision(17);
+        for (size_t i = 0; i < record.count; i++)
+        {
+            for (size_t j = 0; j < record.rows * record.cols; j++)
+                out << (j > 0 ? "," : "") << record.data[i * record.rows * record.cols + j];
+            out << "\n";
+        }
+    }
+
+    //! writes a record as NumPy .npy file of shape (count, rows, cols)
+    static void writeNpy(const std::string& fileName, const TraceRecord& record)
+    {
+        std::ofstream out(fileName, std::ios::binary);
+        if (!out)
+            throw std::runtime_error("TraceReader: could not open " + fileName);
+
+        std::ostringstream dict;
+        dict << "{'descr': '<f8', 'fortran_order': False, 'shape': (" << record.count << ", " << record.rows << ", "
+             << record.cols << "), }";
+        std::string header = dict.str();
+        // magic (6) + version (2) + header length (2) + header, padded to a multiple of 64 and terminated by '\n'
+        header.append(63 - (10 + header.size()) % 64, ' ');
+        header.push_back('\n');
+
+        const uint16_t headerLength = static_cast<uint16_t>(header.size());
+        out.write("\x93NUMPY\x01\x00", 8);
+        out.put(static_cast<char>(headerLength & 0xff));
+        out.put(static_cast<char>(headerLength >> 8));
+        out << header;
+
+        // C order, i.e. the elements of each matrix row by row
+        for (size_t i = 0; i < record.count; i++)
+        {
+            const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajor = record.matrix(i);
+            out.write(reinterpret_cast<const char*>(rowMajor.data()), rowMajor.size() * sizeof(double));
+        }
+    }
+
+private:
+    std::ifstream file_;
+};
+
+}  // namespace core
+}  // namespace ct
@@ -0,0 +1,439 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace ct {
+namespace core {
+
+/*!
+ * \defgroup Trace Binary solver traces
+ *
+ * A trace file is an append-only sequence of records. The file starts with a TraceFileHeader, each record consists of
+ * a TraceRecordHeader, the name of the record (padded to a multiple of 8 bytes) and the data. A record holds an array
+ * of `count` matrices of equal size, each stored in column-major order.
+ */
+
+//! the scalar type of the data of a trace record
+enum class TraceScalar : uint32_t
+{
+    FLOAT64 = 0,
+    FLOAT32 = 1
+};
+
+//! header at the beginning of every trace file
+struct TraceFileHeader
+{
+    char magic[8];     //!< "CTTRACE" followed by a zero byte
+    uint32_t version;  //!< format version
+    uint32_t reserved;
+};
+
+//! fixed layout header of every trace record
+struct TraceRecordHeader
+{
+    uint32_t magic;       //!< TRACE_RECORD_MAGIC, for detecting corrupt files
+    uint32_t nameLength;  //!< length of the name following the header, without padding
+    uint64_t iteration;   //!< the solver iteration the record belongs to
+    uint32_t rows;        //!< rows of each matrix
+    uint32_t cols;        //!< columns of each matrix
+    uint32_t count;       //!< number of matrices
+    uint32_t scalar;      //!< the TraceScalar of the data
+};
+
+static_assert(sizeof(TraceFileHeader) == 16, "unexpected padding in TraceFileHeader");
+static_assert(sizeof(TraceRecordHeader) == 32, "unexpected padding in TraceRecordHeader");
+
+static const uint32_t TRACE_FORMAT_VERSION = 1;
+static const uint32_t TRACE_RECORD_MAGIC = 0x43525443;  // "CTRC"
+
+namespace internal {
+
+template <typename SCALAR>
+struct TraceScalarOf
+{
+    static_assert(std::is_same<SCALAR, double>::value || std::is_same<SCALAR, float>::value,
+        "traces support double and float data only");
+    static const TraceScalar value = std::is_same<SCALAR, double>::value ? TraceScalar::FLOAT64 : TraceScalar::FLOAT32;
+};
+
+//! access to the elements of a trace record, Eigen matrices
+template <typename T, typename Enable = void>
+struct TraceElement
+{
+    typedef typename T::Scalar Scalar;
+    //! fixed size column-major matrices are stored without padding
+    static const bool contiguous = T::SizeAtCompileTime != Eigen::Dynamic &&
+                                   (!T::IsRowMajor || T::IsVectorAtCompileTime) &&
+                                   sizeof(T) == T::SizeAtCompileTime * sizeof(Scalar);
+    static size_t rows(const T& element) { return element.rows(); }
+    static size_t cols(const T& element) { return element.cols(); }
+    static void copy(const T& element, Scalar* dest)
+    {
+        Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(dest, element.rows(), element.cols()) =
+            element;
+    }
+};
+
+//! access to the elements of a trace record, scalars
+template <typename T>
+struct TraceElement<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+{
+    typedef T Scalar;
+    static const bool contiguous = true;
+    static size_t rows(const T&) { return 1; }
+    static size_t cols(const T&) { return 1; }
+    static void copy(const T& element, Scalar* dest) { *dest = element; }
+};
+
+}  // namespace internal
+
+//! Writes solver traces to a binary file from a background thread
+/*!
+ * Records are serialized into a ring buffer by the calling thread and written to disk by a background thread. The
+ * ring is a lock-free single-producer single-consumer queue, hence all write() calls must happen from the same thread.
+ * It is allocated once and only grows if a single record does not fit into it. If the ring is full, write() waits for
+ * the background thread.
+ *
+ * Such that the background thread does not compete with the solver for the core, it sleeps until the ring is half
+ * full, flush() is called or the flush interval has passed. It then writes all pending records at once.
+ *
+ * Write errors of the background thread, e.g. a full disk, are reported by good() and by an exception thrown from
+ * flush(). Records committed after an error are discarded. The destructor cannot throw and prints the error instead.
+ *
+ * Trace files are read with TraceReader.
+ *
+ * \ingroup Trace
+ */
+class TraceWriter
+{
+public:
+    //! constructor
+    /*!
+     * @param fileName the trace file, an existing file is overwritten
+     * @param bufferSize the size of the ring buffer in bytes
+     * @param flushInterval the maximum time the background thread sleeps while records are pending
+     */
+    TraceWriter(const std::string& fileName,
+        size_t bufferSize = 1 << 20,
+        std::chrono::milliseconds flushInterval = std::chrono::milliseconds(100))
+        : fileName_(fileName),
+          buffer_(padded(std::max(bufferSize, sizeof(TraceRecordHeader)))),
+          pendingHead_(0),
+          flushInterval_(flushInterval),
+          head_(0),
+          tail_(0),
+          stop_(false),
+          sleeping_(false),
+          wake_(false),
+          failed_(false),
+          errorNumber_(0)
+    {
+        file_ = std::fopen(fileName.c_str(), "wb");
+        if (!file_)
+            throw std::runtime_error("TraceWriter: could not open " + fileName);
+        std::setvbuf(file_, nullptr, _IOFBF, 1 << 20);
+
+        TraceFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, "CTTRACE", 8);
+        header.version = TRACE_FORMAT_VERSION;
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1)
+        {
+            std::fclose(file_);
+            throw std::runtime_error("TraceWriter: could not write to " + fileName);
+        }
+
+        consumer_ = std::thread(&TraceWriter::consumerLoop, this);
+    }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    //! destructor, writes all pending records
+    ~TraceWriter()
+    {
+        stop_ = true;
+        wakeConsumer();
+        consumer_.join();
+        if (std::fclose(file_) != 0 && good())
+            setFailed(errno);
+        if (!good())
+            std::cerr << errorMessage() << std::endl;
+    }
+
+    //! write a single matrix
+    template <typename Derived>
+    void write(const std::string& name, uint64_t iteration, const Eigen::MatrixBase<Derived>& matrix)
+    {
+        typedef typename Derived::Scalar Scalar;
+        Scalar* data = beginRecord<Scalar>(name, iteration, matrix.rows(), matrix.cols(), 1);
+        Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>>(data, matrix.rows(), matrix.cols()) = matrix;
+        commitRecord();
+    }
+
+    //! write a scalar
+    template <typename Scalar>
+    typename std::enable_if<std::is_floating_point<Scalar>::value, void>::type write(const std::string& name,
+        uint64_t iteration,
+        const Scalar& value)
+    {
+        *beginRecord<Scalar>(name, iteration, 1, 1, 1) = value;
+        commitRecord();
+    }
+
+    //! write an array of equally sized matrices or scalars, e.g. a DiscreteArray
+    template <typename ARRAY>
+    void writeArray(const std::string& name, uint64_t iteration, const ARRAY& array)
+    {
+        typedef typename std::decay<decltype(array[0])>::type Element;
+        typedef internal::TraceElement<Element> Access;
+        typedef typename Access::Scalar Scalar;
+
+        const size_t count = array.size();
+        const size_t rows = count > 0 ? Access::rows(array[0]) : 0;
+        const size_t cols = count > 0 ? Access::cols(array[0]) : 0;
+        Scalar* data = beginRecord<Scalar>(name, iteration, rows, cols, count);
+
+        // the elements of a DiscreteArray are stored without gaps, the whole array is copied at once
+        if (Access::contiguous && count > 0 && &array[count - 1] == &array[0] + (count - 1))
+            std::memcpy(data, &array[0], count * rows * cols * sizeof(Scalar));
+        else
+            for (size_t i = 0; i < count; i++)
+                Access::copy(array[i], data + i * rows * cols);
+        commitRecord();
+    }
+
+    //! blocks until all pending records are written to the file
+    /*!
+     * @throw std::runtime_error if writing any record failed
+     */
+    void flush()
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        wakeConsumer();
+        while (tail_.load(std::memory_order_acquire) != head)
+            std::this_thread::yield();
+        if (good() && std::fflush(file_) != 0)
+            setFailed(errno);
+        if (!good())
+            throw std::runtime_error(errorMessage());
+    }
+
+    //! false if writing a record to the file failed
+    bool good() const { return !failed_.load(std::memory_order_acquire); }
+
+    //! a description of the write error, empty if good()
+    std::string errorMessage() const
+    {
+        if (good())
+            return std::string();
+        return "TraceWriter: writing to " + fileName_ + " failed: " + std::strerror(errorNumber_);
+    }
+
+private:
+    //! rounds up to a multiple of 8 bytes
+    static size_t padded(size_t length) { return (length + 7) / 8 * 8; }
+
+    //! the size of a record in the file
+    static size_t recordLength(const TraceRecordHeader& header)
+    {
+        const size_t scalarSize = header.scalar == static_cast<uint32_t>(TraceScalar::FLOAT64) ? 8 : 4;
+        return sizeof(TraceRecordHeader) + padded(header.nameLength) +
+               size_t(header.rows) * header.cols * header.count * scalarSize;
+    }
+
+    //! reserves a record in the ring, writes header and name and returns the location of the data
+    template <typename Scalar>
+    Scalar* beginRecord(const std::string& name, uint64_t iteration, size_t rows, size_t cols, size_t count)
+    {
+        const size_t dataOffset = sizeof(TraceRecordHeader) + padded(name.size());
+        char* record = reserve(dataOffset + rows * cols * count * sizeof(Scalar));
+
+        TraceRecordHeader header;
+        header.magic = TRACE_RECORD_MAGIC;
+        header.nameLength = static_cast<uint32_t>(name.size());
+        header.iteration = iteration;
+        header.rows = static_cast<uint32_t>(rows);
+        header.cols = static_cast<uint32_t>(cols);
+        header.count = static_cast<uint32_t>(count);
+        header.scalar = static_cast<uint32_t>(internal::TraceScalarOf<Scalar>::value);
+        std::memcpy(record, &header, sizeof(header));
+        std::memset(record + sizeof(header), 0, padded(name.size()));
+        std::memcpy(record + sizeof(header), name.data(), name.size());
+        return reinterpret_cast<Scalar*>(record + dataOffset);
+    }
+
+    //! waits until the ring has space for a record of the given length and returns its location
+    /*!
+     * Records are stored at multiples of 8 bytes and do not wrap around. If a record does not fit before the end of
+     * the ring, the remaining space is skipped and marked as such if it can hold a record header.
+     */
+    char* reserve(size_t length)
+    {
+        length = padded(length);
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (length > buffer_.size())
+        {
+            // the consumer does not access the ring while it is empty
+            waitForSpace(head, buffer_.size());
+            buffer_.resize(2 * length);
+        }
+
+        const size_t position = head % buffer_.size();
+        const size_t skip = buffer_.size() - position < length ? buffer_.size() - position : 0;
+        waitForSpace(head, skip + length);
+        if (skip >= sizeof(TraceRecordHeader))
+            std::memset(buffer_.data() + position, 0, sizeof(uint32_t));
+
+        pendingHead_ = head + skip + length;
+        return buffer_.data() + (head + skip) % buffer_.size();
+    }
+
+    //! waits until the ring has space for the given number of bytes after head
+    void waitForSpace(size_t head, size_t length)
+    {
+        if (head - tail_.load(std::memory_order_acquire) + length <= buffer_.size())
+            return;
+
+        wakeConsumer();
+        while (head - tail_.load(std::memory_order_acquire) + length > buffer_.size())
+            std::this_thread::yield();
+    }
+
+    //! hands the reserved record over to the background thread, waking it up once the ring is half full
+    void commitRecord()
+    {
+        head_.store(pendingHead_, std::memory_order_release);
+        if (2 * (pendingHead_ - tail_.load(std::memory_order_relaxed)) >= buffer_.size() &&
+            sleeping_.load(std::memory_order_relaxed))
+            wakeConsumer();
+    }
+
+    void wakeConsumer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wake_ = true;
+        }
+        wakeup_.notify_one();
+    }
+
+    void consumerLoop()
+    {
+        while (true)
+        {
+            // stop_ is loaded before head_, such that the records committed before the stop request are written
+            const bool stopping = stop_.load(std::memory_order_acquire);
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            const size_t head = head_.load(std::memory_order_acquire);
+            if (tail != head)
+            {
+                writeRecords(tail, head);
+                tail_.store(head, std::memory_order_release);
+            }
+            else if (stopping)
+                break;
+
+            if (!stopping)
+                waitForRecords();
+        }
+    }
+
+    //! sleeps until woken up by the producer or until the flush interval has passed
+    void waitForRecords()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        sleeping_.store(true, std::memory_order_relaxed);
+        wakeup_.wait_for(lock, flushInterval_, [this] { return wake_; });
+        wake_ = false;
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+
+    //! writes the records between tail and head, records adjacent in the ring with a single call to fwrite
+    void writeRecords(size_t tail, const size_t head)
+    {
+        const size_t size = buffer_.size();
+        size_t begin = tail % size;
+        size_t end = begin;
+        while (tail != head)
+        {
+            const size_t position = tail % size;
+            TraceRecordHeader header;
+            header.magic = 0;
+            if (size - position >= sizeof(header))
+                std::memcpy(&header, buffer_.data() + position, sizeof(header));
+
+            if (header.magic != TRACE_RECORD_MAGIC)
+            {
+                // skipped space at the end of the ring
+                writeBlock(begin, end);
+                tail += size - position;
+                begin = end = 0;
+                continue;
+            }
+
+            if (position != end)
+            {
+                writeBlock(begin, end);
+                begin = position;
+            }
+            end = position + recordLength(header);
+            tail += padded(recordLength(header));
+        }
+        writeBlock(begin, end);
+    }
+
+    //! writes a part of the ring to the file, after an error the data is discarded
+    void writeBlock(size_t begin, size_t end)
+    {
+        if (end > begin && good() && std::fwrite(buffer_.data() + begin, 1, end - begin, file_) != end - begin)
+            setFailed(errno);
+    }
+
+    //! record the first error, errno is published by the release store of failed_
+    void setFailed(int errorNumber)
+    {
+        errorNumber_ = errorNumber;
+        failed_.store(true, std::memory_order_release);
+    }
+
+    std::string fileName_;
+    std::FILE* file_;
+    std::vector<char> buffer_;                 //!< the ring of serialized records
+    size_t pendingHead_;                       //!< head after the record being written by the producer
+    std::chrono::milliseconds flushInterval_;  //!< the maximum time the consumer sleeps
+    std::atomic<size_t> head_;                 //!< number of bytes committed by the producer
+    std::atomic<size_t> tail_;                 //!< number of bytes written by the consumer
+    std::atomic<bool> stop_;
+    std::atomic<bool> sleeping_;  //!< the consumer waits for wakeup_
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool wake_;                 //!< wake-up request for the consumer, guarded by mutex_
+    std::atomic<bool> failed_;  //!< set on the first write error
+    int errorNumber_;           //!< errno of the first write error
+    std::thread consumer_;
+};
+
+}  // namespace core
+}  // namespace ct
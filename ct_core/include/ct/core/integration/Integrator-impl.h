@@ -13,8 +13,9 @@ template <size_t STATE_DIM, typename SCALAR>
 Integrator<STATE_DIM, SCALAR>::Integrator(const std::shared_ptr<System<STATE_DIM, SCALAR>>& system,
     const IntegrationType& intType,
     const EventHandlerPtrVector& eventHandlers)
-    : system_(system), observer_(eventHandlers)
+    : system_(system), observer_(eventHandlers), switchingTimesSet_(false), splitFixedSteps_(true)
 {
+    switchingSchedule_ = std::dynamic_pointer_cast<SwitchingSchedule<SCALAR>>(system_);
     changeIntegrationType(intType);
     setupSystem();
 }
@@ -23,8 +24,12 @@ template <size_t STATE_DIM, typename SCALAR>
 Integrator<STATE_DIM, SCALAR>::Integrator(const std::shared_ptr<System<STATE_DIM, SCALAR>>& system,
     const IntegrationType& intType,
     const EventHandlerPtr& eventHandler)
-    : system_(system), observer_(EventHandlerPtrVector(1, eventHandler))
+    : system_(system),
+      observer_(EventHandlerPtrVector(1, eventHandler)),
+      switchingTimesSet_(false),
+      splitFixedSteps_(true)
 {
+    switchingSchedule_ = std::dynamic_pointer_cast<SwitchingSchedule<SCALAR>>(system_);
     changeIntegrationType(intType);
     setupSystem();
 }
@@ -46,6 +51,19 @@ void Integrator<STATE_DIM, SCALAR>::setApadativeErrorTolerances(const SCALAR abs
     integratorStepper_->setAdaptiveErrorTolerances(absErrTol, relErrTol);
 }
 
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::setSwitchingTimes(const std::vector<SCALAR>& switchingTimes)
+{
+    switchingTimes_ = switchingTimes;
+    switchingTimesSet_ = true;
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::setSplitFixedSteps(bool splitFixedSteps)
+{
+    splitFixedSteps_ = splitFixedSteps;
+}
+
 template <size_t STATE_DIM, typename SCALAR>
 void Integrator<STATE_DIM, SCALAR>::integrate_n_steps(StateVector<STATE_DIM, SCALAR>& state,
     const SCALAR& startTime,
@@ -55,8 +73,7 @@ void Integrator<STATE_DIM, SCALAR>::integrate_n_steps(StateVector<STATE_DIM, SCA
     tpl::TimeArray<SCALAR>& timeTrajectory)
 {
     reset();
-    integratorStepper_->integrate_n_steps(
-        observer_.observeWrapWithLogging, systemFunction_, state, startTime, numSteps, dt);
+    integrateFixedSteps(observer_.observeWrapWithLogging, state, startTime, numSteps, dt);
     retrieveTrajectoriesFromObserver(stateTrajectory, timeTrajectory);
 }
 
@@ -67,7 +84,7 @@ void Integrator<STATE_DIM, SCALAR>::integrate_n_steps(StateVector<STATE_DIM, SCA
     SCALAR dt)
 {
     reset();
-    integratorStepper_->integrate_n_steps(observer_.observeWrap, systemFunction_, state, startTime, numSteps, dt);
+    integrateFixedSteps(observer_.observeWrap, state, startTime, numSteps, dt);
 }
 
 template <size_t STATE_DIM, typename SCALAR>
@@ -79,8 +96,12 @@ void Integrator<STATE_DIM, SCALAR>::integrate_const(StateVector<STATE_DIM, SCALA
     tpl::TimeArray<SCALAR>& timeTrajectory)
 {
     reset();
-    integratorStepper_->integrate_const(
-        observer_.observeWrapWithLogging, systemFunction_, state, startTime, finalTime, dt);
+    if (getSwitchingTimes().empty())
+        integratorStepper_->integrate_const(
+            observer_.observeWrapWithLogging, systemFunction_, state, startTime, finalTime, dt);
+    else
+        integrateFixedSteps(
+            observer_.observeWrapWithLogging, state, startTime, countSteps(startTime, finalTime, dt), dt);
     retrieveTrajectoriesFromObserver(stateTrajectory, timeTrajectory);
 }
 
@@ -91,7 +112,10 @@ void Integrator<STATE_DIM, SCALAR>::integrate_const(StateVector<STATE_DIM, SCALA
     SCALAR dt)
 {
     reset();
-    integratorStepper_->integrate_const(observer_.observeWrap, systemFunction_, state, startTime, finalTime, dt);
+    if (getSwitchingTimes().empty())
+        integratorStepper_->integrate_const(observer_.observeWrap, systemFunction_, state, startTime, finalTime, dt);
+    else
+        integrateFixedSteps(observer_.observeWrap, state, startTime, countSteps(startTime, finalTime, dt), dt);
 }
 
 template <size_t STATE_DIM, typename SCALAR>
@@ -103,8 +127,7 @@ void Integrator<STATE_DIM, SCALAR>::integrate_adaptive(StateVector<STATE_DIM, SC
     const SCALAR dtInitial)
 {
     reset();
-    integratorStepper_->integrate_adaptive(
-        observer_.observeWrapWithLogging, systemFunction_, state, startTime, finalTime, dtInitial);
+    integrateAdaptive(observer_.observeWrapWithLogging, state, startTime, finalTime, dtInitial);
     retrieveTrajectoriesFromObserver(stateTrajectory, timeTrajectory);
     state = stateTrajectory.back();
 }
@@ -116,8 +139,7 @@ void Integrator<STATE_DIM, SCALAR>::integrate_adaptive(StateVector<STATE_DIM, SC
     SCALAR dtInitial)
 {
     reset();
-    integratorStepper_->integrate_adaptive(
-        observer_.observeWrap, systemFunction_, state, startTime, finalTime, dtInitial);
+    integrateAdaptive(observer_.observeWrap, state, startTime, finalTime, dtInitial);
 }
 
 template <size_t STATE_DIM, typename SCALAR>
@@ -132,6 +154,186 @@ void Integrator<STATE_DIM, SCALAR>::integrate_times(StateVector<STATE_DIM, SCALA
     retrieveStateVectorArrayFromObserver(stateTrajectory);
 }
 
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::integrateFixedSteps(const ObserverFunction_t& observe,
+    StateVector<STATE_DIM, SCALAR>& state,
+    const SCALAR& startTime,
+    size_t numSteps,
+    SCALAR dt)
+{
+    const SCALAR tol = SCALAR(1e-9) * dt;
+    auto timeOfStep = [&](size_t k) { return SCALAR(startTime + SCALAR(double(k)) * dt); };
+    const std::vector<SCALAR>& switchingTimes = getSwitchingTimes();
+
+    if (!hasSwitchesIn(switchingTimes, startTime, timeOfStep(numSteps), tol))
+    {
+        activateSegment(startTime, timeOfStep(numSteps));
+        integratorStepper_->integrate_n_steps(observe, systemFunction_, state, startTime, numSteps, dt);
+        releaseMode();
+        return;
+    }
+
+    // a zero step integration performs the initial observation the same way the stepper does
+    bool observesStart = false;
+    integratorStepper_->integrate_n_steps(
+        [&](const Eigen::Matrix<SCALAR, STATE_DIM, 1>& x, const SCALAR& t) {
+            observesStart = true;
+            observe(x, t);
+        },
+        systemFunction_, state, startTime, 0, dt);
+
+    // subsequent blocks start where the previous one ended, their initial observation is skipped
+    bool skipNext = false;
+    ObserverFunction_t blockObserver = [&](const Eigen::Matrix<SCALAR, STATE_DIM, 1>& x, const SCALAR& t) {
+        if (skipNext)
+            skipNext = false;
+        else
+            observe(x, t);
+    };
+
+    size_t s = 0;
+    while (s < switchingTimes.size() && switchingTimes[s] <= startTime + tol)
+        s++;
+
+    size_t k = 0;
+    while (k < numSteps)
+    {
+        // all whole steps up to the next switch are integrated in one block
+        size_t kEnd = k;
+        while (kEnd < numSteps && (s == switchingTimes.size() || timeOfStep(kEnd + 1) <= switchingTimes[s] + tol))
+            kEnd++;
+
+        if (kEnd > k)
+        {
+            activateSegment(timeOfStep(k), timeOfStep(kEnd));
+            skipNext = observesStart;
+            integratorStepper_->integrate_n_steps(blockObserver, systemFunction_, state, timeOfStep(k), kEnd - k, dt);
+            k = kEnd;
+        }
+        else
+        {
+            // step k contains at least one switch
+            const SCALAR t0 = timeOfStep(k);
+            const SCALAR t1 = timeOfStep(k + 1);
+            if (splitFixedSteps_)
+            {
+                SCALAR t = t0;
+                for (; s < switchingTimes.size() && switchingTimes[s] < t1 - tol; s++)
+                {
+                    activateSegment(t, switchingTimes[s]);
+                    integratorStepper_->integrate_n_steps(systemFunction_, state, t, 1, switchingTimes[s] - t);
+                    t = switchingTimes[s];
+                }
+                activateSegment(t, t1);
+                integratorStepper_->integrate_n_steps(systemFunction_, state, t, 1, t1 - t);
+            }
+            else
+            {
+                releaseMode();
+                integratorStepper_->integrate_n_steps(systemFunction_, state, t0, 1, dt);
+            }
+            observe(state, t1);
+            k++;
+        }
+
+        while (s < switchingTimes.size() && switchingTimes[s] <= timeOfStep(k) + tol)
+            s++;
+    }
+
+    releaseMode();
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::integrateAdaptive(const ObserverFunction_t& observe,
+    StateVector<STATE_DIM, SCALAR>& state,
+    const SCALAR& startTime,
+    const SCALAR& finalTime,
+    SCALAR dtInitial)
+{
+    const SCALAR tol = SCALAR(1e-9) * dtInitial;
+    const std::vector<SCALAR>& switchingTimes = getSwitchingTimes();
+
+    if (!hasSwitchesIn(switchingTimes, startTime, finalTime, tol))
+    {
+        activateSegment(startTime, finalTime);
+        integratorStepper_->integrate_adaptive(observe, systemFunction_, state, startTime, finalTime, dtInitial);
+        releaseMode();
+        return;
+    }
+
+    // each segment starts where the previous one ended, its initial observation is skipped
+    bool skipNext = false;
+    ObserverFunction_t segmentObserver = [&](const Eigen::Matrix<SCALAR, STATE_DIM, 1>& x, const SCALAR& t) {
+        if (skipNext)
+            skipNext = false;
+        else
+            observe(x, t);
+    };
+
+    SCALAR t = startTime;
+    for (size_t s = 0; s < switchingTimes.size() && switchingTimes[s] < finalTime - tol; s++)
+    {
+        if (switchingTimes[s] <= t + tol)
+            continue;
+
+        activateSegment(t, switchingTimes[s]);
+        integratorStepper_->integrate_adaptive(
+            segmentObserver, systemFunction_, state, t, switchingTimes[s], dtInitial);
+        skipNext = true;
+        t = switchingTimes[s];
+    }
+    activateSegment(t, finalTime);
+    integratorStepper_->integrate_adaptive(segmentObserver, systemFunction_, state, t, finalTime, dtInitial);
+
+    releaseMode();
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+size_t Integrator<STATE_DIM, SCALAR>::countSteps(const SCALAR& startTime,
+    const SCALAR& finalTime,
+    const SCALAR& dt) const
+{
+    const SCALAR tol = SCALAR(1e-9) * dt;
+    size_t numSteps = 0;
+    while (startTime + SCALAR(double(numSteps + 1)) * dt <= finalTime + tol)
+        numSteps++;
+    return numSteps;
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+const std::vector<SCALAR>& Integrator<STATE_DIM, SCALAR>::getSwitchingTimes() const
+{
+    if (switchingSchedule_ && !switchingTimesSet_)
+        return switchingSchedule_->getSwitchingTimes();
+    return switchingTimes_;
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+bool Integrator<STATE_DIM, SCALAR>::hasSwitchesIn(const std::vector<SCALAR>& switchingTimes,
+    const SCALAR& t0,
+    const SCALAR& t1,
+    const SCALAR& tol) const
+{
+    for (const SCALAR& switchingTime : switchingTimes)
+        if (switchingTime > t0 + tol && switchingTime < t1 - tol)
+            return true;
+    return false;
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::activateSegment(const SCALAR& t0, const SCALAR& t1)
+{
+    if (switchingSchedule_)
+        switchingSchedule_->fixModeAtTime(SCALAR(0.5) * (t0 + t1));
+}
+
+template <size_t STATE_DIM, typename SCALAR>
+void Integrator<STATE_DIM, SCALAR>::releaseMode()
+{
+    if (switchingSchedule_)
+        switchingSchedule_->releaseMode();
+}
+
 
 template <size_t STATE_DIM, typename SCALAR>
 void Integrator<STATE_DIM, SCALAR>::initializeCTSteppers(const IntegrationType& intType)
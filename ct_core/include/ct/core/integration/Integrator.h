@@ -19,6 +19,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "internal/SteppersCT.h"
 
 #include <ct/core/types/AutoDiff.h>
+#include <ct/core/switching/Switching.h>
 
 namespace ct {
 namespace core {
@@ -54,6 +55,10 @@ enum IntegrationType
  *
  * Unit test \ref IntegrationTest.cpp illustrates the use of Integrator.h
  *
+ * If the system implements SwitchingSchedule, the integration is split at its switching times: adaptive steppers
+ * are restarted at every switch and fixed steps containing a switch are split into substeps. Within each segment the
+ * active mode is fixed, such that it is not looked up in every evaluation of the dynamics.
+ *
  *
  * @tparam STATE_DIM the size of the state vector
  * @tparam SCALAR The scalar type
@@ -99,6 +104,23 @@ public:
 	 */
     void setApadativeErrorTolerances(const SCALAR absErrTol, const SCALAR& relErrTol);
 
+    /**
+	 * @brief      Sets the times at which the dynamics switch. If the system implements SwitchingSchedule, its
+	 *             switching times are read at every integration unless they are overridden here.
+	 *
+	 * @param[in]  switchingTimes  The switching times in ascending order
+	 */
+    void setSwitchingTimes(const std::vector<SCALAR>& switchingTimes);
+
+    /**
+	 * @brief      Enables or disables splitting of fixed steps at switching times (enabled by default). If
+	 *             disabled, all steps have equal length and the mode is looked up in every evaluation of the dynamics
+	 *             within steps that contain a switch.
+	 *
+	 * @param[in]  splitFixedSteps  true if fixed steps should be split at switching times
+	 */
+    void setSplitFixedSteps(bool splitFixedSteps);
+
     //! Equidistant integration based on number of time steps and step length
     /*!
 	 * Integrates n steps forward from the current state recording the state and time trajectory.
@@ -212,7 +234,8 @@ public:
 
     //! Integrate system using a given time trajectory
     /*!
-	 * Integrates a system using a given time sequence
+	 * Integrates a system using a given time sequence. The integration is not split at switching times, the mode
+	 * is looked up in every evaluation of the dynamics.
 	 *
 	 * \warning Overrides the initial state
 	 *
@@ -227,6 +250,40 @@ public:
         SCALAR dtInitial = SCALAR(0.01));
 
 private:
+    typedef std::function<void(const Eigen::Matrix<SCALAR, STATE_DIM, 1>&, const SCALAR&)> ObserverFunction_t;
+
+    //! fixed step integration, split at the switching times
+    void integrateFixedSteps(const ObserverFunction_t& observe,
+        StateVector<STATE_DIM, SCALAR>& state,
+        const SCALAR& startTime,
+        size_t numSteps,
+        SCALAR dt);
+
+    //! adaptive integration, restarted at the switching times
+    void integrateAdaptive(const ObserverFunction_t& observe,
+        StateVector<STATE_DIM, SCALAR>& state,
+        const SCALAR& startTime,
+        const SCALAR& finalTime,
+        SCALAR dtInitial);
+
+    //! number of fixed steps between startTime and finalTime
+    size_t countSteps(const SCALAR& startTime, const SCALAR& finalTime, const SCALAR& dt) const;
+
+    //! the switching times set by setSwitchingTimes(), otherwise the current ones of the system
+    const std::vector<SCALAR>& getSwitchingTimes() const;
+
+    //! true if a switch lies strictly within (t0, t1), up to the tolerance
+    bool hasSwitchesIn(const std::vector<SCALAR>& switchingTimes,
+        const SCALAR& t0,
+        const SCALAR& t1,
+        const SCALAR& tol) const;
+
+    //! fixes the mode of the system to the mode active within the segment [t0, t1]
+    void activateSegment(const SCALAR& t0, const SCALAR& t1);
+
+    //! the mode of the system is looked up from the time again
+    void releaseMode();
+
     /**
 	 * @brief      Initializes the custom ct steppers
 	 *
@@ -235,13 +292,13 @@ private:
     void initializeCTSteppers(const IntegrationType& intType);
     /**
 	 * @brief      Initializes the adaptive odeint steppers. The odeint steppers
-	 *             only work for double currently
+	 *             only work for floating point types currently
 	 *
 	 * @param[in]  intType  The integration type
 	 *
 	 */
     template <typename S = SCALAR>
-    typename std::enable_if<std::is_same<S, double>::value, void>::type initializeAdaptiveSteppers(
+    typename std::enable_if<std::is_floating_point<S>::value, void>::type initializeAdaptiveSteppers(
         const IntegrationType& intType)
     {
         switch (intType)
@@ -280,7 +337,7 @@ private:
     }
 
     template <typename S = SCALAR>
-    typename std::enable_if<!std::is_same<S, double>::value, void>::type initializeAdaptiveSteppers(
+    typename std::enable_if<!std::is_floating_point<S>::value, void>::type initializeAdaptiveSteppers(
         const IntegrationType& intType)
     {
     }
@@ -294,14 +351,14 @@ private:
 #endif
 
     /**
-	 * @brief      Initializes the ODEint fixed size steppers for double type. Does not work for
+	 * @brief      Initializes the ODEint fixed size steppers for floating point types. Does not work for
 	 *             ad types
 	 *
 	 * @param[in]  intType  The int type
 	 *
 	 */
     template <typename S = SCALAR>
-    typename std::enable_if<std::is_same<S, double>::value, void>::type initializeODEIntSteppers(
+    typename std::enable_if<std::is_floating_point<S>::value, void>::type initializeODEIntSteppers(
         const IntegrationType& intType)
     {
         switch (intType)
@@ -377,6 +434,11 @@ private:
         systemFunction_;  //! the system function to integrate
     std::shared_ptr<internal::StepperBase<Eigen::Matrix<SCALAR, STATE_DIM, 1>, SCALAR>> integratorStepper_;
     Observer<STATE_DIM, SCALAR> observer_;  //! observer
+
+    std::shared_ptr<SwitchingSchedule<SCALAR>> switchingSchedule_;  //! the system, if it switches
+    std::vector<SCALAR> switchingTimes_;                            //! the switching times set by the user
+    bool switchingTimesSet_;                                        //! true if switchingTimes_ override the system
+    bool splitFixedSteps_;                                          //! split fixed steps at switching times
 };
 }
 }
@@ -0,0 +1,111 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+namespace ct {
+namespace core {
+
+//! Zero-order hold discretization of a linear system through the exponential of the augmented system matrix
+/*!
+ * Computes A_d and B_d of the zero-order hold discretization of \f$ \dot{x} = Ax + Bu \f$ together as
+ *
+ * \f[
+ *  \exp \left( \begin{bmatrix} A & B \\ 0 & 0 \end{bmatrix} dt \right) =
+ *  \begin{bmatrix} A_d & B_d \\ 0 & I \end{bmatrix}
+ * \f]
+ *
+ * using a degree 7 Padé approximant with scaling and squaring (Higham, "The scaling and squaring method for the
+ * matrix exponential revisited", 2005). The block-triangular structure of the augmented matrix is exploited, such
+ * that all products are of size STATE_DIM x STATE_DIM or STATE_DIM x CONTROL_DIM. In contrast to computing
+ * \f$ B_d = A^{-1} (A_d - I) B \f$, this does not require A to be invertible.
+ *
+ * All intermediate matrices are members, an instance can be reused for discretizing many stages.
+ *
+ * \tparam STATE_DIM size of state vector
+ * \tparam CONTROL_DIM size of input vector
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = double>
+class AugmentedMatrixExponential
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef StateMatrix<STATE_DIM, SCALAR> state_matrix_t;
+    typedef StateControlMatrix<STATE_DIM, CONTROL_DIM, SCALAR> state_control_matrix_t;
+
+    //! compute the discrete-time matrices A_d and B_d of the continuous-time matrices A and B for time step dt
+    void compute(const state_matrix_t& A,
+        const state_control_matrix_t& B,
+        const SCALAR& dt,
+        state_matrix_t& A_discr,
+        state_control_matrix_t& B_discr)
+    {
+        // 1-norm of the augmented matrix, the zero rows do not contribute to the column sums
+        const SCALAR norm = std::max(A.cwiseAbs().colwise().sum().maxCoeff(), B.cwiseAbs().colwise().sum().maxCoeff());
+
+        int squarings = 0;
+        if (std::abs(dt) * norm > theta7())
+            squarings = static_cast<int>(std::ceil(std::log2(std::abs(dt) * norm / theta7())));
+        const SCALAR scaling = dt / std::pow(SCALAR(2.0), squarings);
+
+        F_ = scaling * A;
+        G_ = scaling * B;
+        F2_.noalias() = F_ * F_;
+        F4_.noalias() = F2_ * F2_;
+        F6_.noalias() = F4_ * F2_;
+
+        // odd part U and even part V of the Padé numerator, the denominator is V - U
+        W_ = b(7) * F6_ + b(5) * F4_ + b(3) * F2_;
+        W_.diagonal().array() += b(1);
+        Z_ = b(6) * F4_ + b(4) * F2_;
+        Z_.diagonal().array() += b(2);
+
+        U11_.noalias() = F_ * W_;
+        V11_.noalias() = F2_ * Z_;
+        V11_.diagonal().array() += b(0);
+        U12_.noalias() = W_ * G_;
+
+        // the bottom right blocks of numerator and denominator are b0 * I, hence the even part of the top right
+        // blocks cancels and the top right block of the approximant is (V11 - U11)^-1 * 2 * U12
+        lu_.compute(V11_ - U11_);
+        A_discr = lu_.solve(V11_ + U11_);
+        B_discr = lu_.solve(SCALAR(2.0) * U12_);
+
+        for (int i = 0; i < squarings; i++)
+        {
+            B_discr += A_discr * B_discr;
+            F_.noalias() = A_discr * A_discr;
+            A_discr = F_;
+        }
+    }
+
+private:
+    //! largest 1-norm for which the degree 7 Padé approximant is accurate to double precision
+    static SCALAR theta7() { return SCALAR(0.9504178996162932); }
+    //! coefficients of the degree 7 Padé approximant
+    static SCALAR b(int i)
+    {
+        static const double coefficients[] = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+        return SCALAR(coefficients[i]);
+    }
+
+    state_matrix_t F_;
+    state_control_matrix_t G_;
+    state_matrix_t F2_;
+    state_matrix_t F4_;
+    state_matrix_t F6_;
+    state_matrix_t W_;
+    state_matrix_t Z_;
+    state_matrix_t U11_;
+    state_matrix_t V11_;
+    state_control_matrix_t U12_;
+    Eigen::PartialPivLU<Eigen::Matrix<SCALAR, STATE_DIM, STATE_DIM>> lu_;
+};
+
+}  // namespace core
+}  // namespace ct
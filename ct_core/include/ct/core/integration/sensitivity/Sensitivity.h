@@ -21,12 +21,18 @@ struct SensitivityApproximationSettings
         MATRIX_EXPONENTIAL
     };
 
-    SensitivityApproximationSettings(double dt, APPROXIMATION approx) : dt_(dt), approximation_(approx) {}
+    SensitivityApproximationSettings(double dt, APPROXIMATION approx, bool timeInvariant = false)
+        : dt_(dt), approximation_(approx), timeInvariant_(timeInvariant)
+    {
+    }
     //! discretization time-step
     double dt_;
 
     //! type of discretization strategy used.
     APPROXIMATION approximation_;
+
+    //! the linear system is time-invariant, discretize it once and reuse the result for all stages
+    bool timeInvariant_;
 };
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = double>
@@ -53,6 +59,8 @@ public:
 
     //! update the approximation type for the discrete-time system
     virtual void setApproximation(const SensitivityApproximationSettings::APPROXIMATION& approx) {}
+    //! declare the linear system time-invariant, such that its discretization may be reused across stages
+    virtual void setTimeInvariant(bool timeInvariant) {}
     /*!
 	 * Set the trajectory reference for linearization. This should also include potential substeps that the integrator produces.
 	 * @param x
@@ -42,8 +42,9 @@ public:
     SensitivityApproximation(const SCALAR& dt,
         const std::shared_ptr<LinearSystem<STATE_DIM, CONTROL_DIM, SCALAR>>& linearSystem = nullptr,
         const SensitivityApproximationSettings::APPROXIMATION& approx =
-            SensitivityApproximationSettings::APPROXIMATION::FORWARD_EULER)
-        : linearSystem_(linearSystem), settings_(dt, approx)
+            SensitivityApproximationSettings::APPROXIMATION::FORWARD_EULER,
+        const bool timeInvariant = false)
+        : linearSystem_(linearSystem), settings_(dt, approx, timeInvariant), cacheValid_(false), memoValid_(false)
     {
     }
 
@@ -51,13 +52,22 @@ public:
     //! constructor
     SensitivityApproximation(const SensitivityApproximationSettings& settings,
         const std::shared_ptr<LinearSystem<STATE_DIM, CONTROL_DIM, SCALAR>>& linearSystem = nullptr)
-        : linearSystem_(linearSystem), settings_(settings)
+        : linearSystem_(linearSystem), settings_(settings), cacheValid_(false), memoValid_(false)
     {
     }
 
 
     //! copy constructor
-    SensitivityApproximation(const SensitivityApproximation& other) : settings_(other.settings_)
+    SensitivityApproximation(const SensitivityApproximation& other)
+        : settings_(other.settings_),
+          cacheValid_(other.cacheValid_),
+          A_cache_(other.A_cache_),
+          B_cache_(other.B_cache_),
+          memoValid_(other.memoValid_),
+          Ac_memo_(other.Ac_memo_),
+          Bc_memo_(other.Bc_memo_),
+          Ad_memo_(other.Ad_memo_),
+          Bd_memo_(other.Bd_memo_)
     {
         if (other.linearSystem_ != nullptr)
             linearSystem_ = std::shared_ptr<LinearSystem<STATE_DIM, CONTROL_DIM, SCALAR>>(other.linearSystem_->clone());
@@ -78,6 +88,8 @@ public:
     //! update the approximation type for the discrete-time system
     virtual void setApproximation(const SensitivityApproximationSettings::APPROXIMATION& approx) override
     {
+        if (approx != settings_.approximation_)
+            resetDiscretization();
         settings_.approximation_ = approx;
     }
 
@@ -89,13 +101,36 @@ public:
         const std::shared_ptr<LinearSystem<STATE_DIM, CONTROL_DIM, SCALAR>>& linearSystem) override
     {
         linearSystem_ = linearSystem;
+        resetDiscretization();
     }
 
 
     //! update the time discretization
-    virtual void setTimeDiscretization(const SCALAR& dt) override { settings_.dt_ = dt; }
+    virtual void setTimeDiscretization(const SCALAR& dt) override
+    {
+        if (dt != settings_.dt_)
+            resetDiscretization();
+        settings_.dt_ = dt;
+    }
     //! update the settings
-    void updateSettings(const SensitivityApproximationSettings& settings) { settings_ = settings; }
+    void updateSettings(const SensitivityApproximationSettings& settings)
+    {
+        settings_ = settings;
+        resetDiscretization();
+    }
+    //! declare the linear system time-invariant, such that it gets discretized only once
+    virtual void setTimeInvariant(bool timeInvariant) override
+    {
+        if (timeInvariant != settings_.timeInvariant_)
+            resetDiscretization();
+        settings_.timeInvariant_ = timeInvariant;
+    }
+    //! discard the cached discretization, needs to be called if the matrices of a time-invariant system are modified
+    void resetDiscretization()
+    {
+        cacheValid_ = false;
+        memoValid_ = false;
+    }
     //! get A and B matrix for linear time invariant system
     /*!
 	 * compute discrete-time linear system matrices A and B
@@ -119,7 +154,15 @@ public:
 
         /*!
 		 * for an LTI system A and B won't change with time n, hence the linearizations result from the following LTV special case.
+		 * If the system is declared time-invariant, that result is computed once and reused across stages and iterations.
 		 */
+        if (settings_.timeInvariant_ && cacheValid_)
+        {
+            A = A_cache_;
+            B = B_cache_;
+            return;
+        }
+
         switch (settings_.approximation_)
         {
             case SensitivityApproximationSettings::APPROXIMATION::FORWARD_EULER:
@@ -172,6 +215,13 @@ public:
             default:
                 throw std::runtime_error("Unknown Approximation type in SensitivityApproximation.");
         }  // end switch
+
+        if (settings_.timeInvariant_)
+        {
+            A_cache_ = A;
+            B_cache_ = B;
+            cacheValid_ = true;
+        }
     }
 
 
@@ -208,12 +258,17 @@ private:
         state_control_matrix_t B_cont;
         linearSystem_->getDerivatives(A_cont, B_cont, x_n, u_n, n * settings_.dt_);
 
+        if (recallDiscretization(A_cont, B_cont, A_discr, B_discr))
+            return;
+
         state_matrix_t aNew = settings_.dt_ * A_cont;
         A_discr.setZero();
         A_discr.template topLeftCorner<STATE_DIM, STATE_DIM>() =
             (state_matrix_t::Identity() - aNew).colPivHouseholderQr().inverse();
 
         B_discr = A_discr * settings_.dt_ * B_cont;
+
+        memorizeDiscretization(A_cont, B_cont, A_discr, B_discr);
     }
 
 
@@ -227,11 +282,41 @@ private:
         state_control_matrix_t Bc;
         linearSystem_->getDerivatives(Ac, Bc, x_n, u_n, n * settings_.dt_);
 
-        state_matrix_t Adt = settings_.dt_ * Ac;
+        if (recallDiscretization(Ac, Bc, A_discr, B_discr))
+            return;
 
-        A_discr.template topLeftCorner<STATE_DIM, STATE_DIM>() = Adt.exp();
-        B_discr.template topLeftCorner<STATE_DIM, CONTROL_DIM>() =
-            Ac.inverse() * (A_discr - state_matrix_t::Identity()) * Bc;
+        matrixExponential_.compute(Ac, Bc, settings_.dt_, A_discr, B_discr);
+
+        memorizeDiscretization(Ac, Bc, A_discr, B_discr);
+    }
+
+
+    //! returns the last discretization if it was computed for the same continuous-time matrices
+    bool recallDiscretization(const state_matrix_t& A_cont,
+        const state_control_matrix_t& B_cont,
+        state_matrix_t& A_discr,
+        state_control_matrix_t& B_discr) const
+    {
+        if (!memoValid_ || A_cont != Ac_memo_ || B_cont != Bc_memo_)
+            return false;
+
+        A_discr = Ad_memo_;
+        B_discr = Bd_memo_;
+        return true;
+    }
+
+
+    //! stores the discretization of the continuous-time matrices, comparing is cheap compared to discretizing
+    void memorizeDiscretization(const state_matrix_t& A_cont,
+        const state_control_matrix_t& B_cont,
+        const state_matrix_t& A_discr,
+        const state_control_matrix_t& B_discr)
+    {
+        Ac_memo_ = A_cont;
+        Bc_memo_ = B_cont;
+        Ad_memo_ = A_discr;
+        Bd_memo_ = B_discr;
+        memoValid_ = true;
     }
 
 
@@ -381,6 +466,21 @@ private:
 
     //! discretization settings
     SensitivityApproximationSettings settings_;
+
+    //! discretization of a time-invariant system
+    bool cacheValid_;
+    state_matrix_t A_cache_;
+    state_control_matrix_t B_cache_;
+
+    //! last discretization and the continuous-time matrices it was computed for
+    bool memoValid_;
+    state_matrix_t Ac_memo_;
+    state_control_matrix_t Bc_memo_;
+    state_matrix_t Ad_memo_;
+    state_control_matrix_t Bd_memo_;
+
+    //! workspace of the matrix exponential
+    AugmentedMatrixExponential<STATE_DIM, CONTROL_DIM, SCALAR> matrixExponential_;
 };
 
 
@@ -0,0 +1,85 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#ifdef CPPADCG
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ct {
+namespace core {
+namespace internal {
+
+/**
+ * @brief      Registry of the atomic functions called by just-in-time compiled code
+ *
+ * Code generated from a tape containing a CppAD::cg::CGAtomicFun does not contain the atomic function itself but
+ * calls the wrapped atomic function by name at runtime. Owners of such atomic functions register them here, and
+ * just-in-time compiled models hand the atomic functions they call to the loaded model with addTo().
+ *
+ * The registry does not own the atomic functions, the models keep the ones they call alive.
+ */
+template <typename BASE>
+class CGAtomicRegistry
+{
+public:
+    typedef std::shared_ptr<CppAD::atomic_base<BASE>> AtomicPtr;
+
+    static CGAtomicRegistry& getInstance()
+    {
+        static CGAtomicRegistry instance;
+        return instance;
+    }
+
+    //! registers an atomic function under its name, which needs to be unique
+    void add(const AtomicPtr& atomic)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        atomics_[atomic->afun_name()] = atomic;
+    }
+
+    /**
+     * @brief      adds all atomic functions called by a model to the model
+     *
+     * @param      model  the loaded model
+     *
+     * @return     the atomic functions called by the model, to be kept alive as long as the model
+     */
+    std::vector<AtomicPtr> addTo(CppAD::cg::GenericModel<BASE>& model)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<AtomicPtr> called;
+        for (const std::string& name : model.getAtomicFunctionNames())
+        {
+            auto it = atomics_.find(name);
+            AtomicPtr atomic = it == atomics_.end() ? nullptr : it->second.lock();
+            if (!atomic)
+                throw std::runtime_error("CGAtomicRegistry: atomic function " + name + " is not registered.");
+
+            model.addAtomicFunction(*atomic);
+            called.push_back(atomic);
+        }
+        return called;
+    }
+
+private:
+    CGAtomicRegistry() = default;
+
+    std::mutex mutex_;
+    std::map<std::string, std::weak_ptr<CppAD::atomic_base<BASE>>> atomics_;
+};
+
+}  // namespace internal
+}  // namespace core
+}  // namespace ct
+
+#endif
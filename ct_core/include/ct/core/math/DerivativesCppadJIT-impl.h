@@ -36,31 +36,38 @@ DerivativesCppadJIT<IN_DIM, OUT_DIM>::DerivativesCppadJIT(const DerivativesCppad
       outputDim_(arg.outputDim_),
       compiled_(arg.compiled_),
       libName_(arg.libName_),
-      dynamicLib_(nullptr)
+      sparsityRowsJacobian_(arg.sparsityRowsJacobian_),
+      sparsityColsJacobian_(arg.sparsityColsJacobian_),
+      sparsityRowsHessian_(arg.sparsityRowsHessian_),
+      sparsityColsHessian_(arg.sparsityColsHessian_),
+      sparsityRowsJacobianEigen_(arg.sparsityRowsJacobianEigen_),
+      sparsityColsJacobianEigen_(arg.sparsityColsJacobianEigen_),
+      sparsityRowsHessianEigen_(arg.sparsityRowsHessianEigen_),
+      sparsityColsHessianEigen_(arg.sparsityColsHessianEigen_),
+      dynamicLib_(arg.dynamicLib_)
 #ifdef LLVM_VERSION_MAJOR
       ,
-      llvmModelLib_(nullptr)
+      llvmModelLib_(arg.llvmModelLib_)
 #endif
 {
-    cgCppadFun_ = arg.cgCppadFun_;
-    if (compiled_)
+    if (!compiled_)
     {
-        if (arg.dynamicLib_)  // in case of dynamic libraries
-        {
-            dynamicLib_ = internal::CGHelpers::loadDynamicLibCppad<double>(libName_);
-            model_ = std::shared_ptr<CppAD::cg::GenericModel<double>>(dynamicLib_->model(libName_));
-        }
+        // the operation sequence is only required for compiling
+        cgCppadFun_ = arg.cgCppadFun_;
+        return;
+    }
+
+    // the compiled library is shared, only the model with its evaluation buffers is instantiated per clone
+    if (dynamicLib_)
+        model_ = std::shared_ptr<CppAD::cg::GenericModel<double>>(dynamicLib_->model(libName_));
 #ifdef LLVM_VERSION_MAJOR
-        else if (arg.llvmModelLib_)  // in case of regular JIT without dynamic lib
-        {
-            throw std::runtime_error("DerivativesCppadJIT: cloning of LLVM-JIT libraries is currently not supported.");
-            llvmModelLib_ = arg.llvmModelLib_;  // TODO: this is not clean, we need to properly clone the llvm model lib
-            model_ = std::shared_ptr<CppAD::cg::GenericModel<double>>(llvmModelLib_->model(libName_));
-        }
+    else if (llvmModelLib_)
+        model_ = std::shared_ptr<CppAD::cg::GenericModel<double>>(llvmModelLib_->model(libName_));
 #endif
-        else
-            throw std::runtime_error("DerivativesCppadJIT: undefined behaviour in copy constructor.");
-    }
+    else
+        throw std::runtime_error("DerivativesCppadJIT: undefined behaviour in copy constructor.");
+
+    atomics_ = internal::CGAtomicRegistry<double>::getInstance().addTo(*model_);
 }
 
 template <int IN_DIM, int OUT_DIM>
@@ -74,8 +81,12 @@ void DerivativesCppadJIT<IN_DIM, OUT_DIM>::update(FUN_TYPE_CG& f, const size_t i
         recordCg();
         compiled_ = false;
         libName_ = "";
-        dynamicLib_ = nullptr;
         model_ = nullptr;
+        atomics_.clear();
+        dynamicLib_ = nullptr;
+#ifdef LLVM_VERSION_MAJOR
+        llvmModelLib_ = nullptr;
+#endif
     }
 }
 
@@ -88,6 +99,8 @@ auto DerivativesCppadJIT<IN_DIM, OUT_DIM>::clone() const -> DerivativesCppadJIT*
 template <int IN_DIM, int OUT_DIM>
 auto DerivativesCppadJIT<IN_DIM, OUT_DIM>::forwardZero(const Eigen::VectorXd& x) -> OUT_TYPE_D
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::forwardZero");
+
     if (compiled_)
     {
         assert(model_->isForwardZeroAvailable() == true);
@@ -102,6 +115,8 @@ auto DerivativesCppadJIT<IN_DIM, OUT_DIM>::forwardZero(const Eigen::VectorXd& x)
 template <int IN_DIM, int OUT_DIM>
 auto DerivativesCppadJIT<IN_DIM, OUT_DIM>::jacobian(const Eigen::VectorXd& x) -> JAC_TYPE_D
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::jacobian");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -125,6 +140,8 @@ void DerivativesCppadJIT<IN_DIM, OUT_DIM>::sparseJacobian(const Eigen::VectorXd&
     Eigen::VectorXi& iRow,
     Eigen::VectorXi& jCol)
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::sparseJacobian");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -145,6 +162,8 @@ void DerivativesCppadJIT<IN_DIM, OUT_DIM>::sparseJacobian(const Eigen::VectorXd&
 template <int IN_DIM, int OUT_DIM>
 Eigen::VectorXd DerivativesCppadJIT<IN_DIM, OUT_DIM>::sparseJacobianValues(const Eigen::VectorXd& x)
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::sparseJacobianValues");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -164,6 +183,8 @@ template <int IN_DIM, int OUT_DIM>
 auto DerivativesCppadJIT<IN_DIM, OUT_DIM>::hessian(const Eigen::VectorXd& x, const Eigen::VectorXd& lambda)
     -> HES_TYPE_D
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::hessian");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -188,6 +209,8 @@ void DerivativesCppadJIT<IN_DIM, OUT_DIM>::sparseHessian(const Eigen::VectorXd&
     Eigen::VectorXi& iRow,
     Eigen::VectorXi& jCol)
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::sparseHessian");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -210,6 +233,8 @@ template <int IN_DIM, int OUT_DIM>
 Eigen::VectorXd DerivativesCppadJIT<IN_DIM, OUT_DIM>::sparseHessianValues(const Eigen::VectorXd& x,
     const Eigen::VectorXd& lambda)
 {
+    CT_PROFILE_SCOPE("DerivativesCppadJIT::sparseHessianValues");
+
     if (outputDim_ <= 0)
         throw std::runtime_error("Outdim dim smaller 0; Define output dim in DerivativesCppad constructor");
 
@@ -372,6 +397,9 @@ void DerivativesCppadJIT<IN_DIM, OUT_DIM>::compileJIT(const DerivativesCppadSett
 #endif
     }
 
+    // the generated code calls atomic functions, e.g. of terrains, by name
+    atomics_ = internal::CGAtomicRegistry<double>::getInstance().addTo(*model_);
+
 
     if (settings.generateSourceCode_)
     {
@@ -7,8 +7,10 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #ifdef CPPADCG
 
+#include <ct/core/common/Profiler.h>
 #include <ct/core/types/AutoDiff.h>
 #include <ct/core/internal/autodiff/CGHelpers.h>
+#include <ct/core/internal/autodiff/CGAtomicRegistry.h>
 #include <ct/core/math/Derivatives.h>
 #include <ct/core/math/DerivativesCppadSettings.h>
 
@@ -72,7 +74,10 @@ public:
     /*!
      * @brief copy constructor
      * @param arg instance to copy
-     * @note  It is  important to not only copy the pointer to the dynamic library, but to load the library properly instead.
+     * @note  The compiled library (dynamic or LLVM in-memory) is shared with the copy, which only instantiates its own
+     *        model, holding the buffers for evaluation. Copies can thus be evaluated in
+     *        parallel, while copying is cheap and does not reload the library. Copies should be created and destroyed
+     *        from one thread, as the library keeps track of its models.
      */
     DerivativesCppadJIT(const DerivativesCppadJIT& arg);
 
@@ -209,11 +214,12 @@ protected:
     //!
     CppAD::cg::GccCompiler<double> compiler_;  //! compile for codegeneration
     CppAD::cg::ClangCompiler<double> compilerClang_;
-    std::shared_ptr<CppAD::cg::DynamicLib<double>> dynamicLib_;          //! dynamic library to load after compilation
-    std::shared_ptr<CppAD::cg::GenericModel<double>> model_;             //! the model
+    std::shared_ptr<CppAD::cg::DynamicLib<double>> dynamicLib_;          //! dynamic library, shared among copies
 #ifdef LLVM_VERSION_MAJOR
-    std::shared_ptr<CppAD::cg::LlvmModelLibrary<double>> llvmModelLib_;  //! llvm in-memory library
+    std::shared_ptr<CppAD::cg::LlvmModelLibrary<double>> llvmModelLib_;  //! llvm in-memory library, shared among copies
 #endif
+    std::vector<std::shared_ptr<CppAD::atomic_base<double>>> atomics_;  //! atomic functions called by the model
+    std::shared_ptr<CppAD::cg::GenericModel<double>> model_;             //! the model, destroyed before the library
 };
 
 
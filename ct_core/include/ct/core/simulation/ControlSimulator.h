@@ -6,12 +6,15 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #pragma once
 
 #include <atomic>
+#include <cmath>
 #include <chrono>
 #include <thread>
 #include <memory>
+#include <mutex>
 
 #include <ct/core/types/Time.h>
 #include <ct/core/types/StateVector.h>
+#include <ct/core/types/arrays/MatrixArrays.h>
 #include <ct/core/integration/Integrator.h>
 #include <ct/core/control/continuous_time/Controller.h>
 
@@ -34,7 +37,8 @@ public:
     static const size_t STATE_DIM = CONTROLLED_SYSTEM::STATE_DIM;
     static const size_t CONTROL_DIM = CONTROLLED_SYSTEM::CONTROL_DIM;
 
-    using SCALAR = typename CONTROLLED_SYSTEM::SCALAR;
+    //! the scalar type of the system, every System defines its time type accordingly
+    using SCALAR = typename CONTROLLED_SYSTEM::time_t;
 
     //! default constructor
     ControlSimulator() = default;
@@ -55,11 +59,16 @@ public:
 
     //! copy constructor
     ControlSimulator(const ControlSimulator& arg)
-        : sim_dt_(arg.sim_dt_), control_dt_(arg.control_dt_), x0_(arg.x0_), stop_(arg.stop_)
+        : sim_dt_(arg.sim_dt_),
+          control_dt_(arg.control_dt_),
+          x0_(arg.x0_),
+          x_(arg.x0_),
+          stop_(arg.stop_.load()),
+          verbose_(arg.verbose_)
     {
         if (!arg.system_)
             return;
-        system_ = std::shared_ptr<Controller<STATE_DIM, CONTROL_DIM, SCALAR>>(arg.system_->clone());
+        system_ = std::shared_ptr<CONTROLLED_SYSTEM>(static_cast<CONTROLLED_SYSTEM*>(arg.system_->clone()));
         if (arg.controller_)
         {
             controller_ = std::shared_ptr<Controller<STATE_DIM, CONTROL_DIM, SCALAR>>(arg.controller_->clone());
@@ -85,6 +94,74 @@ public:
         control_thread_ = std::thread(&ControlSimulator::simulateController, this, duration);
     }
 
+    //! runs the simulation in simulated time, blocks until it is finished
+    /*!
+     * In contrast to simulate(), no threads are spawned and no wall-clock pacing takes place. The controller and the
+     * system are stepped in lockstep as fast as possible: at every control step, the controller hooks get called
+     * with the current simulated time, then the system is integrated over one control interval and
+     * finishSystemIteration() gets called. The result is deterministic and independent of the machine load.
+     *
+     * @param duration simulated time span
+     * @param intType integration type
+     * @param stateLog optional output, gets resized once and filled with the states at all control steps
+     */
+    void simulateLockstep(Time duration,
+        const IntegrationType& intType = IntegrationType::EULERCT,
+        StateVectorArray<STATE_DIM>* stateLog = nullptr)
+    {
+        stop_ = false;
+        x_ = x0_;
+
+        Integrator<STATE_DIM> integrator(system_, intType);
+        StateVector<STATE_DIM> temp_x = x_;
+
+        const int nSimSteps = int(control_dt_ / sim_dt_);
+        const double residue = control_dt_ / sim_dt_ - nSimSteps;
+        const size_t nControlSteps = static_cast<size_t>(std::ceil(duration / control_dt_ - 1e-9));
+
+        if (stateLog)
+        {
+            stateLog->resize(nControlSteps + 1);
+            (*stateLog)[0] = x_;
+        }
+
+        size_t k = 0;
+        for (; k < nControlSteps && !stop_; k++)
+        {
+            Time sim_time = k * control_dt_;
+
+            prepareControllerIteration(sim_time);
+            finishControllerIteration(sim_time);
+
+            integrator.integrate_n_steps(temp_x, sim_time, nSimSteps, sim_dt_);
+            if (residue > 1e-6)
+                integrator.integrate_n_steps(temp_x, sim_time + nSimSteps * sim_dt_, 1, residue * sim_dt_);
+
+            state_mtx_.lock();
+            x_ = temp_x;
+            state_mtx_.unlock();
+
+            if (stateLog)
+                (*stateLog)[k + 1] = temp_x;
+
+            finishSystemIteration((k + 1) * control_dt_);
+        }
+
+        // in case the simulation was stopped early
+        if (stateLog)
+            stateLog->resize(k + 1);
+    }
+
+    //! the most recent simulated state
+    StateVector<STATE_DIM> getState()
+    {
+        std::lock_guard<std::mutex> lock(state_mtx_);
+        return x_;
+    }
+
+    //! the controlled system which is simulated
+    std::shared_ptr<CONTROLLED_SYSTEM> getSystem() { return system_; }
+
     //! waits for the simulation threads to finish
     void finish()
     {
@@ -115,7 +192,8 @@ protected:
             {
                 integrator.integrate_n_steps(temp_x, sim_time, int(control_dt_ / sim_dt_), sim_dt_);
                 if (residue > 1e-6)
-                    integrator.integrate_n_steps(temp_x, sim_time + int(control_dt_ / sim_dt_) * sim_dt_, 1, residue);
+                    integrator.integrate_n_steps(
+                        temp_x, sim_time + int(control_dt_ / sim_dt_) * sim_dt_, 1, residue * sim_dt_);
 
                 if (std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - wall_time).count() >=
                     control_dt_)
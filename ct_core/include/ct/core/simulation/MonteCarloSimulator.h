@@ -0,0 +1,161 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ct/core/common/GaussianNoise.h>
+#include "ControlSimulator.h"
+
+namespace ct {
+namespace core {
+
+//! Runs batches of independent closed-loop simulations in simulated time
+/*!
+ * Every scenario is simulated with ControlSimulator::simulateLockstep() on its own deep copy of the controlled
+ * system (and therefore its own copy of the controller). Scenarios are distributed over a pool of worker threads.
+ * Each scenario owns a GaussianNoise generator seeded with the scenario seed, which the optional setup callback can
+ * use to perturb the initial state or the system parameters. Its bulk functions fill() and noisify() generate the
+ * noise of whole vectors or trajectories at once. Since all randomness flows from the seeds and the
+ * simulation is performed in simulated time, results are reproducible and independent of the number of threads.
+ *
+ * @tparam CONTROLLED_SYSTEM the controlled system that we wish to simulate
+ */
+template <class CONTROLLED_SYSTEM>
+class MonteCarloSimulator
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t STATE_DIM = CONTROLLED_SYSTEM::STATE_DIM;
+    static const size_t CONTROL_DIM = CONTROLLED_SYSTEM::CONTROL_DIM;
+
+    //! definition of a single scenario
+    struct Scenario
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        StateVector<STATE_DIM> x0;  //!< nominal initial state
+        unsigned int seed;          //!< seed for the scenario noise generator
+    };
+    using ScenarioArray = std::vector<Scenario, Eigen::aligned_allocator<Scenario>>;
+
+    //! optional per-scenario setup, may modify the initial state and the (cloned) system
+    /*!
+     * Gets called from the worker threads, hence must only touch the provided arguments.
+     * Arguments: scenario index, initial state, system clone, noise generator of the scenario
+     */
+    using ScenarioSetup = std::function<void(size_t, StateVector<STATE_DIM>&, CONTROLLED_SYSTEM&, GaussianNoise&)>;
+
+    //! constructor
+    /*!
+     * @param sim_dt integration step size
+     * @param control_dt controller update interval
+     * @param system the nominal controlled system, including its controller, which gets cloned for every scenario
+     * @param nThreads number of worker threads
+     */
+    MonteCarloSimulator(Time sim_dt, Time control_dt, std::shared_ptr<CONTROLLED_SYSTEM> system, size_t nThreads = 1)
+        : sim_dt_(sim_dt), control_dt_(control_dt), system_(system), nThreads_(std::max(nThreads, size_t(1)))
+    {
+        if (!system_)
+            throw std::runtime_error("MonteCarloSimulator: system must not be empty.");
+        if (sim_dt_ <= 0 || control_dt_ <= 0)
+            throw std::runtime_error("Step sizes must be positive.");
+        if (sim_dt_ > control_dt_)
+            throw std::runtime_error("Simulation step must be smaller than the control step.");
+    }
+
+    //! simulate all scenarios, blocks until all of them are finished
+    /*!
+     * @param scenarios the scenarios to simulate
+     * @param duration simulated time span per scenario
+     * @param stateLogs output, resized to the number of scenarios. Entry i holds the states of scenario i
+     * 	at all control steps. Existing storage is reused, such that repeated batches do not reallocate.
+     * @param setup optional per-scenario setup
+     * @param intType integration type
+     */
+    void simulate(const ScenarioArray& scenarios,
+        Time duration,
+        std::vector<StateVectorArray<STATE_DIM>>& stateLogs,
+        const ScenarioSetup& setup = nullptr,
+        const IntegrationType& intType = IntegrationType::EULERCT)
+    {
+        stateLogs.resize(scenarios.size());
+
+        std::atomic<size_t> nextScenario(0);
+        std::exception_ptr error = nullptr;
+        std::mutex errorMutex;
+
+        auto worker = [&]() {
+            size_t i;
+            while ((i = nextScenario++) < scenarios.size())
+            {
+                try
+                {
+                    simulateScenario(i, scenarios[i], duration, stateLogs[i], setup, intType);
+                } catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error)
+                        error = std::current_exception();
+                    nextScenario = scenarios.size();
+                }
+            }
+        };
+
+        const size_t nWorkers = std::min(nThreads_, scenarios.size());
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < nWorkers; t++)
+            threads.emplace_back(worker);
+
+        // the calling thread participates as well
+        worker();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    //! set the number of worker threads
+    void setNumThreads(size_t nThreads) { nThreads_ = std::max(nThreads, size_t(1)); }
+
+private:
+    void simulateScenario(size_t i,
+        const Scenario& scenario,
+        Time duration,
+        StateVectorArray<STATE_DIM>& stateLog,
+        const ScenarioSetup& setup,
+        const IntegrationType& intType)
+    {
+        // the clone deep-copies the controller as well
+        std::shared_ptr<CONTROLLED_SYSTEM> system(static_cast<CONTROLLED_SYSTEM*>(system_->clone()));
+
+        StateVector<STATE_DIM> x0 = scenario.x0;
+        GaussianNoise noise(0.0, 1.0, scenario.seed);
+
+        if (setup)
+            setup(i, x0, *system, noise);
+
+        ControlSimulator<CONTROLLED_SYSTEM> simulator(sim_dt_, control_dt_, x0, system);
+        simulator.simulateLockstep(duration, intType, &stateLog);
+    }
+
+    Time sim_dt_;
+    Time control_dt_;
+    std::shared_ptr<CONTROLLED_SYSTEM> system_;
+    size_t nThreads_;
+};
+
+}  // namespace core
+}  // namespace ct
@@ -5,6 +5,9 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 namespace ct {
 namespace core {
 //! Declaring Switched alias such that we can write Switched<System>
@@ -80,6 +83,13 @@ public:
     {
         return getSwitchEventFromIdx(getIdxFromTime(time));
     }
+    /// @brief get the switching times, i.e. all phase boundaries except the start and end time
+    TimeSchedule_t getSwitchingTimes() const
+    {
+        if (time_schedule_.size() < 3)
+            return TimeSchedule_t();
+        return TimeSchedule_t(time_schedule_.begin() + 1, time_schedule_.end() - 1);
+    }
     /// @brief get sequence index from time
     std::size_t getIdxFromTime(Time time) const
     {
@@ -106,6 +116,29 @@ private:
     TimeSchedule_t time_schedule_;
 };
 
+//! Interface for systems whose dynamics switch between modes at prespecified times
+/*!
+ * The Integrator detects systems implementing this interface. It splits the integration at the switching times and
+ * fixes the active mode within each segment, such that the mode does not need to be looked up in every evaluation
+ * of the dynamics.
+ *
+ * @tparam Time the time type
+ */
+template <typename Time>
+class SwitchingSchedule
+{
+public:
+    virtual ~SwitchingSchedule() {}
+    //! the times at which the active mode changes, in ascending order
+    virtual const std::vector<Time>& getSwitchingTimes() const = 0;
+
+    //! fixes the active mode to the mode active at time t until releaseMode() is called
+    virtual void fixModeAtTime(const Time& t) = 0;
+
+    //! the active mode is looked up from the time again
+    virtual void releaseMode() = 0;
+};
+
 using ContinuousModeSequence = PhaseSequence<std::size_t, double>;
 using ContinuousModeSwitch = SwitchEvent<std::size_t, double>;
 
@@ -33,14 +33,16 @@ namespace core {
  *  \dot{x} = f(x(t),u(x,t),t) = g(x,t)
  * \f]
  *
- * which can be forward propagated in time with an Integrator.
+ * which can be forward propagated in time with an Integrator. The Integrator splits the integration at the switching
+ * times and fixes the active mode within each segment, see SwitchingSchedule.
  *
  * @tparam STATE_DIM dimension of state vector
  * @tparam CONTROL_DIM dimension of input vector
  * @tparam SCALAR scalar type
  */
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = double>
-class SwitchedControlledSystem : public ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>
+class SwitchedControlledSystem : public ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>,
+                                 public SwitchingSchedule<SCALAR>
 {
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -62,7 +64,12 @@ public:
         const SYSTEM_TYPE& type = SYSTEM_TYPE::GENERAL)
         : ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(type),
           switchedSystems_(switchedSystems),
-          continuousModeSequence_(continuousModeSequence){};
+          continuousModeSequence_(continuousModeSequence),
+          modeFixed_(false),
+          fixedMode_(0)
+    {
+        setupSwitchingTimes();
+    };
 
     //! constructor
     /*!
@@ -76,11 +83,20 @@ public:
         const SYSTEM_TYPE& type = SYSTEM_TYPE::GENERAL)
         : ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(controller, type),
           switchedSystems_(switchedSystems),
-          continuousModeSequence_(continuousModeSequence){};
+          continuousModeSequence_(continuousModeSequence),
+          modeFixed_(false),
+          fixedMode_(0)
+    {
+        setupSwitchingTimes();
+    };
 
     //! copy constructor
     SwitchedControlledSystem(const SwitchedControlledSystem& arg)
-        : ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(arg), continuousModeSequence_(arg.continuousModeSequence_)
+        : ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(arg),
+          continuousModeSequence_(arg.continuousModeSequence_),
+          switchingTimes_(arg.switchingTimes_),
+          modeFixed_(false),
+          fixedMode_(0)
     {
         switchedSystems_.clear();
         for (auto& subSystem : arg.switchedSystems_)
@@ -103,13 +119,32 @@ public:
         const ControlVector<CONTROL_DIM, SCALAR>& control,
         StateVector<STATE_DIM, SCALAR>& derivative) override
     {
-        auto mode = continuousModeSequence_.getPhaseFromTime(t);
+        auto mode = modeFixed_ ? fixedMode_ : continuousModeSequence_.getPhaseFromTime(t);
         switchedSystems_[mode]->computeControlledDynamics(state, t, control, derivative);
     };
 
+    const std::vector<SCALAR>& getSwitchingTimes() const override { return switchingTimes_; }
+    void fixModeAtTime(const SCALAR& t) override
+    {
+        fixedMode_ = continuousModeSequence_.getPhaseFromTime(t);
+        modeFixed_ = true;
+    }
+
+    void releaseMode() override { modeFixed_ = false; }
+
 protected:
+    void setupSwitchingTimes()
+    {
+        switchingTimes_.clear();
+        for (const auto& switchingTime : continuousModeSequence_.getSwitchingTimes())
+            switchingTimes_.push_back(SCALAR(switchingTime));
+    }
+
     SwitchedSystems switchedSystems_;                //!< switched system container
     ContinuousModeSequence continuousModeSequence_;  //!< the prespecified mode sequence
+    std::vector<SCALAR> switchingTimes_;             //!< the switching times of the mode sequence
+    bool modeFixed_;                                 //!< true if the mode is fixed by the integrator
+    std::size_t fixedMode_;                          //!< the fixed mode
 };
 }
 }
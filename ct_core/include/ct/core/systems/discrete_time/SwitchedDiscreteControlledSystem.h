@@ -34,14 +34,16 @@ namespace core {
  *  x_{n+1} = f(x_n,u_n(x_n,n),n) = g(x_n,n)
  * \f]
  *
- * which can be forward propagated directly.
+ * which can be forward propagated directly. Callers propagating several steps within one mode can fix the mode
+ * through the SwitchingSchedule interface, such that it is not looked up in every step.
  *
  * @tparam STATE_DIM dimension of state vector
  * @tparam CONTROL_DIM dimension of input vector
  * @tparam SCALAR scalar type
  */
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = double>
-class SwitchedDiscreteControlledSystem : public DiscreteControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>
+class SwitchedDiscreteControlledSystem : public DiscreteControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>,
+                                         public SwitchingSchedule<int>
 {
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -65,7 +67,10 @@ public:
         const SYSTEM_TYPE& type = SYSTEM_TYPE::GENERAL)
         : DiscreteControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(type),
           switchedSystems_(switchedSystems),
-          discreteModeSequence_(discreteModeSequence){};
+          discreteModeSequence_(discreteModeSequence),
+          switchingTimes_(discreteModeSequence.getSwitchingTimes()),
+          modeFixed_(false),
+          fixedMode_(0){};
 
     //! constructor
     /*!
@@ -79,12 +84,18 @@ public:
         const SYSTEM_TYPE& type = SYSTEM_TYPE::GENERAL)
         : DiscreteControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(controller, type),
           switchedSystems_(switchedSystems),
-          discreteModeSequence_(discreteModeSequence){};
+          discreteModeSequence_(discreteModeSequence),
+          switchingTimes_(discreteModeSequence.getSwitchingTimes()),
+          modeFixed_(false),
+          fixedMode_(0){};
 
     //! copy constructor
     SwitchedDiscreteControlledSystem(const SwitchedDiscreteControlledSystem& arg)
         : DiscreteControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>(arg),
-          discreteModeSequence_(arg.discreteModeSequence_)
+          discreteModeSequence_(arg.discreteModeSequence_),
+          switchingTimes_(arg.switchingTimes_),
+          modeFixed_(false),
+          fixedMode_(0)
     {
         switchedSystems_.clear();
         for (auto& subSystem : arg.switchedSystems_)
@@ -115,13 +126,26 @@ public:
         const control_vector_t& control,
         state_vector_t& stateNext) override
     {
-        auto mode = discreteModeSequence_.getPhaseFromTime(n);
+        auto mode = modeFixed_ ? fixedMode_ : discreteModeSequence_.getPhaseFromTime(n);
         switchedSystems_[mode]->propagateControlledDynamics(state, n, control, stateNext);
     };
 
+    //! the time indices at which the mode changes
+    const std::vector<int>& getSwitchingTimes() const override { return switchingTimes_; }
+    void fixModeAtTime(const int& n) override
+    {
+        fixedMode_ = discreteModeSequence_.getPhaseFromTime(n);
+        modeFixed_ = true;
+    }
+
+    void releaseMode() override { modeFixed_ = false; }
+
 protected:
     SwitchedSystems switchedSystems_;            //!< switched system container
     DiscreteModeSequence discreteModeSequence_;  //!< the prespecified mode sequence
+    std::vector<int> switchingTimes_;            //!< the switching time indices of the mode sequence
+    bool modeFixed_;                             //!< true if the mode is fixed by the caller
+    std::size_t fixedMode_;                      //!< the fixed mode
 };
 }  // namespace core
 }  // namespace ct
@@ -17,7 +17,8 @@ namespace core {
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR>
 SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::SystemDiscretizer()
-    : cont_constant_controller_(new ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>())
+    : splitAtSwitchingTimes_(false),
+      cont_constant_controller_(new ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>())
 {
 }
 
@@ -28,6 +29,7 @@ SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::SystemDiscretiz
     : dt_(dt),
       K_sim_(K_sim),
       integratorType_(integratorType),
+      splitAtSwitchingTimes_(false),
       cont_constant_controller_(new ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>())
 
 {
@@ -42,6 +44,7 @@ SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::SystemDiscretiz
     : dt_(dt),
       K_sim_(K_sim),
       integratorType_(integratorType),
+      splitAtSwitchingTimes_(false),
       cont_constant_controller_(new ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>())
 
 {
@@ -56,7 +59,11 @@ SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::~SystemDiscreti
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR>
 SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::SystemDiscretizer(const SystemDiscretizer& arg)
-    : dt_(arg.dt_), K_sim_(arg.K_sim_), dt_sim_(arg.dt_sim_), integratorType_(arg.integratorType_)
+    : dt_(arg.dt_),
+      K_sim_(arg.K_sim_),
+      dt_sim_(arg.dt_sim_),
+      integratorType_(arg.integratorType_),
+      splitAtSwitchingTimes_(arg.splitAtSwitchingTimes_)
 {
     changeContinuousTimeSystem(ContinuousSystemPtr(cont_time_system_->clone()));
 }
@@ -92,6 +99,16 @@ void SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::setParamet
 }
 
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR>
+void SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::setSplitAtSwitchingTimes(
+    bool splitAtSwitchingTimes)
+{
+    splitAtSwitchingTimes_ = splitAtSwitchingTimes;
+    if (integrator_)
+        integrator_->setSplitFixedSteps(splitAtSwitchingTimes_);
+}
+
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR>
 void SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::initialize()
 {
@@ -102,6 +119,7 @@ void SystemDiscretizer<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::initialize
     {
         integrator_ = std::shared_ptr<ct::core::Integrator<STATE_DIM, SCALAR>>(
             new ct::core::Integrator<STATE_DIM, SCALAR>(cont_time_system_, integratorType_, substepRecorder_));
+        integrator_->setSplitFixedSteps(splitAtSwitchingTimes_);
     }
     initializeSymplecticIntegrator<V_DIM, P_DIM, STATE_DIM>();
 }
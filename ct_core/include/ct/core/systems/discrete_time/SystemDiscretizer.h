@@ -108,6 +108,15 @@ public:
     //! update parameters
     void setParameters(const SCALAR& dt, const int& K_sim = 1);
 
+    //! split the simulation substeps at the switching times of a switched system (disabled by default)
+    /*!
+     * Substeps which contain no switch are always integrated with a fixed mode. By default, a substep containing a
+     * switch is integrated as one step with the mode looked up in every evaluation, because the SensitivityIntegrator
+     * differentiates K_sim equally long substeps. Splitting integrates exactly up to the switch and is suited if the
+     * sensitivities are approximated instead, see SensitivityApproximation.
+     */
+    void setSplitAtSwitchingTimes(bool splitAtSwitchingTimes);
+
     //! update the SystemDiscretizer with a new nonlinear, continuous-time system
     void changeContinuousTimeSystem(ContinuousSystemPtr newSystem);
 
@@ -165,6 +174,9 @@ protected:
     //! the integration type for forward integration
     ct::core::IntegrationType integratorType_;
 
+    //! true if the simulation substeps get split at the switching times of the system
+    bool splitAtSwitchingTimes_;
+
     //! the continuous-time system to be discretized
     ContinuousSystemPtr cont_time_system_;
 
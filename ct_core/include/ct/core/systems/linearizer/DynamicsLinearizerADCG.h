@@ -9,6 +9,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #include "DynamicsLinearizerADBase.h"
 #include <ct/core/internal/autodiff/CGHelpers.h>
+#include <ct/core/internal/autodiff/CGAtomicRegistry.h>
 
 namespace ct {
 namespace core {
@@ -65,8 +66,11 @@ public:
     }
 
     //! copy constructor
+    /*!
+     * The compiled library is shared with the copy, which only instantiates its own model for evaluation.
+     */
     DynamicsLinearizerADCG(const DynamicsLinearizerADCG& rhs)
-        : Base(rhs.dynamics_fct_),
+        : Base(rhs),
           dynamics_fct_(rhs.dynamics_fct_),
           dFdx_(rhs.dFdx_),
           dFdu_(rhs.dFdu_),
@@ -75,14 +79,15 @@ public:
           jitLibName_(rhs.jitLibName_),
           compiled_(rhs.compiled_),
           cacheJac_(rhs.cacheJac_),
+          dynamicLib_(rhs.dynamicLib_),
           maxTempVarCountState_(rhs.maxTempVarCountState_),
           maxTempVarCountControl_(rhs.maxTempVarCountControl_)
     {
         if (compiled_)
         {
-            dynamicLib_ = internal::CGHelpers::loadDynamicLibCppad<OUT_SCALAR>(jitLibName_);
             model_ = std::shared_ptr<CppAD::cg::GenericModel<OUT_SCALAR>>(
                 dynamicLib_->model("DynamicsLinearizerADCG" + jitLibName_));
+            atomics_ = internal::CGAtomicRegistry<OUT_SCALAR>::getInstance().addTo(*model_);
         }
     }
 
@@ -172,6 +177,7 @@ public:
 
         model_ = std::shared_ptr<CppAD::cg::GenericModel<OUT_SCALAR>>(
             dynamicLib_->model("DynamicsLinearizerADCG" + jitLibName_));
+        atomics_ = internal::CGAtomicRegistry<OUT_SCALAR>::getInstance().addTo(*model_);
 
         compiled_ = true;
 
@@ -257,8 +263,9 @@ protected:
     bool cacheJac_;                                //!< flag if Jacobian will be cached
     CppAD::cg::GccCompiler<OUT_SCALAR> compiler_;  //!< compiler instance for JIT compilation
 
-    std::shared_ptr<CppAD::cg::DynamicLib<OUT_SCALAR>> dynamicLib_;  //!< compiled and dynamically loaded library
-    std::shared_ptr<CppAD::cg::GenericModel<OUT_SCALAR>> model_;     //!< Auto-Diff model
+    std::shared_ptr<CppAD::cg::DynamicLib<OUT_SCALAR>> dynamicLib_;         //!< compiled library, shared among copies
+    std::vector<std::shared_ptr<CppAD::atomic_base<OUT_SCALAR>>> atomics_;  //!< atomic functions called by the model
+    std::shared_ptr<CppAD::cg::GenericModel<OUT_SCALAR>> model_;             //!< Auto-Diff model
 
     size_t maxTempVarCountState_;    //!< number of temporary variables in the source code of the state Jacobian
     size_t maxTempVarCountControl_;  //!< number of temporary variables in the source code of the input Jacobian
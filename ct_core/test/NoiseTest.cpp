@@ -56,6 +56,101 @@ TEST(NoiseTest, gaussianNoiseTest)
 }
 
 
+TEST(NoiseTest, philoxTest)
+{
+    // known answers of Philox4x32-10, see Salmon et al. (2011)
+    uint32_t block[4];
+    Philox4x32(0, 0).generateBlock(0, block);
+    ASSERT_EQ(block[0], 0x6627e8d5u);
+    ASSERT_EQ(block[3], 0x9b00dbd8u);
+    Philox4x32(0x299f31d0a4093822ull, 0x0370734413198a2eull).generateBlock(0x85a308d3243f6a88ull, block);
+    ASSERT_EQ(block[0], 0xd16cfe09u);
+    ASSERT_EQ(block[1], 0x94fdccebu);
+    ASSERT_EQ(block[2], 0x5001e420u);
+    ASSERT_EQ(block[3], 0x24126ea1u);
+
+    // bulk generation continues the scalar sequence
+    Philox4x32 scalarEngine(42, 3), bulkEngine(42, 3);
+    std::vector<uint32_t> bulk(103);
+    bulkEngine();
+    bulkEngine.fill(bulk.data(), bulk.size());
+    scalarEngine();
+    for (size_t i = 0; i < bulk.size(); i++)
+        ASSERT_EQ(bulk[i], scalarEngine());
+    ASSERT_EQ(bulkEngine(), scalarEngine());
+
+    // different streams are different sequences
+    Philox4x32 otherStream(42, 4);
+    scalarEngine.seed(42, 3);
+    size_t nEqual = 0;
+    for (size_t i = 0; i < 100; i++)
+        nEqual += (scalarEngine() == otherStream());
+    ASSERT_LT(nEqual, 2u);
+}
+
+
+TEST(NoiseTest, bulkGaussianNoiseTest)
+{
+    const size_t nSamples = 100001;
+    const double mean = uniformRandomNumber(-999, 999);
+    const double stdDev = uniformRandomNumber(0.1, 10);
+
+    GaussianNoise gNoise(mean, stdDev, 1234, 0);
+    Eigen::VectorXd samples(nSamples);
+    gNoise.fill(samples);
+
+    ASSERT_NEAR(samples.mean(), mean, stdDev / 100.0);
+    const double stdDevMeasured = std::sqrt((samples.array() - mean).square().mean());
+    ASSERT_NEAR(stdDevMeasured, stdDev, stdDev / 100.0);
+
+    // reproducible per seed and stream, independent between streams
+    GaussianNoise sameStream(mean, stdDev, 1234, 0), otherStream(mean, stdDev, 1234, 1);
+    Eigen::VectorXd same(nSamples), other(nSamples);
+    sameStream.fill(same);
+    otherStream.fill(other);
+    ASSERT_TRUE(same == samples);
+    const double correlation =
+        ((samples.array() - mean) * (other.array() - mean)).mean() / (stdDevMeasured * stdDevMeasured);
+    ASSERT_NEAR(correlation, 0.0, 0.02);
+
+    // arrays of vectors
+    StateVectorArray<3> x(100, StateVector<3>::Zero());
+    GaussianNoise processNoise(0.0, 1.0, 1234, 2);
+    processNoise.noisify(x);
+    for (size_t i = 0; i < x.size(); i++)
+        ASSERT_TRUE((x[i].array() != 0.0).all());
+}
+
+
+TEST(NoiseTest, multivariateGaussianNoiseTest)
+{
+    const size_t nSamples = 100000;
+
+    Eigen::Matrix3d A = Eigen::Matrix3d::Random();
+    const Eigen::Matrix3d covariance = A * A.transpose() + Eigen::Matrix3d::Identity();
+    const Eigen::Vector3d mean = Eigen::Vector3d::Random();
+
+    MultivariateGaussianNoise<3> noise(mean, covariance, 1234);
+    ASSERT_TRUE((noise.getCholeskyFactor() * noise.getCholeskyFactor().transpose()).isApprox(covariance));
+
+    StateVectorArray<3> samples(nSamples, StateVector<3>::Zero());
+    noise.fill(samples);
+
+    Eigen::Vector3d meanMeas = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d covarianceMeas = Eigen::Matrix3d::Zero();
+    for (size_t i = 0; i < nSamples; i++)
+    {
+        meanMeas += samples[i] / nSamples;
+        covarianceMeas += (samples[i] - mean) * (samples[i] - mean).transpose() / nSamples;
+    }
+    ASSERT_LT((meanMeas - mean).norm(), 0.05);
+    ASSERT_LT((covarianceMeas - covariance).norm(), 0.05 * covariance.norm());
+
+    // a covariance which is not positive definite is rejected
+    ASSERT_ANY_THROW(noise.setCovariance(-covariance));
+}
+
+
 TEST(NoiseTest, quantizationNoiseTest)
 {
     size_t nTests = 1000;
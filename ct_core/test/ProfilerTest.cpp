@@ -0,0 +1,78 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+// record zones independent of the build configuration
+#ifndef CT_PROFILING
+#define CT_PROFILING
+#endif
+
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ct/core/core.h>
+
+
+using namespace ct::core;
+
+
+void outerPhase()
+{
+    CT_PROFILE_SCOPE("outer");
+    {
+        CT_PROFILE_SCOPE("inner");
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+TEST(ProfilerTest, ZonesAndStatistics)
+{
+    Profiler::instance().reset();
+
+    ThreadPool pool(4);
+    pool.parallelFor(40, [](size_t threadId, size_t i) { outerPhase(); });
+
+    std::map<std::string, PhaseStatistics> statistics = Profiler::instance().computeStatistics();
+    ASSERT_EQ(statistics.size(), 2);
+    ASSERT_EQ(statistics["outer"].count, 40);
+    ASSERT_EQ(statistics["inner"].count, 40);
+
+    const PhaseStatistics& inner = statistics["inner"];
+    ASSERT_GE(inner.min, 0.1);
+    ASSERT_LE(inner.min, inner.p50);
+    ASSERT_LE(inner.p50, inner.p99);
+    ASSERT_LE(inner.p99, inner.max);
+    ASSERT_NEAR(inner.mean * inner.count, inner.total, 1e-9);
+    ASSERT_GE(statistics["outer"].total, inner.total);
+
+    std::ostringstream trace;
+    Profiler::instance().writeChromeTrace(trace);
+    ASSERT_NE(trace.str().find("\"name\":\"inner\""), std::string::npos);
+    ASSERT_NE(trace.str().find("traceEvents"), std::string::npos);
+
+    Profiler::instance().reset();
+    ASSERT_TRUE(Profiler::instance().computeStatistics().empty());
+}
+
+TEST(ProfilerTest, RingBufferKeepsLatestZones)
+{
+    Profiler::instance().reset();
+
+    const size_t capacity = Profiler::BUFFER_CAPACITY;
+    for (size_t i = 0; i < capacity + 10; i++)
+    {
+        CT_PROFILE_SCOPE("zone");
+    }
+
+    ASSERT_EQ(Profiler::instance().computeStatistics()["zone"].count, capacity);
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
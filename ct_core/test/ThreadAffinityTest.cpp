@@ -0,0 +1,68 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <ct/core/core.h>
+#include <gtest/gtest.h>
+
+using namespace ct::core;
+
+TEST(ThreadAffinityTest, parseCoreList)
+{
+    ASSERT_TRUE(parseCoreList("").empty());
+    ASSERT_EQ(parseCoreList("3"), std::vector<int>({3}));
+    ASSERT_EQ(parseCoreList("0-3,8, 10-11"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+
+    ASSERT_ANY_THROW(parseCoreList("a"));
+    ASSERT_ANY_THROW(parseCoreList("3-1"));
+    ASSERT_ANY_THROW(parseCoreList("-1"));
+}
+
+TEST(ThreadAffinityTest, pinThreads)
+{
+    // no cores given, nothing to pin
+    ASSERT_FALSE(pinCurrentThread(std::vector<int>(), 0));
+
+#ifdef __linux__
+    // every worker is mapped onto core 0, which always exists
+    const std::vector<int> cores(1, 0);
+    bool pinned = false;
+    std::thread worker([&]() { pinned = pinCurrentThread(cores, 3) && pinCurrentThread(cores, 3); });
+    worker.join();
+    ASSERT_TRUE(pinned);
+
+    bool released = false;
+    std::thread other([&]() { released = setCurrentThreadAffinity(std::vector<int>()); });
+    ASSERT_TRUE(setThreadAffinity(other, cores));
+    other.join();
+    ASSERT_TRUE(released);
+#endif
+}
+
+TEST(ThreadAffinityTest, pinPoolWorkers)
+{
+    const std::vector<int> cores(1, 0);
+
+    // worker 0 is the calling thread, its affinity must not change
+#ifdef __linux__
+    cpu_set_t before, after;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &before), 0);
+#endif
+    ASSERT_FALSE(pinPoolWorker(cores, 0));
+#ifdef __linux__
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &after), 0);
+    ASSERT_TRUE(CPU_EQUAL(&before, &after));
+
+    bool pinned = false;
+    std::thread worker([&]() { pinned = pinPoolWorker(cores, 1); });
+    worker.join();
+    ASSERT_TRUE(pinned);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
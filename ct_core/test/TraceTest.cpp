@@ -0,0 +1,121 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+#include <cstdio>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <ct/core/core.h>
+
+
+using namespace ct::core;
+
+
+TEST(TraceTest, WriteAndReadTrace)
+{
+    const std::string fileName = "TraceTest.cttrace";
+
+    StateVectorArray<3> x(11);
+    for (size_t k = 0; k < x.size(); k++)
+        x[k].setRandom();
+    StateMatrixArray<3> A(10);
+    for (size_t k = 0; k < A.size(); k++)
+        A[k].setRandom();
+    Eigen::Matrix<float, 2, 3> m = Eigen::Matrix<float, 2, 3>::Random();
+    Eigen::Vector3f f = Eigen::Vector3f::Random();
+    TimeArray t(0.1, 11);
+
+    {
+        // a small ring buffer forces the writer to grow it, to wrap around and to wait for the background thread
+        TraceWriter writer(fileName, 512);
+        for (size_t iteration = 0; iteration < 20; iteration++)
+        {
+            writer.writeArray("x", iteration, x);
+            writer.writeArray("A", iteration, A);
+            writer.write("cost", iteration, 0.5 * iteration);
+            writer.write("f", iteration, f);
+        }
+        writer.write("m", 20, m);
+        writer.writeArray("t", 20, t);
+    }
+
+    TraceReader reader(fileName);
+    TraceRecord record;
+    for (size_t iteration = 0; iteration < 20; iteration++)
+    {
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(record.name, "x");
+        ASSERT_EQ(record.iteration, iteration);
+        ASSERT_EQ(record.rows, 3);
+        ASSERT_EQ(record.cols, 1);
+        ASSERT_EQ(record.count, x.size());
+        for (size_t k = 0; k < x.size(); k++)
+            ASSERT_TRUE(record.matrix(k) == x[k]);
+
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(record.name, "A");
+        ASSERT_EQ(record.count, A.size());
+        for (size_t k = 0; k < A.size(); k++)
+            ASSERT_TRUE(record.matrix(k) == A[k]);
+
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(record.name, "cost");
+        ASSERT_EQ(record.data.size(), 1);
+        ASSERT_EQ(record.data[0], 0.5 * iteration);
+
+        // the data of this record is not a multiple of 8 bytes
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(record.name, "f");
+        ASSERT_EQ(record.scalar, TraceScalar::FLOAT32);
+        ASSERT_TRUE(record.matrix(0) == f.cast<double>());
+    }
+
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(record.scalar, TraceScalar::FLOAT32);
+    ASSERT_TRUE(record.matrix(0) == m.cast<double>());
+
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(record.name, "t");
+    ASSERT_EQ(record.count, t.size());
+    ASSERT_EQ(record.data[10], t[10]);
+
+    std::ostringstream csv;
+    TraceReader::writeCsv(csv, record);
+    const std::string lines = csv.str();
+    ASSERT_EQ(std::count(lines.begin(), lines.end(), '\n'), 11);
+
+    ASSERT_FALSE(reader.next(record));
+
+    std::remove(fileName.c_str());
+}
+
+#ifdef __linux__
+TEST(TraceTest, WriteError)
+{
+    // every write to /dev/full fails with ENOSPC
+    TraceWriter writer("/dev/full", 512);
+    ASSERT_TRUE(writer.good());
+
+    StateMatrixArray<3> A(10, StateMatrix<3>::Identity());
+    for (size_t iteration = 0; iteration < 20; iteration++)
+        writer.writeArray("A", iteration, A);
+
+    ASSERT_THROW(writer.flush(), std::runtime_error);
+    ASSERT_FALSE(writer.good());
+    ASSERT_NE(writer.errorMessage().find("/dev/full"), std::string::npos);
+
+    // further records are discarded without blocking
+    for (size_t iteration = 0; iteration < 20; iteration++)
+        writer.writeArray("A", iteration, A);
+    ASSERT_THROW(writer.flush(), std::runtime_error);
+}
+#endif
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,171 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ct/core/core.h>
+
+using namespace ct::core;
+
+//! an LTI system which counts the evaluations of its Jacobians
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+class CountingLTISystem : public LTISystem<STATE_DIM, CONTROL_DIM>
+{
+public:
+    using Base = LTISystem<STATE_DIM, CONTROL_DIM>;
+
+    CountingLTISystem(const typename Base::state_matrix_t& A, const typename Base::state_control_matrix_t& B)
+        : Base(A, B), evaluations(0)
+    {
+    }
+
+    CountingLTISystem* clone() const override { return new CountingLTISystem(*this); }
+    const typename Base::state_matrix_t& getDerivativeState(const typename Base::state_vector_t& x,
+        const typename Base::control_vector_t& u,
+        const double t = 0.0) override
+    {
+        evaluations++;
+        return Base::getDerivativeState(x, u, t);
+    }
+
+    size_t evaluations;
+};
+
+
+//! discretizes by the matrix exponential of the full augmented matrix
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void referenceDiscretization(const StateMatrix<STATE_DIM>& A,
+    const StateControlMatrix<STATE_DIM, CONTROL_DIM>& B,
+    double dt,
+    StateMatrix<STATE_DIM>& Ad,
+    StateControlMatrix<STATE_DIM, CONTROL_DIM>& Bd)
+{
+    Eigen::Matrix<double, STATE_DIM + CONTROL_DIM, STATE_DIM + CONTROL_DIM> M;
+    M.setZero();
+    M.template topLeftCorner<STATE_DIM, STATE_DIM>() = A * dt;
+    M.template topRightCorner<STATE_DIM, CONTROL_DIM>() = B * dt;
+    Eigen::Matrix<double, STATE_DIM + CONTROL_DIM, STATE_DIM + CONTROL_DIM> expM = M.exp();
+    Ad = expM.template topLeftCorner<STATE_DIM, STATE_DIM>();
+    Bd = expM.template topRightCorner<STATE_DIM, CONTROL_DIM>();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void testAugmentedMatrixExponential(const StateMatrix<STATE_DIM>& A,
+    const StateControlMatrix<STATE_DIM, CONTROL_DIM>& B,
+    double dt)
+{
+    StateMatrix<STATE_DIM> Ad, Ad_ref;
+    StateControlMatrix<STATE_DIM, CONTROL_DIM> Bd, Bd_ref;
+
+    AugmentedMatrixExponential<STATE_DIM, CONTROL_DIM> matrixExponential;
+    matrixExponential.compute(A, B, dt, Ad, Bd);
+    referenceDiscretization<STATE_DIM, CONTROL_DIM>(A, B, dt, Ad_ref, Bd_ref);
+
+    const double scale = std::max(1.0, Ad_ref.cwiseAbs().maxCoeff());
+    ASSERT_LT((Ad - Ad_ref).cwiseAbs().maxCoeff(), 1e-11 * scale);
+    ASSERT_LT((Bd - Bd_ref).cwiseAbs().maxCoeff(), 1e-11 * scale);
+}
+
+TEST(SensitivityApproximationTest, AugmentedMatrixExponential)
+{
+    // with and without scaling and squaring
+    for (double dt : {0.001, 0.01, 0.1, 1.0})
+    {
+        testAugmentedMatrixExponential<2, 1>(StateMatrix<2>::Random(), StateControlMatrix<2, 1>::Random(), dt);
+        testAugmentedMatrixExponential<36, 12>(
+            StateMatrix<36>::Random() / 6.0, StateControlMatrix<36, 12>::Random(), dt);
+    }
+
+    // singular A (double integrator), for which B_d cannot be computed from the inverse of A
+    StateMatrix<2> A;
+    A << 0.0, 1.0, 0.0, 0.0;
+    StateControlMatrix<2, 1> B;
+    B << 0.0, 1.0;
+    StateMatrix<2> Ad;
+    StateControlMatrix<2, 1> Bd;
+    const double dt = 0.1;
+    AugmentedMatrixExponential<2, 1>().compute(A, B, dt, Ad, Bd);
+    ASSERT_NEAR(Ad(0, 1), dt, 1e-14);
+    ASSERT_NEAR(Bd(0), 0.5 * dt * dt, 1e-14);
+    ASSERT_NEAR(Bd(1), dt, 1e-14);
+}
+
+TEST(SensitivityApproximationTest, TimeInvariantCaching)
+{
+    typedef SensitivityApproximationSettings::APPROXIMATION APPROXIMATION;
+
+    const double dt = 0.01;
+    StateMatrix<4> Ac = StateMatrix<4>::Random();
+    StateControlMatrix<4, 2> Bc = StateControlMatrix<4, 2>::Random();
+    std::shared_ptr<CountingLTISystem<4, 2>> system(new CountingLTISystem<4, 2>(Ac, Bc));
+
+    StateVector<4> x = StateVector<4>::Random();
+    ControlVector<2> u = ControlVector<2>::Random();
+
+    for (APPROXIMATION approx : {APPROXIMATION::FORWARD_EULER, APPROXIMATION::BACKWARD_EULER, APPROXIMATION::TUSTIN,
+             APPROXIMATION::MATRIX_EXPONENTIAL})
+    {
+        SensitivityApproximation<4, 2, 2, 2> ltv(dt, system, approx);
+        SensitivityApproximation<4, 2, 2, 2> lti(dt, system, approx, true);
+
+        StateMatrix<4> A_ltv, A_lti;
+        StateControlMatrix<4, 2> B_ltv, B_lti;
+
+        system->evaluations = 0;
+        for (int n = 0; n < 10; n++)
+        {
+            lti.getAandB(x, u, x, n, 1, A_lti, B_lti);
+            ltv.getAandB(x, u, x, n, 1, A_ltv, B_ltv);
+            ASSERT_TRUE(A_lti.isApprox(A_ltv));
+            ASSERT_TRUE(B_lti.isApprox(B_ltv));
+        }
+
+        // the time-invariant discretization evaluates the Jacobians only at the first stage
+        const size_t evaluationsPerStage = approx == APPROXIMATION::TUSTIN ? 2 : 1;
+        ASSERT_EQ(system->evaluations, 11 * evaluationsPerStage);
+
+        // modifying the system requires discarding the discretization
+        system->A() *= 2.0;
+        lti.getAandB(x, u, x, 0, 1, A_lti, B_lti);
+        ltv.getAandB(x, u, x, 0, 1, A_ltv, B_ltv);
+        ASSERT_FALSE(A_lti.isApprox(A_ltv));
+        lti.resetDiscretization();
+        lti.getAandB(x, u, x, 0, 1, A_lti, B_lti);
+        ASSERT_TRUE(A_lti.isApprox(A_ltv));
+        ASSERT_TRUE(B_lti.isApprox(B_ltv));
+        system->A() = Ac;
+    }
+}
+
+TEST(SensitivityApproximationTest, MatrixExponentialMatchesReference)
+{
+    const double dt = 0.05;
+    std::shared_ptr<LTISystem<4, 2>> system(
+        new LTISystem<4, 2>(StateMatrix<4>::Random(), StateControlMatrix<4, 2>::Random()));
+    SensitivityApproximation<4, 2, 2, 2> sensitivity(
+        dt, system, SensitivityApproximationSettings::APPROXIMATION::MATRIX_EXPONENTIAL);
+
+    StateMatrix<4> A, A_ref;
+    StateControlMatrix<4, 2> B, B_ref;
+    sensitivity.getAandB(StateVector<4>::Zero(), ControlVector<2>::Zero(), StateVector<4>::Zero(), 3, 1, A, B);
+    referenceDiscretization<4, 2>(system->A(), system->B(), dt, A_ref, B_ref);
+
+    ASSERT_TRUE(A.isApprox(A_ref, 1e-12));
+    ASSERT_TRUE(B.isApprox(B_ref, 1e-12));
+
+    // a changed time step invalidates the discretization of the last Jacobians
+    sensitivity.setTimeDiscretization(2.0 * dt);
+    sensitivity.getAandB(StateVector<4>::Zero(), ControlVector<2>::Zero(), StateVector<4>::Zero(), 3, 1, A, B);
+    referenceDiscretization<4, 2>(system->A(), system->B(), 2.0 * dt, A_ref, B_ref);
+    ASSERT_TRUE(A.isApprox(A_ref, 1e-12));
+    ASSERT_TRUE(B.isApprox(B_ref, 1e-12));
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -184,20 +184,18 @@ void executeJITCloneTest(bool useDynamicLib)
 
     std::shared_ptr<derivativesCppadJIT> jacCG_cloned(jacCG->clone());
 
-    // make sure the underlying dynamic libraries are not identical
-    if (useDynamicLib && (jacCG_cloned->getDynamicLib() == jacCG->getDynamicLib()))
-    {
-        std::cout << "FATAL ERROR: dynamic library not cloned correctly in JIT." << std::endl;
-        ASSERT_TRUE(false);
-    }
+    // the clone shares the compiled library instead of loading it again
+    if (useDynamicLib)
+        ASSERT_EQ(jacCG_cloned->getDynamicLib(), jacCG->getDynamicLib());
 #ifdef LLVM
-    if (!useDynamicLib && (jacCG_cloned->getLlvmLib() == jacCG->getLlvmLib()))
-    {
-        std::cout << "FATAL ERROR: Llvm library not cloned correctly in JIT." << std::endl;
-        ASSERT_TRUE(false);
-    }
+    if (!useDynamicLib)
+        ASSERT_EQ(jacCG_cloned->getLlvmLib(), jacCG->getLlvmLib());
 #endif
 
+    // the clone remains valid after the original is destroyed
+    std::shared_ptr<derivativesCppadJIT> jacCG_cloned2(jacCG_cloned->clone());
+    jacCG.reset();
+
     for (size_t i = 0; i < 100; i++)
     {
         // create a random input
@@ -206,6 +204,7 @@ void executeJITCloneTest(bool useDynamicLib)
         // verify agains the analytical Jacobian
         ASSERT_LT((jacCG_cloned->jacobian(x) - jacobianCheck(x)).array().abs().maxCoeff(), 1e-10);
         ASSERT_LT((jacCG_cloned->jacobian(x) - jacAd->jacobian(x)).array().abs().maxCoeff(), 1e-10);
+        ASSERT_LT((jacCG_cloned2->jacobian(x) - jacobianCheck(x)).array().abs().maxCoeff(), 1e-10);
     }
 }
 
@@ -265,11 +264,13 @@ TEST(HessianCGTest, JITHessianTest)
 /*!
  * Test cloning of JIT compiled libraries
  */
-TEST(JacobianCGTest, DISABLED_LlvmCloneTest)
+TEST(JacobianCGTest, LlvmCloneTest)
 {
     try
     {
+#ifdef LLVM
         executeJITCloneTest(false);  // Jit using llvm in-memory library
+#endif
     } catch (std::exception& e)
     {
         std::cout << "Exception thrown: " << e.what() << std::endl;
@@ -0,0 +1,105 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <ct/core/core.h>
+
+// Bring in gtest
+#include <gtest/gtest.h>
+
+using namespace ct::core;
+using std::shared_ptr;
+
+
+shared_ptr<SecondOrderSystem> createControlledOscillator()
+{
+    ControlVector<1> u;
+    u << 0.5;
+    shared_ptr<ConstantController<2, 1>> controller(new ConstantController<2, 1>(u));
+    return shared_ptr<SecondOrderSystem>(new SecondOrderSystem(10.0, 0.1, 1.0, controller));
+}
+
+
+TEST(ControlSimulatorTest, LockstepMatchesIntegration)
+{
+    const double sim_dt = 0.001;
+    const double control_dt = 0.01;
+    const double duration = 2.0;
+
+    StateVector<2> x0;
+    x0 << 1.0, 0.0;
+
+    shared_ptr<SecondOrderSystem> system = createControlledOscillator();
+    ControlSimulator<SecondOrderSystem> simulator(sim_dt, control_dt, x0, system);
+
+    StateVectorArray<2> log;
+    simulator.simulateLockstep(duration, IntegrationType::RK4, &log);
+    ASSERT_EQ(log.size(), 201u);
+
+    // reference: plain integration with the same step size
+    Integrator<2> integrator(system, IntegrationType::RK4);
+    StateVector<2> x_ref = x0;
+    integrator.integrate_n_steps(x_ref, 0.0, 2000, sim_dt);
+
+    ASSERT_LT((log.back() - x_ref).norm(), 1e-9);
+    ASSERT_LT((simulator.getState() - x_ref).norm(), 1e-9);
+
+    // lockstep simulations are deterministic
+    StateVectorArray<2> log2;
+    simulator.simulateLockstep(duration, IntegrationType::RK4, &log2);
+    for (size_t i = 0; i < log.size(); i++)
+        ASSERT_EQ(log[i], log2[i]);
+}
+
+
+TEST(ControlSimulatorTest, MonteCarloBatch)
+{
+    const size_t nScenarios = 16;
+    const double duration = 1.0;
+
+    MonteCarloSimulator<SecondOrderSystem> mc(0.001, 0.01, createControlledOscillator());
+
+    MonteCarloSimulator<SecondOrderSystem>::ScenarioArray scenarios(nScenarios);
+    for (size_t i = 0; i < nScenarios; i++)
+    {
+        scenarios[i].x0 << 1.0, 0.0;
+        scenarios[i].seed = static_cast<unsigned int>(i % (nScenarios / 2));
+    }
+
+    // perturb the initial state and the natural frequency of every scenario
+    MonteCarloSimulator<SecondOrderSystem>::ScenarioSetup setup = [](
+        size_t i, StateVector<2>& x0, SecondOrderSystem& system, GaussianNoise& noise) {
+        noise.noisify<2>(x0);
+        system.setDynamics(10.0 + noise(), 0.1);
+    };
+
+    std::vector<StateVectorArray<2>> serial, parallel;
+    mc.simulate(scenarios, duration, serial, setup);
+
+    mc.setNumThreads(4);
+    mc.simulate(scenarios, duration, parallel, setup);
+
+    ASSERT_EQ(serial.size(), nScenarios);
+    ASSERT_EQ(parallel.size(), nScenarios);
+
+    for (size_t i = 0; i < nScenarios; i++)
+    {
+        ASSERT_EQ(serial[i].size(), 101u);
+
+        // results do not depend on the number of threads
+        for (size_t k = 0; k < serial[i].size(); k++)
+            ASSERT_EQ(serial[i][k], parallel[i][k]);
+
+        // equal seeds give equal scenarios, different seeds different ones
+        ASSERT_EQ(serial[i].back(), serial[(i + nScenarios / 2) % nScenarios].back());
+        ASSERT_NE(serial[i].front(), serial[(i + 1) % nScenarios].front());
+    }
+}
+
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
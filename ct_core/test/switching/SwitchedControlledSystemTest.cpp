@@ -122,6 +122,118 @@ TEST(SwitchedControlledSystemTest, SwitchedControlledSystem)
     }
 }
 
+TEST(SwitchedControlledSystemTest, SwitchTimeAwareIntegration)
+{
+    using System = TestNonlinearSystem;
+    using SwitchedSystem = SwitchedControlledSystem<System::STATE_DIM, System::CONTROL_DIM>;
+    using ConstantController = ConstantController<System::STATE_DIM, System::CONTROL_DIM>;
+
+    System::control_vector_t u;
+    u[0] = 1.0;
+    std::shared_ptr<ConstantController> controller(new ConstantController(u));
+
+    std::shared_ptr<System> sys1(new System(0.5, controller));
+    std::shared_ptr<System> sys2(new System(2.0, controller));
+    SwitchedSystem::SwitchedSystems switchedSystems = {sys1, sys2};
+
+    // the switch at t = 0.55 lies in between the grid points of the fixed step integration
+    ContinuousModeSequence cm_seq;
+    cm_seq.addPhase(0, 0.55);
+    cm_seq.addPhase(1, 0.45);
+    ASSERT_EQ(cm_seq.getSwitchingTimes().size(), 1);
+
+    std::shared_ptr<SwitchedSystem> switchedSys(new SwitchedSystem(switchedSystems, cm_seq, controller));
+
+    System::state_vector_t x0;
+    x0 << 1.0, 0.5;
+
+    for (IntegrationType intType : {RK4, RK4CT})
+    {
+        // reference: integrate each mode separately, splitting the step that contains the switch
+        Integrator<System::STATE_DIM> integrator1(sys1, intType), integrator2(sys2, intType);
+        System::state_vector_t xRef = x0;
+        integrator1.integrate_n_steps(xRef, 0.0, 5, 0.1);
+        integrator1.integrate_n_steps(xRef, 0.5, 1, 0.05);
+        integrator2.integrate_n_steps(xRef, 0.55, 1, 0.05);
+        integrator2.integrate_n_steps(xRef, 0.6, 4, 0.1);
+
+        Integrator<System::STATE_DIM> integrator(switchedSys, intType);
+        System::state_vector_t x = x0;
+        StateVectorArray<System::STATE_DIM> stateTrajectory;
+        TimeArray timeTrajectory;
+        integrator.integrate_n_steps(x, 0.0, 10, 0.1, stateTrajectory, timeTrajectory);
+
+        ASSERT_TRUE(x.isApprox(xRef, 1e-12));
+        ASSERT_TRUE(stateTrajectory.back().isApprox(xRef, 1e-12));
+        for (size_t i = 1; i < timeTrajectory.size(); i++)
+            ASSERT_NEAR(timeTrajectory[i] - timeTrajectory[i - 1], 0.1, 1e-12);
+    }
+
+    // adaptive integration restarts at the switch
+    Integrator<System::STATE_DIM> integrator1(sys1, ODE45), integrator2(sys2, ODE45);
+    System::state_vector_t xRef = x0;
+    integrator1.integrate_adaptive(xRef, 0.0, 0.55);
+    integrator2.integrate_adaptive(xRef, 0.55, 1.0);
+
+    Integrator<System::STATE_DIM> integrator(switchedSys, ODE45);
+    System::state_vector_t x = x0;
+    StateVectorArray<System::STATE_DIM> stateTrajectory;
+    TimeArray timeTrajectory;
+    integrator.integrate_adaptive(x, 0.0, 1.0, stateTrajectory, timeTrajectory);
+
+    ASSERT_TRUE(x.isApprox(xRef, 1e-12));
+    ASSERT_EQ(timeTrajectory.front(), 0.0);
+    ASSERT_EQ(timeTrajectory.back(), 1.0);
+    ASSERT_TRUE(std::find(timeTrajectory.begin(), timeTrajectory.end(), 0.55) != timeTrajectory.end());
+    for (size_t i = 1; i < timeTrajectory.size(); i++)
+        ASSERT_LT(timeTrajectory[i - 1], timeTrajectory[i]);
+
+    // a copy of a system whose mode is fixed looks up its mode from the time
+    switchedSys->fixModeAtTime(0.7);
+    std::shared_ptr<SwitchedSystem> copy(switchedSys->clone());
+    switchedSys->releaseMode();
+    System::state_vector_t dx, dxRef;
+    copy->computeControlledDynamics(x0, 0.1, u, dx);
+    sys1->computeControlledDynamics(x0, 0.1, u, dxRef);
+    ASSERT_EQ(dx, dxRef);
+}
+
+TEST(SwitchedControlledSystemTest, SwitchTimeAwareDiscretization)
+{
+    using System = TestNonlinearSystem;
+    using SwitchedSystem = SwitchedControlledSystem<System::STATE_DIM, System::CONTROL_DIM>;
+    using ConstantController = ConstantController<System::STATE_DIM, System::CONTROL_DIM>;
+    using Discretizer = SystemDiscretizer<System::STATE_DIM, System::CONTROL_DIM>;
+
+    System::control_vector_t u;
+    u[0] = 1.0;
+    std::shared_ptr<ConstantController> controller(new ConstantController(u));
+
+    std::shared_ptr<System> sys1(new System(0.5, controller));
+    std::shared_ptr<System> sys2(new System(2.0, controller));
+    ContinuousModeSequence cm_seq;
+    cm_seq.addPhase(0, 0.55);
+    cm_seq.addPhase(1, 0.45);
+    std::shared_ptr<SwitchedSystem> switchedSys(new SwitchedSystem({sys1, sys2}, cm_seq, controller));
+
+    System::state_vector_t x0, xRef, x;
+    x0 << 1.0, 0.5;
+
+    // the stage from 0.5 to 0.6 contains the switch
+    Integrator<System::STATE_DIM> integrator1(sys1, RK4), integrator2(sys2, RK4);
+    xRef = x0;
+    integrator1.integrate_n_steps(xRef, 0.5, 1, 0.05);
+    integrator2.integrate_n_steps(xRef, 0.55, 1, 0.05);
+
+    Discretizer discretizer(switchedSys, 0.1, RK4, 1);
+    discretizer.propagateControlledDynamics(x0, 5, u, x);
+    ASSERT_FALSE(x.isApprox(xRef, 1e-6));
+
+    discretizer.setSplitAtSwitchingTimes(true);
+    discretizer.propagateControlledDynamics(x0, 5, u, x);
+    ASSERT_TRUE(x.isApprox(xRef, 1e-12));
+}
+
 
 /*!
  *  SwitchingControlledSystemTest.cpp
@@ -86,6 +86,45 @@ TEST(SwitchedDiscreteControlledSystemTest, SwitchedDiscreteControlledSystem)
     }
 }
 
+TEST(SwitchedDiscreteControlledSystemTest, FixedMode)
+{
+    using System = TestDiscreteNonlinearSystem;
+    using SwitchedSystem = SwitchedDiscreteControlledSystem<System::STATE_DIM, System::CONTROL_DIM>;
+    using ConstantController = ConstantController<System::STATE_DIM, System::CONTROL_DIM>;
+
+    System::control_vector_t u;
+    u[0] = 1.0;
+    std::shared_ptr<ConstantController> controller(new ConstantController(u));
+
+    SwitchedSystem::SwitchedSystems switchedSystems = {
+        SwitchedSystem::SystemPtr(new System(1.0)), SwitchedSystem::SystemPtr(new System(2.0))};
+    DiscreteModeSequence dm_seq;
+    dm_seq.addPhase(0, 2);
+    dm_seq.addPhase(1, 3);
+    dm_seq.addPhase(0, 1);
+
+    SwitchedSystem switchedSys(switchedSystems, dm_seq, controller);
+    ASSERT_EQ(switchedSys.getSwitchingTimes(), std::vector<int>({2, 5}));
+
+    System::state_vector_t x, xMode0, xMode1, xNext;
+    x << 1.0, 0.5;
+    switchedSystems[0]->propagateControlledDynamics(x, 0, u, xMode0);
+    switchedSystems[1]->propagateControlledDynamics(x, 0, u, xMode1);
+
+    // the fixed mode applies at any time index, also in a copy it is looked up again
+    switchedSys.fixModeAtTime(3);
+    switchedSys.propagateControlledDynamics(x, 0, u, xNext);
+    ASSERT_EQ(xNext, xMode1);
+
+    std::shared_ptr<SwitchedSystem> copy(switchedSys.clone());
+    copy->propagateControlledDynamics(x, 0, u, xNext);
+    ASSERT_EQ(xNext, xMode0);
+
+    switchedSys.releaseMode();
+    switchedSys.propagateControlledDynamics(x, 0, u, xNext);
+    ASSERT_EQ(xNext, xMode0);
+}
+
 
 /*!
  *  SwitchingDiscreteControlledSystemTest.cpp
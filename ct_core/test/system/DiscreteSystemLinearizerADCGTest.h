@@ -42,12 +42,8 @@ TEST(DiscreteSystemLinearizerADCG, JITCompilationTest)
 
     std::shared_ptr<DiscreteSystemLinearizerADCG<state_dim, control_dim>> adLinearizerClone(adLinearizer.clone());
 
-    // make sure the underlying dynamic libraries are not identical (dynamic library cloned correctly)
-    if (adLinearizerClone->getLinearizer().getDynamicLib() == adLinearizer.getLinearizer().getDynamicLib())
-    {
-        std::cout << "FATAL ERROR: dynamic library not cloned correctly in JIT." << std::endl;
-        ASSERT_TRUE(false);
-    }
+    // the clone shares the compiled library instead of loading it again
+    ASSERT_EQ(adLinearizerClone->getLinearizer().getDynamicLib(), adLinearizer.getLinearizer().getDynamicLib());
 
     // create state, control and time variables
     StateVector<state_dim> x;
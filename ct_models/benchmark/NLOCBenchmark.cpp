@@ -0,0 +1,139 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Benchmarks of full GNMS and iLQR iterations (the first benchmark argument) with the code-generated linearizations
+ * of the Quadrotor, HyA and, if built with BUILD_HYQ_FULL, HyQ. One iteration comprises the rollout, the
+ * linearization and quadratization of all stages, the solution of the LQ problem and the line search.
+ *
+ * The second argument measures the overhead of the binary solver trace: 0 disables it, 1 logs the costs and timings
+ * of every iteration and the trajectories of every traceDecimation-th iteration (logToTrace) and 2 logs the LQ problem
+ * and the Riccati matrices in addition (logLQToTrace).
+ */
+
+#include <ct/optcon/optcon.h>
+#include <ct/rbd/rbd.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+#include <ct/models/Quadrotor/Quadrotor.hpp>
+#include <ct/models/Quadrotor/QuadrotorLinear.hpp>
+#include <ct/models/HyA/HyA.h>
+#ifdef HYQ_FULL
+#include <ct/models/HyQ/HyQ.h>
+#endif
+
+using namespace ct;
+using namespace ct::optcon;
+
+const double timeHorizon = 1.0;
+
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void runNLOCIterations(benchmark::State& state,
+    std::shared_ptr<core::ControlledSystem<STATE_DIM, CONTROL_DIM>> system,
+    std::shared_ptr<core::LinearSystem<STATE_DIM, CONTROL_DIM>> linearSystem,
+    const core::StateVector<STATE_DIM>& x0,
+    const core::ControlVector<CONTROL_DIM>& u0)
+{
+    typedef NLOptConSolver<STATE_DIM, CONTROL_DIM> Solver;
+
+    // regulate to the initial state
+    std::shared_ptr<CostFunctionQuadratic<STATE_DIM, CONTROL_DIM>> costFunction(
+        new CostFunctionAnalytical<STATE_DIM, CONTROL_DIM>());
+    costFunction->addIntermediateTerm(std::shared_ptr<TermQuadratic<STATE_DIM, CONTROL_DIM>>(
+        new TermQuadratic<STATE_DIM, CONTROL_DIM>(core::StateMatrix<STATE_DIM>::Identity(),
+            core::ControlMatrix<CONTROL_DIM>::Identity(), x0, u0)));
+    costFunction->addFinalTerm(std::shared_ptr<TermQuadratic<STATE_DIM, CONTROL_DIM>>(
+        new TermQuadratic<STATE_DIM, CONTROL_DIM>(100.0 * core::StateMatrix<STATE_DIM>::Identity(),
+            core::ControlMatrix<CONTROL_DIM>::Zero(), x0, u0)));
+
+    ContinuousOptConProblem<STATE_DIM, CONTROL_DIM> problem(timeHorizon, x0, system, costFunction, linearSystem);
+
+    NLOptConSettings settings;
+    settings.nlocp_algorithm = static_cast<NLOptConSettings::NLOCP_ALGORITHM>(state.range(0));
+    settings.integrator = core::IntegrationType::RK4;
+    settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+    settings.dt = 0.01;
+    settings.K_sim = 1;
+    settings.max_iterations = 1;
+    settings.nThreads = 1;
+    settings.printSummary = false;
+    settings.lineSearchSettings.type = LineSearchSettings::TYPE::SIMPLE;
+    settings.logToTrace = state.range(1) > 0;
+    settings.logLQToTrace = state.range(1) > 1;
+    settings.loggingPrefix = "bench_NLOC";
+
+    const size_t K = settings.computeK(timeHorizon);
+    core::FeedbackArray<STATE_DIM, CONTROL_DIM> u0_fb(K, core::FeedbackMatrix<STATE_DIM, CONTROL_DIM>::Zero());
+    typename Solver::Policy_t initialGuess(core::StateVectorArray<STATE_DIM>(K + 1, x0),
+        core::ControlVectorArray<CONTROL_DIM>(K, u0), u0_fb, settings.dt);
+
+    Solver solver(problem, settings);
+    solver.setInitialGuess(initialGuess);
+
+    core::AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        bool converged = solver.runIteration();
+        benchmark::DoNotOptimize(converged);
+    }
+}
+
+void Quadrotor_iteration(benchmark::State& state)
+{
+    core::StateVector<models::quadrotor::nStates> x0 = core::StateVector<models::quadrotor::nStates>::Zero();
+    x0(2) = 1.0;
+    runNLOCIterations<models::quadrotor::nStates, models::quadrotor::nControls>(state,
+        std::shared_ptr<models::Quadrotor>(new models::Quadrotor()),
+        std::shared_ptr<models::QuadrotorLinear>(new models::QuadrotorLinear()), x0,
+        core::ControlVector<models::quadrotor::nControls>::Zero());
+}
+
+void HyA_iteration(benchmark::State& state)
+{
+    typedef rbd::FixBaseFDSystem<rbd::HyA::Dynamics> HyASystem;
+    runNLOCIterations<HyASystem::STATE_DIM, HyASystem::CONTROL_DIM>(state,
+        std::shared_ptr<HyASystem>(new HyASystem()),
+        std::shared_ptr<models::HyA::HyALinearizedForward>(new models::HyA::HyALinearizedForward()),
+        core::StateVector<HyASystem::STATE_DIM>::Zero(), core::ControlVector<HyASystem::CONTROL_DIM>::Zero());
+}
+
+#ifdef HYQ_FULL
+void HyQ_iteration(benchmark::State& state)
+{
+    typedef rbd::FloatingBaseFDSystem<rbd::HyQ::Dynamics, false> HyQSystem;
+    typedef rbd::EEContactModel<typename HyQSystem::Kinematics> ContactModel;
+
+    // the same contact model as in the code generation of HyQWithContactModelLinearizedForward
+    std::shared_ptr<HyQSystem> system(new HyQSystem());
+    system->setContactModel(std::shared_ptr<ContactModel>(new ContactModel(5000.0, 1000.0, 100.0, 100.0, -0.02,
+        ContactModel::VELOCITY_SMOOTHING::SIGMOID, system->dynamics().kinematicsPtr())));
+
+    // standing at nominal height
+    core::StateVector<HyQSystem::STATE_DIM> x0 = core::StateVector<HyQSystem::STATE_DIM>::Zero();
+    x0(5) = 0.5;
+    runNLOCIterations<HyQSystem::STATE_DIM, HyQSystem::CONTROL_DIM>(state, system,
+        std::shared_ptr<models::HyQ::HyQWithContactModelLinearizedForward>(
+            new models::HyQ::HyQWithContactModelLinearizedForward()),
+        x0, core::ControlVector<HyQSystem::CONTROL_DIM>::Zero());
+}
+#endif
+
+//! the algorithms and trace levels benchmarked, with the ct statistics
+void algorithms(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"algorithm", "trace"});
+    for (int algorithm : {NLOptConSettings::GNMS, NLOptConSettings::ILQR})
+        for (int trace = 0; trace <= 2; trace++)
+            b->Args({algorithm, trace});
+    b->Unit(benchmark::kMillisecond)->Apply(core::benchmarkStatistics);
+}
+
+BENCHMARK(Quadrotor_iteration)->Apply(algorithms);
+BENCHMARK(HyA_iteration)->Apply(algorithms);
+#ifdef HYQ_FULL
+BENCHMARK(HyQ_iteration)->Apply(algorithms);
+#endif
+
+CT_BENCHMARK_MAIN()
@@ -81,6 +81,10 @@ public:
     {
         return computeInverseKinematics(res, eeWorldPose.inReferenceFrame(baseWorldPose), freeJoints);
     }
+
+protected:
+    //! the IKFast solver is stateless, poses can be solved concurrently
+    bool supportsParallelSolves() const override { return true; }
 };
 } /* namespace rbd */
 } /* namespace ct */
@@ -18,7 +18,7 @@ namespace ct {
 namespace rbd {
 
 template <typename SCALAR = double>
-class Irb4600InverseKinematics : InverseKinematicsBase<6, SCALAR>
+class Irb4600InverseKinematics : public InverseKinematicsBase<6, SCALAR>
 {
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -76,6 +76,10 @@ public:
     {
         return computeInverseKinematics(res, eeWorldPose.inReferenceFrame(baseWorldPose), freeJoints);
     }
+
+protected:
+    //! the IKFast solver is stateless, poses can be solved concurrently
+    bool supportsParallelSolves() const override { return true; }
 };
 } /* namespace rbd */
 } /* namespace ct */
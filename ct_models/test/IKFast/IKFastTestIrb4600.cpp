@@ -38,6 +38,50 @@ TEST(Irb4600IKTest, IKFastTest)
     }
 }
 
+TEST(Irb4600IKTest, IKFastBatchTest)
+{
+    ct::rbd::InverseKinematicsSettings ikSettings;
+    ikSettings.nThreads_ = 4;
+
+    ct::rbd::Irb4600InverseKinematics<double> irb4600_ik_solver;
+    irb4600_ik_solver.updateSettings(ikSettings);
+
+    using IK = ct::rbd::Irb4600InverseKinematics<double>;
+
+    // a smooth joint space path mapped to a Cartesian path
+    typename ct::rbd::JointState<6, double>::Position start, end, pos;
+    start.setRandom();
+    end = start + 0.2 * IK::JointPosition_t::Ones();
+
+    const size_t nPoses = 100;
+    typename IK::RigidBodyPoseVector_t eePath(nPoses);
+    Eigen::Vector3d ee_pos;
+    Eigen::Matrix<double, 3, 3, Eigen::RowMajor> ee_rot;
+
+    for (size_t i = 0; i < nPoses; i++)
+    {
+        pos = start + (end - start) * double(i) / double(nPoses - 1);
+        irb4600_ik::ComputeFk(pos.data(), ee_pos.data(), ee_rot.data());
+        eePath[i].position().toImplementation() = ee_pos;
+        eePath[i].setFromRotationMatrix(kindr::RotationMatrix<double>(ee_rot));
+    }
+
+    typename IK::JointPositionsVector_t solutions;
+    ASSERT_TRUE(irb4600_ik_solver.computeInverseKinematicsBatch(solutions, eePath, start));
+    ASSERT_EQ(solutions.size(), nPoses);
+
+    for (size_t i = 0; i < nPoses; i++)
+    {
+        irb4600_ik::ComputeFk(solutions[i].data(), ee_pos.data(), ee_rot.data());
+        ASSERT_LT((ee_pos - eePath[i].position().toImplementation()).norm(), 1e-3);
+        ASSERT_LT((ee_rot - eePath[i].getRotationMatrix().toImplementation()).norm(), 1e-3);
+
+        // consecutive solutions stay on the same branch
+        if (i > 0)
+            ASSERT_LT((solutions[i] - solutions[i - 1]).norm(), 0.1);
+    }
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,112 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Throughput benchmarks of solving batches of MIMO integrator problems, which differ in their initial states.
+ * The items per second reported are problems per second. The BatchNLOptConSolver is benchmarked for several numbers
+ * of threads (the benchmark argument) and compared to constructing one NLOptConSolver per problem.
+ */
+
+#include <ct/optcon/optcon.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+using namespace ct;
+using namespace ct::optcon;
+
+#include "../test/testSystems/MIMOIntegrator.h"
+
+const size_t nProblems = 64;
+const double tf = 1.0;
+
+//! the settings, problem, initial states and initial guess of a batch
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+struct Batch
+{
+    typedef NLOptConSolver<STATE_DIM, CONTROL_DIM> NLOptConSolver_t;
+
+    Batch()
+        : optConProblem(tf,
+              core::StateVector<STATE_DIM>::Zero(),
+              std::shared_ptr<core::ControlledSystem<STATE_DIM, CONTROL_DIM>>(
+                  new example::MIMOIntegrator<STATE_DIM, CONTROL_DIM>()),
+              example::createMIMOIntegratorCostFunction<STATE_DIM, CONTROL_DIM>(core::StateVector<STATE_DIM>::Ones()),
+              std::shared_ptr<core::LinearSystem<STATE_DIM, CONTROL_DIM>>(
+                  new example::MIMOIntegratorLinear<STATE_DIM, CONTROL_DIM>())),
+          initialStates(nProblems)
+    {
+        settings.dt = 0.01;
+        settings.nlocp_algorithm = NLOptConSettings::NLOCP_ALGORITHM::GNMS;
+        settings.lqocp_solver = NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER;
+        settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+        settings.recordSmallestEigenvalue = false;
+        settings.printSummary = false;
+        settings.max_iterations = 5;
+        settings.nThreads = 1;
+        settings.nThreadsEigen = 1;
+
+        for (size_t i = 0; i < nProblems; i++)
+            initialStates[i].setRandom();
+
+        const size_t K = settings.computeK(tf);
+        initialGuess = typename NLOptConSolver_t::Policy_t(
+            core::StateVectorArray<STATE_DIM>(K + 1, core::StateVector<STATE_DIM>::Zero()),
+            core::ControlVectorArray<CONTROL_DIM>(K, core::ControlVector<CONTROL_DIM>::Zero()),
+            core::FeedbackArray<STATE_DIM, CONTROL_DIM>(K, core::FeedbackMatrix<STATE_DIM, CONTROL_DIM>::Zero()),
+            settings.dt);
+    }
+
+    NLOptConSettings settings;
+    ContinuousOptConProblem<STATE_DIM, CONTROL_DIM> optConProblem;
+    core::StateVectorArray<STATE_DIM> initialStates;
+    typename NLOptConSolver_t::Policy_t initialGuess;
+};
+
+//! solves the batch with a BatchNLOptConSolver, the number of threads is the benchmark argument
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void BatchNLOptConSolver_solve(benchmark::State& state)
+{
+    Batch<STATE_DIM, CONTROL_DIM> batch;
+    BatchNLOptConSolver<STATE_DIM, CONTROL_DIM> solver(batch.optConProblem, batch.settings, state.range(0));
+
+    for (auto _ : state)
+    {
+        solver.solve(batch.initialStates, batch.initialGuess);
+        benchmark::DoNotOptimize(solver.getCosts().data());
+    }
+    state.SetItemsProcessed(state.iterations() * nProblems);
+}
+
+//! solves the batch sequentially, with one NLOptConSolver per problem
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void NLOptConSolver_perProblem(benchmark::State& state)
+{
+    Batch<STATE_DIM, CONTROL_DIM> batch;
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < nProblems; i++)
+        {
+            NLOptConSolver<STATE_DIM, CONTROL_DIM> solver(batch.optConProblem, batch.settings);
+            solver.setInitialGuess(batch.initialGuess);
+            solver.changeInitialState(batch.initialStates[i]);
+            solver.solve();
+            benchmark::DoNotOptimize(solver.getCost());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * nProblems);
+}
+
+//! the numbers of threads benchmarked, measured in wall-clock time
+void threads(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("threads")->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Apply(ct::core::benchmarkStatistics);
+}
+
+BENCHMARK_TEMPLATE(BatchNLOptConSolver_solve, 4, 2)->Apply(threads);
+BENCHMARK_TEMPLATE(BatchNLOptConSolver_solve, 12, 4)->Apply(threads);
+BENCHMARK_TEMPLATE(NLOptConSolver_perProblem, 4, 2)->Apply(ct::core::benchmarkStatistics);
+BENCHMARK_TEMPLATE(NLOptConSolver_perProblem, 12, 4)->Apply(ct::core::benchmarkStatistics);
+
+CT_BENCHMARK_MAIN()
@@ -0,0 +1,95 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+/*!
+ * Benchmarks of the GNRiccatiSolver and, if available, the HPIPMInterface on the LQ problem of the MIMO integrator,
+ * for several state and control dimensions and time horizons (the benchmark argument).
+ * One iteration comprises what an NLOC iteration requires from the LQ solver: solving, computing the states and
+ * controls, the feedback matrices and the feedforward updates.
+ */
+
+#include <ct/optcon/optcon.h>
+#include <ct/core/benchmark/BenchmarkMain.h>
+
+using namespace ct;
+using namespace ct::optcon;
+
+#include "../test/testSystems/MIMOIntegrator.h"
+
+const double dt = 0.1;
+
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void solveLQOCProblem(benchmark::State& state, std::shared_ptr<LQOCSolver<STATE_DIM, CONTROL_DIM>> solver)
+{
+    const int N = state.range(0);
+
+    NLOptConSettings settings;
+    settings.fixedHessianCorrection = true;
+    settings.epsilon = 0;
+    settings.recordSmallestEigenvalue = false;
+    settings.nThreadsEigen = 1;
+    solver->configure(settings);
+
+    std::shared_ptr<core::LinearSystem<STATE_DIM, CONTROL_DIM>> system(
+        new example::MIMOIntegratorLinear<STATE_DIM, CONTROL_DIM>());
+    core::SensitivityApproximation<STATE_DIM, CONTROL_DIM> discreteSystem(
+        dt, system, core::SensitivityApproximationSettings::APPROXIMATION::MATRIX_EXPONENTIAL);
+    auto costFunction =
+        example::createMIMOIntegratorCostFunction<STATE_DIM, CONTROL_DIM>(core::StateVector<STATE_DIM>::Random());
+
+    std::shared_ptr<LQOCProblem<STATE_DIM, CONTROL_DIM>> problem(new LQOCProblem<STATE_DIM, CONTROL_DIM>(N));
+    problem->setFromTimeInvariantLinearQuadraticProblem(
+        discreteSystem, *costFunction, core::StateVector<STATE_DIM>::Zero(), dt);
+    solver->setProblem(problem);
+    solver->initializeAndAllocate();
+
+    core::AllocationCounter::Scope allocations(state);
+    for (auto _ : state)
+    {
+        solver->solve();
+        solver->computeStatesAndControls();
+        solver->computeFeedbackMatrices();
+        solver->compute_lv();
+        benchmark::DoNotOptimize(solver->getSolutionControl().front().data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void GNRiccatiSolver_solve(benchmark::State& state)
+{
+    solveLQOCProblem<STATE_DIM, CONTROL_DIM>(state,
+        std::shared_ptr<LQOCSolver<STATE_DIM, CONTROL_DIM>>(new GNRiccatiSolver<STATE_DIM, CONTROL_DIM>()));
+}
+
+#ifdef HPIPM
+template <size_t STATE_DIM, size_t CONTROL_DIM>
+void HPIPMInterface_solve(benchmark::State& state)
+{
+    solveLQOCProblem<STATE_DIM, CONTROL_DIM>(state,
+        std::shared_ptr<LQOCSolver<STATE_DIM, CONTROL_DIM>>(new HPIPMInterface<STATE_DIM, CONTROL_DIM>()));
+}
+#endif
+
+//! the time horizons benchmarked, with the ct statistics
+void horizons(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("N")->Arg(10)->Arg(100)->Arg(1000)->Apply(ct::core::benchmarkStatistics);
+}
+
+#ifdef HPIPM
+#define CT_BENCHMARK_LQOC_SOLVERS(STATE_DIM, CONTROL_DIM)                               \
+    BENCHMARK_TEMPLATE(GNRiccatiSolver_solve, STATE_DIM, CONTROL_DIM)->Apply(horizons); \
+    BENCHMARK_TEMPLATE(HPIPMInterface_solve, STATE_DIM, CONTROL_DIM)->Apply(horizons)
+#else
+#define CT_BENCHMARK_LQOC_SOLVERS(STATE_DIM, CONTROL_DIM) \
+    BENCHMARK_TEMPLATE(GNRiccatiSolver_solve, STATE_DIM, CONTROL_DIM)->Apply(horizons)
+#endif
+
+CT_BENCHMARK_LQOC_SOLVERS(4, 2);
+CT_BENCHMARK_LQOC_SOLVERS(12, 4);
+CT_BENCHMARK_LQOC_SOLVERS(36, 12);
+
+CT_BENCHMARK_MAIN()
@@ -310,6 +310,28 @@ CostFunctionAD<STATE_DIM, CONTROL_DIM, SCALAR>::stateControlDerivativeIntermedia
     return hesTot.template block<CONTROL_DIM, STATE_DIM>(STATE_DIM, 0) + this->stateControlDerivativeIntermediateBase();
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionAD<STATE_DIM, CONTROL_DIM, SCALAR>::quadraticModelIntermediate(
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model)
+{
+    model.setZero();
+    this->quadraticModelIntermediateBase(model);
+
+    // a single jacobian and hessian evaluation of the auto-diff terms for all blocks
+    Eigen::Matrix<SCALAR, 1, STATE_DIM + CONTROL_DIM + 1> jacTot =
+        intermediateCostCodegen_->jacobian(stateControlTime_);
+    Eigen::Matrix<SCALAR, 1, 1> w;
+    w << SCALAR(1.0);
+    MatrixXs hesTot = intermediateCostCodegen_->hessian(stateControlTime_, w);
+
+    model.q += intermediateCostCodegen_->forwardZero(stateControlTime_)(0);
+    model.qv += jacTot.template leftCols<STATE_DIM>().transpose();
+    model.Q += hesTot.template block<STATE_DIM, STATE_DIM>(0, 0);
+    model.rv += jacTot.template block<1, CONTROL_DIM>(0, STATE_DIM).transpose();
+    model.R += hesTot.template block<CONTROL_DIM, CONTROL_DIM>(STATE_DIM, STATE_DIM);
+    model.P += hesTot.template block<CONTROL_DIM, STATE_DIM>(STATE_DIM, 0);
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 typename CostFunctionAD<STATE_DIM, CONTROL_DIM, SCALAR>::control_state_matrix_t
 CostFunctionAD<STATE_DIM, CONTROL_DIM, SCALAR>::stateControlDerivativeTerminal()
@@ -173,5 +173,13 @@ CostFunctionAnalytical<STATE_DIM, CONTROL_DIM, SCALAR>::stateControlDerivativeTe
     return this->stateControlDerivativeTerminalBase();
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionAnalytical<STATE_DIM, CONTROL_DIM, SCALAR>::quadraticModelIntermediate(
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model)
+{
+    model.setZero();
+    this->quadraticModelIntermediateBase(model);
+}
+
 }  // namespace optcon
 }  // namespace ct
@@ -86,6 +86,8 @@ public:
     control_state_matrix_t stateControlDerivativeIntermediate() override;
     control_state_matrix_t stateControlDerivativeTerminal() override;
 
+    void quadraticModelIntermediate(QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model) override;
+
     void loadFromConfigFile(const std::string& filename, bool verbose = false) override;
 
 private:
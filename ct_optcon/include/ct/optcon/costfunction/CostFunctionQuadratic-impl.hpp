@@ -18,7 +18,9 @@ template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::CostFunctionQuadratic(const CostFunctionQuadratic& arg)
     : CostFunction<STATE_DIM, CONTROL_DIM, SCALAR>(arg),
       eps_(arg.eps_),
-      doubleSidedDerivative_(arg.doubleSidedDerivative_)
+      doubleSidedDerivative_(arg.doubleSidedDerivative_),
+      stageGrid_(arg.stageGrid_),
+      stageActiveTerms_(arg.stageActiveTerms_)
 {
     intermediateCostAnalytical_.resize(arg.intermediateCostAnalytical_.size());
     finalCostAnalytical_.resize(arg.finalCostAnalytical_.size());
@@ -87,6 +89,18 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::stateControlDerivativeTer
     throw std::runtime_error("stateControlDerivativeTerminal() not implemented");
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::quadraticModelIntermediate(
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model)
+{
+    model.q = this->evaluateIntermediate();
+    model.qv = this->stateDerivativeIntermediate();
+    model.Q = this->stateSecondDerivativeIntermediate();
+    model.rv = this->controlDerivativeIntermediate();
+    model.R = this->controlSecondDerivativeIntermediate();
+    model.P = this->stateControlDerivativeIntermediate();
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::updateReferenceState(const state_vector_t& x_ref)
 {
@@ -273,6 +287,63 @@ void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::initialize()
 	 */
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::bindToTimeGrid(const core::tpl::TimeArray<SCALAR>& times)
+{
+    stageGrid_.set(times);
+
+    for (auto term : intermediateCostAnalytical_)
+        term->bindToTimeGrid(times);
+    for (auto term : finalCostAnalytical_)
+        term->bindToTimeGrid(times);
+
+    precomputeActiveTerms();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::unbindTimeGrid()
+{
+    stageGrid_.clear();
+    stageActiveTerms_.clear();
+
+    for (auto term : intermediateCostAnalytical_)
+        term->unbindTimeGrid();
+    for (auto term : finalCostAnalytical_)
+        term->unbindTimeGrid();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::precomputeActiveTerms()
+{
+    stageActiveTerms_.assign(stageGrid_.size(), std::vector<ActiveTerm>());
+
+    for (size_t k = 0; k < stageGrid_.size(); k++)
+    {
+        for (size_t i = 0; i < intermediateCostAnalytical_.size(); i++)
+        {
+            if (intermediateCostAnalytical_[i]->isActiveAtTime(stageGrid_[k]))
+                stageActiveTerms_[k].push_back(
+                    ActiveTerm{i, intermediateCostAnalytical_[i]->computeActivation(stageGrid_[k])});
+        }
+    }
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+auto CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::activeIntermediateTerms() -> const std::vector<ActiveTerm>&
+{
+    size_t k;
+    if (stageGrid_.find(this->t_, k))
+        return stageActiveTerms_[k];
+
+    activeTerms_.clear();
+    for (size_t i = 0; i < intermediateCostAnalytical_.size(); i++)
+    {
+        if (intermediateCostAnalytical_[i]->isActiveAtTime(this->t_))
+            activeTerms_.push_back(ActiveTerm{i, intermediateCostAnalytical_[i]->computeActivation(this->t_)});
+    }
+    return activeTerms_;
+}
+
 
 // add terms
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
@@ -281,6 +352,11 @@ size_t CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::addIntermediateTer
     bool verbose)
 {
     intermediateCostAnalytical_.push_back(term);
+    if (!stageGrid_.empty())
+    {
+        term->bindToTimeGrid(core::tpl::TimeArray<SCALAR>(stageGrid_.times()));
+        precomputeActiveTerms();
+    }
     if (verbose)
     {
         std::string name = term->getName();
@@ -296,6 +372,8 @@ size_t CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::addFinalTerm(
     bool verbose)
 {
     finalCostAnalytical_.push_back(term);
+    if (!stageGrid_.empty())
+        term->bindToTimeGrid(core::tpl::TimeArray<SCALAR>(stageGrid_.times()));
     if (verbose)
     {
         std::string name = term->getName();
@@ -311,13 +389,10 @@ SCALAR CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::evaluateIntermedia
 {
     SCALAR y = SCALAR(0.0);
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        y += it->computeActivation(this->t_) * it->eval(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        y += term.activation * it->evaluate(this->x_, this->u_, this->t_);
     }
 
     return y;
@@ -336,6 +411,18 @@ SCALAR CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::evaluateTerminalBa
 }
 
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::quadraticModelIntermediateBase(
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model)
+{
+    for (const ActiveTerm& term : activeIntermediateTerms())
+    {
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        it->addQuadraticModel(this->x_, this->u_, this->t_, term.activation, model);
+    }
+}
+
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 typename CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::state_vector_t
 CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::stateDerivativeIntermediateBase()
@@ -343,13 +430,10 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::stateDerivativeIntermedia
     state_vector_t derivative;
     derivative.setZero();
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        derivative += it->computeActivation(this->t_) * it->stateDerivative(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        derivative += term.activation * it->stateDerivative(this->x_, this->u_, this->t_);
     }
 
     return derivative;
@@ -376,13 +460,10 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::stateSecondDerivativeInte
     state_matrix_t derivative;
     derivative.setZero();
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        derivative += it->computeActivation(this->t_) * it->stateSecondDerivative(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        derivative += term.activation * it->stateSecondDerivative(this->x_, this->u_, this->t_);
     }
 
     return derivative;
@@ -409,13 +490,10 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::controlDerivativeIntermed
     control_vector_t derivative;
     derivative.setZero();
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        derivative += it->computeActivation(this->t_) * it->controlDerivative(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        derivative += term.activation * it->controlDerivative(this->x_, this->u_, this->t_);
     }
 
     return derivative;
@@ -442,13 +520,10 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::controlSecondDerivativeIn
     control_matrix_t derivative;
     derivative.setZero();
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        derivative += it->computeActivation(this->t_) * it->controlSecondDerivative(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        derivative += term.activation * it->controlSecondDerivative(this->x_, this->u_, this->t_);
     }
 
     return derivative;
@@ -475,13 +550,10 @@ CostFunctionQuadratic<STATE_DIM, CONTROL_DIM, SCALAR>::stateControlDerivativeInt
     control_state_matrix_t derivative;
     derivative.setZero();
 
-    for (auto it : this->intermediateCostAnalytical_)
+    for (const ActiveTerm& term : activeIntermediateTerms())
     {
-        if (!it->isActiveAtTime(this->t_))
-        {
-            continue;
-        }
-        derivative += it->computeActivation(this->t_) * it->stateControlDerivative(this->x_, this->u_, this->t_);
+        const auto& it = this->intermediateCostAnalytical_[term.index];
+        derivative += term.activation * it->stateControlDerivative(this->x_, this->u_, this->t_);
     }
 
     return derivative;
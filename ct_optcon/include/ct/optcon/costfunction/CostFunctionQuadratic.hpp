@@ -6,7 +6,9 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #pragma once
 
 #include "CostFunction.hpp"
+#include "QuadraticCostModel.hpp"
 #include "term/TermBase.hpp"
+#include "utility/StageGrid.hpp"
 
 namespace ct {
 namespace optcon {
@@ -159,6 +161,15 @@ public:
 	 */
     virtual control_state_matrix_t stateControlDerivativeTerminal();
 
+    /**
+	 * \brief Computes the intermediate-cost value and all first and second order derivatives in one call
+	 *
+	 * The default implementation calls the individual evaluation functions. Cost functions with analytical terms
+	 * overload it to compute all blocks in a single pass over the active terms.
+	 * @param model the quadratic model, overwritten
+	 */
+    virtual void quadraticModelIntermediate(QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model);
+
     //! update the reference state for intermediate cost terms
     virtual void updateReferenceState(const state_vector_t& x_ref);
 
@@ -185,13 +196,43 @@ public:
     //! initialize the cost function (e.g. to be used in CostFunctionAD)
     virtual void initialize();
 
+    /**
+	 * \brief Binds the cost function to a fixed time grid
+	 *
+	 * Precomputes the active intermediate terms and their time activations at every grid point and binds all terms
+	 * to the grid, such that they can precompute e.g. interpolated references. Evaluations at a grid point reuse the
+	 * precomputed values, evaluations at other times are computed as before. Times within a relative tolerance of
+	 * 1e-10 are treated as grid points. Needs to be called again after changing the time activations of terms.
+	 * @param times the sorted grid points, e.g. the stage times of the solver
+	 */
+    virtual void bindToTimeGrid(const core::tpl::TimeArray<SCALAR>& times);
+
+    //! releases the time grid and all precomputed quantities
+    virtual void unbindTimeGrid();
+
 protected:
+    //! an intermediate term active at the current time together with its time activation
+    struct ActiveTerm
+    {
+        size_t index;
+        SCALAR activation;
+    };
+
+    //! the intermediate terms active at the current time, precomputed if the time is a grid point of the bound grid
+    const std::vector<ActiveTerm>& activeIntermediateTerms();
+
+    //! determines the active intermediate terms at all grid points of the bound grid
+    void precomputeActiveTerms();
+
     //! evaluate intermediate analytical cost terms
     SCALAR evaluateIntermediateBase();
 
     //! evaluate terminal analytical cost terms
     SCALAR evaluateTerminalBase();
 
+    //! add the value and all derivatives of the intermediate analytical cost terms to a quadratic model
+    void quadraticModelIntermediateBase(QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR>& model);
+
     //! evaluate intermediate analytical state derivatives
     state_vector_t stateDerivativeIntermediateBase();
 
@@ -239,6 +280,15 @@ protected:
 
     /** list of final cost terms for which analytic derivatives are available */
     std::vector<std::shared_ptr<TermBase<STATE_DIM, CONTROL_DIM, SCALAR>>> finalCostAnalytical_;
+
+    /** the time grid the cost function is bound to, empty if not bound */
+    StageGrid<SCALAR> stageGrid_;
+
+    /** the active intermediate terms at every grid point */
+    std::vector<std::vector<ActiveTerm>> stageActiveTerms_;
+
+    /** the active intermediate terms at the current time if it is not a grid point */
+    std::vector<ActiveTerm> activeTerms_;
 };
 
 
@@ -0,0 +1,46 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+/**
+ * \ingroup CostFunction
+ *
+ * \brief The quadratic approximation of a cost function around a state, control and time
+ *
+ * Holds the cost value and all first and second order derivatives, named as the blocks of the LQOCProblem,
+ * such that all of them can be computed in a single pass over the cost terms.
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = double>
+struct QuadraticCostModel
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    QuadraticCostModel() { setZero(); }
+
+    //! reset the model to zero, e.g. before accumulating terms into it
+    void setZero()
+    {
+        q = SCALAR(0.0);
+        qv.setZero();
+        Q.setZero();
+        rv.setZero();
+        R.setZero();
+        P.setZero();
+    }
+
+    SCALAR q;                                                //!< cost value
+    core::StateVector<STATE_DIM, SCALAR> qv;                 //!< first order derivative w.r.t. the state
+    core::StateMatrix<STATE_DIM, SCALAR> Q;                  //!< second order derivative w.r.t. the state
+    core::ControlVector<CONTROL_DIM, SCALAR> rv;             //!< first order derivative w.r.t. the control
+    core::ControlMatrix<CONTROL_DIM, SCALAR> R;              //!< second order derivative w.r.t. the control
+    core::FeedbackMatrix<STATE_DIM, CONTROL_DIM, SCALAR> P;  //!< mixed derivative w.r.t. control and state
+};
+
+}  // namespace optcon
+}  // namespace ct
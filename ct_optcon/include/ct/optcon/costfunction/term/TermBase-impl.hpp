@@ -18,7 +18,8 @@ TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::TermBase(std::string name
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
-TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::TermBase(const TermBase& arg) : name_(arg.name_), c_i_(arg.c_i_)
+TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::TermBase(const TermBase& arg)
+    : name_(arg.name_), c_i_(arg.c_i_), stageGrid_(arg.stageGrid_)
 {
 }
 
@@ -123,6 +124,42 @@ TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDerivative(
         "or implement the analytical derivatives manually.");
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    model.q += weight * evaluateValue(x, u, t, std::is_same<SCALAR, SCALAR_EVAL>());
+    model.qv += weight * stateDerivative(x, u, t);
+    model.Q += weight * stateSecondDerivative(x, u, t);
+    model.rv += weight * controlDerivative(x, u, t);
+    model.R += weight * controlSecondDerivative(x, u, t);
+    model.P += weight * stateControlDerivative(x, u, t);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+SCALAR_EVAL TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::evaluateValue(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    std::true_type)
+{
+    return evaluate(x, u, t);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+SCALAR_EVAL TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::evaluateValue(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    std::false_type)
+{
+    throw std::runtime_error("The cost function term " + name_ + " cannot be evaluated analytically.");
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
@@ -211,5 +248,18 @@ Eigen::Matrix<SCALAR_EVAL, STATE_DIM, 1> TermBase<STATE_DIM, CONTROL_DIM, SCALAR
 }
 
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::bindToTimeGrid(
+    const core::tpl::TimeArray<SCALAR_EVAL>& times)
+{
+    stageGrid_.set(times);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::unbindTimeGrid()
+{
+    stageGrid_.clear();
+}
+
 }  // namespace optcon
 }  // namespace ct
@@ -10,6 +10,9 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #include <ct/core/common/activations/Activations.h>
 
+#include "../QuadraticCostModel.hpp"
+#include "../utility/StageGrid.hpp"
+
 namespace ct {
 namespace optcon {
 
@@ -34,6 +37,8 @@ protected:
     std::string name_;
     //! time activations for this term
     std::shared_ptr<ct::core::tpl::ActivationBase<SCALAR_EVAL>> c_i_;
+    //! the time grid this term is bound to, empty if not bound
+    StageGrid<SCALAR_EVAL> stageGrid_;
 
 public:
     typedef Eigen::Matrix<SCALAR_EVAL, STATE_DIM, STATE_DIM> state_matrix_t;
@@ -147,6 +152,23 @@ public:
         const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
         const SCALAR_EVAL& t);
 
+    /**
+	 * \brief Adds the weighted value and all first and second order derivatives of this term to a quadratic model
+	 *
+	 * The default implementation calls evaluate() and the derivative functions one after another. Terms can overload
+	 * this function to share intermediate results, e.g. residuals, between the value and the derivatives.
+	 * @param x the current state
+	 * @param u the current control
+	 * @param t the current time
+	 * @param weight the weight of this term, e.g. its time activation
+	 * @param model the model to add to
+	 */
+    virtual void addQuadraticModel(const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+        const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+        const SCALAR_EVAL& t,
+        const SCALAR_EVAL& weight,
+        QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model);
+
     //! load this term from a configuration file
     virtual void loadConfigFile(const std::string& filename, const std::string& termName, bool verbose = false);
 
@@ -176,6 +198,30 @@ public:
 
     //! retrieve this term's current reference state
     virtual Eigen::Matrix<SCALAR_EVAL, STATE_DIM, 1> getReferenceState() const;
+
+    /**
+	 * \brief Binds the term to a fixed time grid
+	 *
+	 * Terms with time dependent quantities, e.g. interpolated references, can overload this function to precompute
+	 * them for every grid point. Evaluations at other times are still supported.
+	 * @param times the sorted grid points
+	 */
+    virtual void bindToTimeGrid(const core::tpl::TimeArray<SCALAR_EVAL>& times);
+
+    //! releases the time grid and all precomputed quantities
+    virtual void unbindTimeGrid();
+
+private:
+    //! evaluates the term in the evaluation scalar type, only possible if it is also the term's scalar type
+    SCALAR_EVAL evaluateValue(const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+        const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+        const SCALAR_EVAL& t,
+        std::true_type);
+
+    SCALAR_EVAL evaluateValue(const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+        const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+        const SCALAR_EVAL& t,
+        std::false_type);
 };
 
 }  // namespace optcon
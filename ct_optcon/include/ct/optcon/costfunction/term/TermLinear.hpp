@@ -71,6 +71,12 @@ public:
         const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
         const SCALAR_EVAL& t) override;
 
+    void addQuadraticModel(const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+        const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+        const SCALAR_EVAL& t,
+        const SCALAR_EVAL& weight,
+        QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model) override;
+
     void loadConfigFile(const std::string& filename,
         const std::string& termName,
         bool verbose = false) override;  // virtual function for data loading
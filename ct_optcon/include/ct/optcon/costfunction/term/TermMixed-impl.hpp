@@ -136,6 +136,24 @@ TermMixed<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDerivative(
     return P_;
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermMixed<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> xDiff = x - x_ref_;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> uDiff = u - u_ref_;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> rv = P_ * xDiff;
+
+    model.q += weight * uDiff.dot(rv);
+    model.qv += weight * P_.transpose() * uDiff;
+    model.rv += weight * rv;
+    model.P += weight * P_;
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermMixed<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
@@ -167,6 +167,33 @@ TermQuadMult<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDerivativ
            (xDiff.transpose() * Q_.transpose() + xDiff.transpose() * Q_);
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadMult<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> xDiff = x - x_ref_;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> uDiff = u - u_ref_;
+    const state_matrix_t Qsym = Q_ + Q_.transpose();
+    const control_matrix_t Rsym = R_ + R_.transpose();
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> dq = Qsym * xDiff;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> dr = Rsym * uDiff;
+
+    // the term is the product q * r of two quadratic forms
+    const SCALAR_EVAL q = SCALAR_EVAL(0.5) * xDiff.dot(dq);
+    const SCALAR_EVAL r = SCALAR_EVAL(0.5) * uDiff.dot(dr);
+
+    model.q += weight * q * r;
+    model.qv += (weight * r) * dq;
+    model.Q += (weight * r) * Qsym;
+    model.rv += (weight * q) * dr;
+    model.R += (weight * q) * Rsym;
+    model.P += weight * dr * dq.transpose();
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermQuadMult<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
@@ -39,6 +39,8 @@ TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::TermQuadTracking(
       R_(arg.R_),
       x_traj_ref_(arg.x_traj_ref_),
       u_traj_ref_(arg.u_traj_ref_),
+      x_ref_stages_(arg.x_ref_stages_),
+      u_ref_stages_(arg.u_ref_stages_),
       trackControlTrajectory_(arg.trackControlTrajectory_)
 {
 }
@@ -71,6 +73,9 @@ void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::setStateAndC
 {
     x_traj_ref_ = xTraj;
     u_traj_ref_ = uTraj;
+
+    if (!this->stageGrid_.empty())
+        precomputeReferences();
 }
 
 
@@ -90,7 +95,7 @@ TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateDerivative(
     const ct::core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
     const SCALAR_EVAL& t)
 {
-    Eigen::Matrix<SCALAR_EVAL, STATE_DIM, 1> xDiff = x - x_traj_ref_.eval(t);
+    Eigen::Matrix<SCALAR_EVAL, STATE_DIM, 1> xDiff = x - stateReference(t);
 
     return xDiff.transpose() * Q_.transpose() + xDiff.transpose() * Q_;
 }
@@ -115,7 +120,7 @@ TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::controlDerivative
     Eigen::Matrix<SCALAR_EVAL, CONTROL_DIM, 1> uDiff;
 
     if (trackControlTrajectory_)
-        uDiff = u - u_traj_ref_.eval(t);
+        uDiff = u - controlReference(t);
     else
         uDiff = u;
 
@@ -142,6 +147,34 @@ TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDeriv
     return control_state_matrix_t::Zero();
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    // the references are looked up once for the value and all derivatives
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> xDiff = x - stateReference(t);
+    core::ControlVector<CONTROL_DIM, SCALAR_EVAL> uDiff;
+    if (trackControlTrajectory_)
+        uDiff = u - controlReference(t);
+    else
+        uDiff = u;
+
+    const state_matrix_t Qsym = Q_ + Q_.transpose();
+    const control_matrix_t Rsym = R_ + R_.transpose();
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> qv = Qsym * xDiff;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> rv = Rsym * uDiff;
+
+    model.q += weight * SCALAR_EVAL(0.5) * (xDiff.dot(qv) + uDiff.dot(rv));
+    model.qv += weight * qv;
+    model.Q += weight * Qsym;
+    model.rv += weight * rv;
+    model.R += weight * Rsym;
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
@@ -155,5 +188,60 @@ void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFi
         std::cout << "Read R as R = \n" << R_ << std::endl;
     }
 }
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::bindToTimeGrid(
+    const core::tpl::TimeArray<SCALAR_EVAL>& times)
+{
+    TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::bindToTimeGrid(times);
+    precomputeReferences();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::unbindTimeGrid()
+{
+    TermBase<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::unbindTimeGrid();
+    x_ref_stages_.clear();
+    u_ref_stages_.clear();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::precomputeReferences()
+{
+    x_ref_stages_.clear();
+    u_ref_stages_.clear();
+
+    // an empty reference cannot be interpolated, it is only looked up once set
+    if (x_traj_ref_.size() == 0 || (trackControlTrajectory_ && u_traj_ref_.size() == 0))
+        return;
+
+    for (size_t k = 0; k < this->stageGrid_.size(); k++)
+    {
+        x_ref_stages_.push_back(x_traj_ref_.eval(this->stageGrid_[k]));
+        if (trackControlTrajectory_)
+            u_ref_stages_.push_back(u_traj_ref_.eval(this->stageGrid_[k]));
+    }
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+core::StateVector<STATE_DIM, SCALAR_EVAL> TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateReference(
+    const SCALAR_EVAL& t)
+{
+    size_t k;
+    if (x_ref_stages_.size() > 0 && this->stageGrid_.find(t, k))
+        return x_ref_stages_[k];
+    return x_traj_ref_.eval(t);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+core::ControlVector<CONTROL_DIM, SCALAR_EVAL>
+TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::controlReference(const SCALAR_EVAL& t)
+{
+    size_t k;
+    if (u_ref_stages_.size() > 0 && this->stageGrid_.find(t, k))
+        return u_ref_stages_[k];
+    return u_traj_ref_.eval(t);
+}
+
 }  // namespace optcon
 }  // namespace ct
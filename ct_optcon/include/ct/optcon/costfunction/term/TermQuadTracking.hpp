@@ -72,11 +72,31 @@ public:
         const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
         const SCALAR_EVAL& t) override;
 
+    void addQuadraticModel(const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+        const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+        const SCALAR_EVAL& t,
+        const SCALAR_EVAL& weight,
+        QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model) override;
+
     virtual void loadConfigFile(const std::string& filename,
         const std::string& termName,
         bool verbose = false) override;
 
+    //! precomputes the interpolated references at the grid points
+    void bindToTimeGrid(const core::tpl::TimeArray<SCALAR_EVAL>& times) override;
+
+    void unbindTimeGrid() override;
+
 protected:
+    //! the state reference at time t, looked up if t is a grid point of the bound time grid
+    core::StateVector<STATE_DIM, SCALAR_EVAL> stateReference(const SCALAR_EVAL& t);
+
+    //! the control reference at time t, looked up if t is a grid point of the bound time grid
+    core::ControlVector<CONTROL_DIM, SCALAR_EVAL> controlReference(const SCALAR_EVAL& t);
+
+    //! interpolates the references at all grid points of the bound time grid
+    void precomputeReferences();
+
     template <typename SC>
     SC evalLocal(const Eigen::Matrix<SC, STATE_DIM, 1>& x, const Eigen::Matrix<SC, CONTROL_DIM, 1>& u, const SC& t);
 
@@ -87,6 +107,10 @@ protected:
     ct::core::StateTrajectory<STATE_DIM, SCALAR_EVAL> x_traj_ref_;
     ct::core::ControlTrajectory<CONTROL_DIM, SCALAR_EVAL> u_traj_ref_;
 
+    // the reference trajectories interpolated at the grid points of the bound time grid
+    ct::core::StateVectorArray<STATE_DIM, SCALAR_EVAL> x_ref_stages_;
+    ct::core::ControlVectorArray<CONTROL_DIM, SCALAR_EVAL> u_ref_stages_;
+
     // Option whether the control trajectory deviation shall be penalized or not
     bool trackControlTrajectory_;
 };
@@ -98,12 +122,12 @@ SC TermQuadTracking<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::evalLocal(cons
     const Eigen::Matrix<SC, CONTROL_DIM, 1>& u,
     const SC& t)
 {
-    Eigen::Matrix<SC, STATE_DIM, 1> xDiff = x - x_traj_ref_.eval((SCALAR_EVAL)t).template cast<SC>();
+    Eigen::Matrix<SC, STATE_DIM, 1> xDiff = x - stateReference((SCALAR_EVAL)t).template cast<SC>();
 
     Eigen::Matrix<SC, CONTROL_DIM, 1> uDiff;
 
     if (trackControlTrajectory_)
-        uDiff = u - u_traj_ref_.eval((SCALAR_EVAL)t).template cast<SC>();
+        uDiff = u - controlReference((SCALAR_EVAL)t).template cast<SC>();
     else
         uDiff = u;
 
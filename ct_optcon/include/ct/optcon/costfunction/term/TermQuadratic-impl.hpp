@@ -191,6 +191,28 @@ TermQuadratic<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDerivati
     return control_state_matrix_t::Zero();
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermQuadratic<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> xDiff = x - x_ref_;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> uDiff = u - u_ref_;
+    const state_matrix_t Qsym = Q_ + Q_.transpose();
+    const control_matrix_t Rsym = R_ + R_.transpose();
+    const core::StateVector<STATE_DIM, SCALAR_EVAL> qv = Qsym * xDiff;
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL> rv = Rsym * uDiff;
+
+    model.q += weight * SCALAR_EVAL(0.5) * (xDiff.dot(qv) + uDiff.dot(rv));
+    model.qv += weight * qv;
+    model.Q += weight * Qsym;
+    model.rv += weight * rv;
+    model.R += weight * Rsym;
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermQuadratic<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
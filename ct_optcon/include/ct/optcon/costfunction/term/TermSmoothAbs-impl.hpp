@@ -130,6 +130,26 @@ TermSmoothAbs<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::stateControlDerivati
     return control_state_matrix_t::Zero();
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
+void TermSmoothAbs<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::addQuadraticModel(
+    const core::StateVector<STATE_DIM, SCALAR_EVAL>& x,
+    const core::ControlVector<CONTROL_DIM, SCALAR_EVAL>& u,
+    const SCALAR_EVAL& t,
+    const SCALAR_EVAL& weight,
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR_EVAL>& model)
+{
+    const Eigen::Array<SCALAR_EVAL, STATE_DIM, 1> xDiff = (x - x_ref_).array();
+    const Eigen::Array<SCALAR_EVAL, CONTROL_DIM, 1> uDiff = (u - u_ref_).array();
+    const Eigen::Array<SCALAR_EVAL, STATE_DIM, 1> xAbs = (xDiff.square() + alphaSquared_).sqrt();
+    const Eigen::Array<SCALAR_EVAL, CONTROL_DIM, 1> uAbs = (uDiff.square() + alphaSquared_).sqrt();
+
+    model.q += weight * ((a_.array() * xAbs).sum() + (b_.array() * uAbs).sum());
+    model.qv += weight * (a_.array() * xDiff / xAbs).matrix();
+    model.Q.diagonal() += weight * (a_.array() * alphaSquared_ / xAbs.cube()).matrix();
+    model.rv += weight * (b_.array() * uDiff / uAbs).matrix();
+    model.R.diagonal() += weight * (b_.array() * alphaSquared_ / uAbs.cube()).matrix();
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR_EVAL, typename SCALAR>
 void TermSmoothAbs<STATE_DIM, CONTROL_DIM, SCALAR_EVAL, SCALAR>::loadConfigFile(const std::string& filename,
     const std::string& termName,
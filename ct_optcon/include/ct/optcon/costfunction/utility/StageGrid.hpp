@@ -0,0 +1,93 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * \ingroup CostFunction
+ *
+ * \brief A fixed time grid a cost function or term is bound to, maps query times to stage indices
+ *
+ * Solvers query a cost function at the same grid points over and over again. Terms and cost functions bound to a
+ * StageGrid precompute time dependent quantities per stage and look them up here. Consecutive queries of the same or
+ * the next stage are found in constant time.
+ */
+template <typename SCALAR>
+class StageGrid
+{
+public:
+    StageGrid() : lastStage_(0) {}
+
+    //! bind to the grid points times, which need to be sorted
+    template <typename TIME_ARRAY>
+    void set(const TIME_ARRAY& times)
+    {
+        times_.assign(times.begin(), times.end());
+        lastStage_ = 0;
+    }
+
+    //! unbind from the grid
+    void clear()
+    {
+        times_.clear();
+        lastStage_ = 0;
+    }
+
+    //! true if not bound to a grid
+    bool empty() const { return times_.empty(); }
+    //! number of stages
+    size_t size() const { return times_.size(); }
+    //! time of stage k
+    const SCALAR& operator[](size_t k) const { return times_[k]; }
+    //! all grid points
+    const std::vector<SCALAR>& times() const { return times_; }
+    /*!
+     * \brief find the stage at time t
+     * @param t query time
+     * @param stage the stage index, if found
+     * @return false if not bound or if t is not a grid point
+     */
+    bool find(const SCALAR& t, size_t& stage)
+    {
+        if (times_.empty())
+            return false;
+
+        if (matches(lastStage_, t))
+        {
+            stage = lastStage_;
+            return true;
+        }
+        if (lastStage_ + 1 < times_.size() && matches(lastStage_ + 1, t))
+        {
+            stage = ++lastStage_;
+            return true;
+        }
+
+        const size_t k = std::lower_bound(times_.begin(), times_.end(), t - tolerance(t)) - times_.begin();
+        if (k == times_.size() || !matches(k, t))
+            return false;
+
+        stage = lastStage_ = k;
+        return true;
+    }
+
+private:
+    //! grid points are compared with a relative tolerance, as solvers compute stage times as k * dt
+    static SCALAR tolerance(const SCALAR& t) { return SCALAR(1e-10) * std::max(SCALAR(1.0), SCALAR(std::abs(t))); }
+    bool matches(size_t k, const SCALAR& t) const { return std::abs(times_[k] - t) <= tolerance(t); }
+
+    std::vector<SCALAR> times_;
+    size_t lastStage_;  //!< the stage found last, usually queries proceed stage by stage
+};
+
+}  // namespace optcon
+}  // namespace ct
@@ -37,20 +37,34 @@ ConstraintsContainerDms<STATE_DIM, CONTROL_DIM, SCALAR>::ConstraintsContainerDms
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 void ConstraintsContainerDms<STATE_DIM, CONTROL_DIM, SCALAR>::prepareEvaluation()
 {
-#pragma omp parallel for num_threads(settings_.nThreads_)
-    for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+#pragma omp parallel num_threads(settings_.nThreads_)
     {
-        (*shotContainer)->integrateShot();
+#ifdef _OPENMP
+        ct::core::pinPoolWorker(settings_.workerCores_, omp_get_thread_num());
+#endif
+        // a static schedule keeps every shot on the same thread
+#pragma omp for schedule(static)
+        for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+        {
+            (*shotContainer)->integrateShot();
+        }
     }
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 void ConstraintsContainerDms<STATE_DIM, CONTROL_DIM, SCALAR>::prepareJacobianEvaluation()
 {
-#pragma omp parallel for num_threads(settings_.nThreads_)
-    for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+#pragma omp parallel num_threads(settings_.nThreads_)
     {
-        (*shotContainer)->integrateSensitivities();
+#ifdef _OPENMP
+        ct::core::pinPoolWorker(settings_.workerCores_, omp_get_thread_num());
+#endif
+        // a static schedule keeps every shot on the same thread
+#pragma omp for schedule(static)
+        for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+        {
+            (*shotContainer)->integrateSensitivities();
+        }
     }
 }
 
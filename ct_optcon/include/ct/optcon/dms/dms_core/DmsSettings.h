@@ -37,6 +37,7 @@ public:
         : N_(30),
           T_(5),
           nThreads_(1),
+          workerCores_(),
           splineType_(ZERO_ORDER_HOLD),
           costEvaluationType_(SIMPLE),
           objectiveType_(KEEP_TIME_AND_GRID),
@@ -51,6 +52,7 @@ public:
     size_t N_;                                 // the number of shots
     double T_;                                 // the time horizon
     size_t nThreads_;                          // number of threads
+    std::vector<int> workerCores_;             // thread i > 0 is pinned to workerCores_[i % size], the caller is not
     SplineType_t splineType_;                  // spline interpolation type between the nodes
     CostEvaluationType_t costEvaluationType_;  // the the of costevaluator
     ObjectiveType_t objectiveType_;            // Timegrid optimization on(expensive) or off?
@@ -72,6 +74,10 @@ public:
         std::cout << "Shooting intervals N : " << N_ << std::endl;
         std::cout << "Total Time horizon: " << T_ << "s" << std::endl;
         std::cout << "Number of threads: " << nThreads_ << std::endl;
+        std::cout << "Worker cores: ";
+        for (int core : workerCores_)
+            std::cout << core << " ";
+        std::cout << std::endl;
         std::cout << "Splinetype: " << splineToString[splineType_] << std::endl;
         std::cout << "Cost eval: " << costEvalToString[costEvaluationType_] << std::endl;
         std::cout << "Objective type: " << objTypeToString[objectiveType_] << std::endl;
@@ -132,6 +138,7 @@ public:
         N_ = pt.get<unsigned int>(ns + ".N");
         T_ = pt.get<double>(ns + ".T");
         nThreads_ = pt.get<unsigned int>(ns + ".nThreads");
+        workerCores_ = ct::core::parseCoreList(pt.get<std::string>(ns + ".workerCores", ""));
         splineType_ = static_cast<SplineType_t>(pt.get<unsigned int>(ns + ".InterpolationType"));
         costEvaluationType_ = static_cast<CostEvaluationType_t>(pt.get<unsigned int>(ns + ".CostEvaluationType"));
         objectiveType_ = static_cast<ObjectiveType_t>(pt.get<unsigned int>(ns + ".ObjectiveType"));
@@ -71,10 +71,16 @@ public:
     {
         SCALAR cost = SCALAR(0.0);
 
-#pragma omp parallel for num_threads(settings_.nThreads_)
-        for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+#pragma omp parallel num_threads(settings_.nThreads_)
         {
-            (*shotContainer)->integrateCost();
+#ifdef _OPENMP
+            ct::core::pinPoolWorker(settings_.workerCores_, omp_get_thread_num());
+#endif
+#pragma omp for schedule(static)
+            for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+            {
+                (*shotContainer)->integrateCost();
+            }
         }
 
         for (auto shotContainer : shotContainers_)
@@ -93,10 +99,16 @@ public:
 
 // go through all shots, integrate the state trajectories and evaluate cost accordingly
 // intermediate costs
-#pragma omp parallel for num_threads(settings_.nThreads_)
-        for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+#pragma omp parallel num_threads(settings_.nThreads_)
         {
-            (*shotContainer)->integrateCostSensitivities();
+#ifdef _OPENMP
+            ct::core::pinPoolWorker(settings_.workerCores_, omp_get_thread_num());
+#endif
+#pragma omp for schedule(static)
+            for (auto shotContainer = shotContainers_.begin(); shotContainer < shotContainers_.end(); ++shotContainer)
+            {
+                (*shotContainer)->integrateCostSensitivities();
+            }
         }
 
         for (size_t shotNr = 0; shotNr < shotContainers_.size(); ++shotNr)
@@ -18,7 +18,8 @@ CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::CTSystemModel(
       constantController_(new ct::core::ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>()),
       sensApprox_(sensApprox),
       dFdv_(dFdv),
-      integrator_(system_, intType)
+      integrator_(system_, intType),
+      intType_(intType)
 {
     if (!system_)
         throw std::runtime_error("CTSystemModel: System not initialized!");
@@ -39,6 +40,90 @@ auto CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDynamics(const state_
     return x;
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDynamicsBatch(Eigen::Ref<state_batch_t> states,
+    const control_vector_t& u,
+    const Time_t dt,
+    Time_t t)
+{
+    if (!threadPool_)
+    {
+        Base::computeDynamicsBatch(states, u, dt, t);
+        return;
+    }
+
+    constantController_->setControl(u);
+    for (size_t i = 1; i < controllerClones_.size(); i++)
+        controllerClones_[i]->setControl(u);
+
+    threadPool_->parallelFor(states.cols(), [&](size_t threadId, size_t i) {
+        state_vector_t x = states.col(i);
+        if (threadId == 0)
+            integrator_.integrate_n_steps(x, t, 1, dt);
+        else
+            integratorClones_[threadId]->integrate_n_steps(x, t, 1, dt);
+        states.col(i) = x;
+    });
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDynamicsBatchPerControl(Eigen::Ref<state_batch_t> states,
+    const control_batch_t& controls,
+    const Time_t dt,
+    Time_t t)
+{
+    const Eigen::Index groupSize = controls.cols() > 0 ? states.cols() / controls.cols() : 0;
+    assert(groupSize * controls.cols() == states.cols());
+
+    if (!threadPool_)
+    {
+        for (Eigen::Index i = 0; i < states.cols(); ++i)
+            states.col(i) = computeDynamics(states.col(i), controls.col(i / groupSize), dt, t);
+        return;
+    }
+
+    // every thread sets the control of the state it propagates on its own controller
+    threadPool_->parallelFor(states.cols(), [&](size_t threadId, size_t i) {
+        ct::core::ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>& controller =
+            threadId == 0 ? *constantController_ : *controllerClones_[threadId];
+        ct::core::Integrator<STATE_DIM, SCALAR>& integrator =
+            threadId == 0 ? integrator_ : *integratorClones_[threadId];
+
+        controller.setControl(controls.col(i / groupSize));
+        state_vector_t x = states.col(i);
+        integrator.integrate_n_steps(x, t, 1, dt);
+        states.col(i) = x;
+    });
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::setNumThreads(size_t nThreads)
+{
+    systemClones_.clear();
+    controllerClones_.clear();
+    integratorClones_.clear();
+
+    if (nThreads <= 1)
+    {
+        threadPool_.reset();
+        return;
+    }
+
+    systemClones_.resize(nThreads);
+    controllerClones_.resize(nThreads);
+    integratorClones_.resize(nThreads);
+
+    for (size_t i = 1; i < nThreads; i++)
+    {
+        systemClones_[i].reset(system_->clone());
+        controllerClones_[i].reset(new ct::core::ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>());
+        systemClones_[i]->setController(controllerClones_[i]);
+        integratorClones_[i].reset(new ct::core::Integrator<STATE_DIM, SCALAR>(systemClones_[i], intType_));
+    }
+
+    threadPool_.reset(new ct::core::ThreadPool(nThreads));
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 auto CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDerivativeState(const state_vector_t& state,
     const control_vector_t& u,
@@ -64,5 +149,16 @@ auto CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDerivativeNoise(const
     return dFdv_;
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void CTSystemModel<STATE_DIM, CONTROL_DIM, SCALAR>::computeDerivativeNoiseBatch(
+    const Eigen::Ref<const state_batch_t>& states,
+    const control_batch_t& controls,
+    const Time_t dt,
+    Time_t t,
+    Eigen::Ref<state_matrix_batch_t> derivatives)
+{
+    derivatives = dFdv_.replicate(1, states.cols());
+}
+
 }  // namespace optcon
 }  // namespace ct
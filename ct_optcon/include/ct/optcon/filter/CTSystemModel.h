@@ -33,6 +33,9 @@ public:
     using typename Base::state_matrix_t;
     using typename Base::state_vector_t;
     using typename Base::Time_t;
+    using typename Base::state_batch_t;
+    using typename Base::control_batch_t;
+    using typename Base::state_matrix_batch_t;
 
     using SensitivityApprox_t =
         ct::core::SensitivityApproximation<STATE_DIM, CONTROL_DIM, STATE_DIM / 2, STATE_DIM / 2, SCALAR>;
@@ -49,6 +52,25 @@ public:
         const Time_t dt,
         Time_t t) override;
 
+    //! Propagates a batch of states, distributed over the worker threads (see setNumThreads()).
+    void computeDynamicsBatch(Eigen::Ref<state_batch_t> states,
+        const control_vector_t& u,
+        const Time_t dt,
+        Time_t t) override;
+
+    //! Propagates a batch of states with one control per group, distributed over the worker threads.
+    void computeDynamicsBatchPerControl(Eigen::Ref<state_batch_t> states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t) override;
+
+    //! Set the number of threads used for batch propagation
+    /*!
+     * Every additional thread works on its own clone of the system, hence the system needs to implement clone().
+     * @param nThreads total number of threads, 1 disables parallel propagation
+     */
+    void setNumThreads(size_t nThreads);
+
     //! Computes the derivative w.r.t state. Control input is generated by the system controller.
     state_matrix_t computeDerivativeState(const state_vector_t& state,
         const control_vector_t& u,
@@ -61,6 +83,13 @@ public:
         const Time_t dt,
         Time_t t) override;
 
+    //! The derivative w.r.t. noise is constant, it is copied into every block.
+    void computeDerivativeNoiseBatch(const Eigen::Ref<const state_batch_t>& states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t,
+        Eigen::Ref<state_matrix_batch_t> derivatives) override;
+
 protected:
     //! The underlying CT system.
     std::shared_ptr<ct::core::ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>> system_;
@@ -76,6 +105,17 @@ protected:
 
     //! Integrator.
     ct::core::Integrator<STATE_DIM, SCALAR> integrator_;
+
+    //! Integration type, required to set up the integrators of the worker threads.
+    ct::core::IntegrationType intType_;
+
+    //! Thread pool for batch propagation, only allocated for more than one thread.
+    std::shared_ptr<ct::core::ThreadPool> threadPool_;
+
+    //! Clones of the system, controller and integrator for the worker threads (index 0 is unused).
+    std::vector<std::shared_ptr<ct::core::ControlledSystem<STATE_DIM, CONTROL_DIM, SCALAR>>> systemClones_;
+    std::vector<std::shared_ptr<ct::core::ConstantController<STATE_DIM, CONTROL_DIM, SCALAR>>> controllerClones_;
+    std::vector<std::shared_ptr<ct::core::Integrator<STATE_DIM, SCALAR>>> integratorClones_;
 };
 
 }  // namespace optcon
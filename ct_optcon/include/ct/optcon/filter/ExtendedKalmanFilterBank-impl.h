@@ -0,0 +1,117 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+ExtendedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::ExtendedKalmanFilterBank(
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+    const state_matrix_t& Q,
+    const output_matrix_t& R,
+    const size_t nInstances,
+    const state_vector_t& x0,
+    const state_matrix_t& P0)
+    : f_(f),
+      h_(h),
+      Q_(Q),
+      R_(R),
+      states_(x0.replicate(1, nInstances)),
+      covariances_(P0.replicate(1, nInstances)),
+      predictedOutputs_(OUTPUT_DIM, nInstances),
+      dFdx_(STATE_DIM, nInstances * STATE_DIM),
+      dFdv_(STATE_DIM, nInstances * STATE_DIM)
+{
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto ExtendedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::predict(const control_batch_t& u,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    if (static_cast<size_t>(u.cols()) != getNumInstances())
+        throw std::runtime_error("ExtendedKalmanFilterBank: number of controls does not match number of instances.");
+
+    // the system is linearized at the current control input, but using the previous state estimate
+    f_->computeDerivativeStateBatch(states_, u, dt, t, dFdx_);
+    f_->computeDerivativeNoiseBatch(states_, u, dt, t, dFdv_);
+
+    for (size_t i = 0; i < getNumInstances(); ++i)
+    {
+        auto P = covariances_.template middleCols<STATE_DIM>(i * STATE_DIM);
+        const auto dFdx = dFdx_.template middleCols<STATE_DIM>(i * STATE_DIM);
+        const auto dFdv = dFdv_.template middleCols<STATE_DIM>(i * STATE_DIM);
+
+        P = (dFdx * P * dFdx.transpose()).eval() + dFdv * (dt * Q_) * dFdv.transpose();
+    }
+
+    f_->computeDynamicsBatchPerControl(states_, u, dt, t);
+
+    return states_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto ExtendedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update(const output_batch_t& y,
+    const mask_t& mask,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    if (static_cast<size_t>(y.cols()) != getNumInstances() || static_cast<size_t>(mask.size()) != getNumInstances())
+        throw std::runtime_error(
+            "ExtendedKalmanFilterBank: number of measurements does not match number of instances.");
+
+    // predict the measurements of each run of consecutive flagged instances at once, masked instances are skipped
+    for (size_t begin = 0; begin < getNumInstances();)
+    {
+        if (!mask(begin))
+        {
+            ++begin;
+            continue;
+        }
+        size_t end = begin + 1;
+        while (end < getNumInstances() && mask(end))
+            ++end;
+
+        auto outputs = predictedOutputs_.middleCols(begin, end - begin);
+        h_->computeMeasurementBatch(states_.middleCols(begin, end - begin), outputs, t);
+        begin = end;
+    }
+
+    for (size_t i = 0; i < getNumInstances(); ++i)
+    {
+        if (!mask(i))
+            continue;
+
+        const state_vector_t x = states_.col(i);
+        auto P = covariances_.template middleCols<STATE_DIM>(i * STATE_DIM);
+
+        const ct::core::OutputStateMatrix<OUTPUT_DIM, STATE_DIM, SCALAR> dHdx = h_->computeDerivativeState(x, t);
+        const output_matrix_t dHdw = h_->computeDerivativeNoise(x, t);
+
+        // Kalman gain from the symmetric positive definite innovation covariance
+        const Eigen::Matrix<SCALAR, OUTPUT_DIM, STATE_DIM> HP = dHdx * P;
+        const Eigen::Matrix<SCALAR, OUTPUT_DIM, OUTPUT_DIM> S = HP * dHdx.transpose() + dHdw * R_ * dHdw.transpose();
+        const Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> K = S.llt().solve(HP).transpose();
+
+        states_.col(i) += K * (y.col(i) - predictedOutputs_.col(i));
+        P -= K * HP;
+    }
+
+    return states_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto ExtendedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update(const output_batch_t& y,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    return update(y, mask_t::Constant(getNumInstances(), true), dt, t);
+}
+
+}  // namespace optcon
+}  // namespace ct
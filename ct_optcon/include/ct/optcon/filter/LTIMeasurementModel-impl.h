@@ -32,6 +32,15 @@ LTIMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>::computeMeasurement(
     return dHdx_ * state;
 }
 
+template <size_t OUTPUT_DIM, size_t STATE_DIM, typename SCALAR>
+void LTIMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>::computeMeasurementBatch(
+    const Eigen::Ref<const state_batch_t>& states,
+    Eigen::Ref<output_batch_t> outputs,
+    const Time_t& t)
+{
+    outputs.noalias() = dHdx_ * states;
+}
+
 template <size_t OUTPUT_DIM, size_t STATE_DIM, typename SCALAR>
 typename LTIMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>::output_state_matrix_t
 LTIMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>::computeDerivativeState(
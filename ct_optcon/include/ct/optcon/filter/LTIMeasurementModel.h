@@ -32,6 +32,8 @@ public:
     using typename Base::output_vector_t;
     using typename Base::state_vector_t;
     using typename Base::Time_t;
+    using typename Base::state_batch_t;
+    using typename Base::output_batch_t;
 
     //! Default constructor.
     LTIMeasurementModel();
@@ -42,6 +44,11 @@ public:
     //! Calculates the measurement from the current state.
     output_vector_t computeMeasurement(const state_vector_t& state, const Time_t& t = 0) override;
 
+    //! Calculates all measurements of a batch with a single matrix product.
+    void computeMeasurementBatch(const Eigen::Ref<const state_batch_t>& states,
+        Eigen::Ref<output_batch_t> outputs,
+        const Time_t& t = 0) override;
+
     //! Returns matrix C.
     output_state_matrix_t computeDerivativeState(const state_vector_t& state, const Time_t& t) override;
 
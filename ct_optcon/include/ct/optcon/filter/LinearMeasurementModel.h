@@ -29,9 +29,22 @@ public:
     using typename Base::Time_t;
     using output_matrix_t = ct::core::OutputMatrix<OUTPUT_DIM, SCALAR>;
     using output_state_matrix_t = ct::core::OutputStateMatrix<OUTPUT_DIM, STATE_DIM, SCALAR>;
+    using state_batch_t = Eigen::Matrix<SCALAR, STATE_DIM, Eigen::Dynamic>;
+    using output_batch_t = Eigen::Matrix<SCALAR, OUTPUT_DIM, Eigen::Dynamic>;
 
     //! Calculates the measurement from the current state.
     virtual output_vector_t computeMeasurement(const state_vector_t& state, const Time_t& t = 0) = 0;
+    //! Calculates the measurements for a batch of states (e.g. sigma points), stored column-wise.
+    /*!
+     * The default implementation evaluates the columns one by one, derived models may vectorize it.
+     */
+    virtual void computeMeasurementBatch(const Eigen::Ref<const state_batch_t>& states,
+        Eigen::Ref<output_batch_t> outputs,
+        const Time_t& t = 0)
+    {
+        for (Eigen::Index i = 0; i < states.cols(); ++i)
+            outputs.col(i) = computeMeasurement(states.col(i), t);
+    }
     //! Computes the derivative of the output w.r.t. the state.
     virtual output_state_matrix_t computeDerivativeState(const state_vector_t& state, const Time_t& t) = 0;
     //! Computes the derivative of the output w.r.t. the noise.
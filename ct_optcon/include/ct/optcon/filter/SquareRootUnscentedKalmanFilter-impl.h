@@ -0,0 +1,241 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::SquareRootUnscentedKalmanFilter(
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+    const state_vector_t& x0,
+    SCALAR alpha,
+    SCALAR beta,
+    SCALAR kappa,
+    const ct::core::StateMatrix<STATE_DIM, SCALAR>& P0)
+    : Base(f, h, x0), alpha_(alpha), beta_(beta), kappa_(kappa)
+{
+    setCovariance(P0);
+    computeWeights();
+
+    // NaN never compares equal, hence the noise square roots get computed on first use
+    Q_.setConstant(std::numeric_limits<SCALAR>::quiet_NaN());
+    R_.setConstant(std::numeric_limits<SCALAR>::quiet_NaN());
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::SquareRootUnscentedKalmanFilter(
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+    const UnscentedKalmanFilterSettings<STATE_DIM, SCALAR>& ukf_settings)
+    : SquareRootUnscentedKalmanFilter(f,
+          h,
+          ukf_settings.x0,
+          ukf_settings.alpha,
+          ukf_settings.beta,
+          ukf_settings.kappa,
+          ukf_settings.P0)
+{
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::predict(const control_vector_t& u,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_vector_t&
+{
+    computeSigmaPoints();
+
+    // Pass all sigma points through the state transition function
+    this->f_->computeDynamicsBatch(sigmaStatePoints_, u, dt, t);
+
+    this->x_est_ = sigmaStatePoints_ * sigmaWeights_m_;
+
+    updateNoiseSquareRoot<STATE_DIM>(this->f_->computeDerivativeNoise(this->x_est_, u, dt, t), Q_, Q_sqrt_);
+    computeSquareRootFromSigmaPoints<STATE_DIM>(this->x_est_, sigmaStatePoints_, Q_sqrt_, S_);
+
+    return this->x_est_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update(const output_vector_t& z,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_vector_t&
+{
+    // Re-draw the sigma points, such that they include the process noise (no factorization required)
+    computeSigmaPoints();
+
+    SigmaPoints<OUTPUT_DIM> sigmaMeasurementPoints;
+    this->h_->computeMeasurementBatch(sigmaStatePoints_, sigmaMeasurementPoints, t);
+    output_vector_t y = sigmaMeasurementPoints * sigmaWeights_m_;
+
+    // Square root of the innovation covariance
+    updateNoiseSquareRoot<OUTPUT_DIM>(this->h_->computeDerivativeNoise(this->x_est_, t), R_, R_sqrt_);
+    output_matrix_t S_y;
+    computeSquareRootFromSigmaPoints<OUTPUT_DIM>(y, sigmaMeasurementPoints, R_sqrt_, S_y);
+
+    // Cross covariance
+    Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> P_xy =
+        ((sigmaStatePoints_.colwise() - this->x_est_) * sigmaWeights_c_.asDiagonal()) *
+        (sigmaMeasurementPoints.colwise() - y).transpose();
+
+    // Kalman gain K = P_xy * (S_y * S_y^T)^-1 by two triangular solves
+    Eigen::Matrix<SCALAR, OUTPUT_DIM, STATE_DIM> K_t =
+        S_y.template triangularView<Eigen::Lower>().solve(P_xy.transpose());
+    S_y.transpose().template triangularView<Eigen::Upper>().solveInPlace(K_t);
+    Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> K = K_t.transpose();
+
+    // Update state
+    this->x_est_ += K * (z - y);
+
+    // Update covariance square root by successive downdates with the columns of K * S_y
+    Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> U = K * S_y;
+    for (size_t i = 0; i < OUTPUT_DIM; ++i)
+        choleskyUpdate<STATE_DIM>(S_, U.col(i), SCALAR(-1.0));
+
+    return this->x_est_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::getCovarianceSquareRoot() const
+    -> const state_matrix_t&
+{
+    return S_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::getCovariance() const
+    -> state_matrix_t
+{
+    return S_ * S_.transpose();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::setCovariance(
+    const state_matrix_t& P)
+{
+    CovarianceSquareRoot<STATE_DIM> llt(P);
+    if (llt.info() != Eigen::Success)
+        throw std::runtime_error("SquareRootUnscentedKalmanFilter : Covariance is not positive definite.");
+
+    S_ = llt.matrixL().toDenseMatrix();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::computeWeights()
+{
+    SCALAR L = SCALAR(STATE_DIM);
+    lambda_ = alpha_ * alpha_ * (L + kappa_) - L;
+    gamma_ = std::sqrt(L + lambda_);
+
+    // Make sure L != -lambda_ to avoid division by zero
+    assert(std::abs(L + lambda_) > 1e-6);
+
+    SCALAR W_m_0 = lambda_ / (L + lambda_);
+    SCALAR W_c_0 = W_m_0 + (SCALAR(1) - alpha_ * alpha_ + beta_);
+    SCALAR W_i = SCALAR(1) / (SCALAR(2) * (L + lambda_));
+
+    // The square-root form requires W_i > 0
+    if (W_i <= SCALAR(0))
+        throw std::runtime_error("SquareRootUnscentedKalmanFilter : Sigma point weights must be positive.");
+
+    sigmaWeights_m_.setConstant(W_i);
+    sigmaWeights_c_.setConstant(W_i);
+    sigmaWeights_m_[0] = W_m_0;
+    sigmaWeights_c_[0] = W_c_0;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::computeSigmaPoints()
+{
+    sigmaStatePoints_.template leftCols<1>() = this->x_est_;
+    sigmaStatePoints_.template block<STATE_DIM, STATE_DIM>(0, 1) = (gamma_ * S_).colwise() + this->x_est_;
+    sigmaStatePoints_.template rightCols<STATE_DIM>() = (-gamma_ * S_).colwise() + this->x_est_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+template <size_t SIZE>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::updateNoiseSquareRoot(
+    const Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseCov,
+    Eigen::Matrix<SCALAR, SIZE, SIZE>& lastNoiseCov,
+    Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseSqrt)
+{
+    if (noiseCov == lastNoiseCov)
+        return;
+
+    lastNoiseCov = noiseCov;
+
+    Eigen::LLT<Eigen::Matrix<SCALAR, SIZE, SIZE>> llt(noiseCov);
+    if (llt.info() == Eigen::Success)
+    {
+        noiseSqrt = llt.matrixL().toDenseMatrix();
+        return;
+    }
+
+    // semi-definite noise (e.g. zero): any square root M with M * M^T = noiseCov does
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix<SCALAR, SIZE, SIZE>> eig(noiseCov);
+    noiseSqrt = eig.eigenvectors() * eig.eigenvalues().cwiseMax(SCALAR(0)).cwiseSqrt().asDiagonal();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+template <size_t SIZE>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::computeSquareRootFromSigmaPoints(
+    const Eigen::Matrix<SCALAR, SIZE, 1>& mean,
+    const SigmaPoints<SIZE>& sigmaPoints,
+    const Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseSqrt,
+    Eigen::Matrix<SCALAR, SIZE, SIZE>& S)
+{
+    // compound matrix [sqrt(W_i) * (X_i - mean), noiseSqrt]^T, whose R-factor is the transposed square root
+    Eigen::Matrix<SCALAR, 2 * STATE_DIM + SIZE, SIZE> A;
+    A.template topRows<2 * STATE_DIM>() =
+        (std::sqrt(sigmaWeights_c_[1]) * (sigmaPoints.template rightCols<2 * STATE_DIM>().colwise() - mean))
+            .transpose();
+    A.template bottomRows<SIZE>() = noiseSqrt.transpose();
+
+    Eigen::HouseholderQR<Eigen::Matrix<SCALAR, 2 * STATE_DIM + SIZE, SIZE>> qr(A);
+    S = qr.matrixQR().template topRows<SIZE>().template triangularView<Eigen::Upper>().transpose();
+
+    // the factorization is unique up to the signs of the columns, we choose a positive diagonal
+    for (size_t i = 0; i < SIZE; ++i)
+        if (S(i, i) < SCALAR(0))
+            S.col(i) *= SCALAR(-1.0);
+
+    // the center point is weighted separately since its weight may be negative
+    choleskyUpdate<SIZE>(S, sigmaPoints.col(0) - mean, sigmaWeights_c_[0]);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+template <size_t SIZE>
+void SquareRootUnscentedKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::choleskyUpdate(
+    Eigen::Matrix<SCALAR, SIZE, SIZE>& S,
+    Eigen::Matrix<SCALAR, SIZE, 1> v,
+    SCALAR sigma)
+{
+    const SCALAR sign = (sigma < SCALAR(0)) ? SCALAR(-1.0) : SCALAR(1.0);
+    v *= std::sqrt(std::abs(sigma));
+
+    for (size_t k = 0; k < SIZE; ++k)
+    {
+        const SCALAR r2 = S(k, k) * S(k, k) + sign * v(k) * v(k);
+        if (!(r2 > SCALAR(0)))
+            throw std::runtime_error("SquareRootUnscentedKalmanFilter : Covariance lost positive definiteness.");
+
+        const SCALAR r = std::sqrt(r2);
+        const SCALAR c = r / S(k, k);
+        const SCALAR s = v(k) / S(k, k);
+        S(k, k) = r;
+
+        const size_t n = SIZE - k - 1;
+        if (n > 0)
+        {
+            S.col(k).tail(n) = (S.col(k).tail(n) + sign * s * v.tail(n)) / c;
+            v.tail(n) = c * v.tail(n) - s * S.col(k).tail(n);
+        }
+    }
+}
+
+}  // namespace optcon
+}  // namespace ct
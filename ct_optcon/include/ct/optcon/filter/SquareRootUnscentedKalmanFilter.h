@@ -0,0 +1,124 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <limits>
+
+#include "UnscentedKalmanFilter.h"
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * \ingroup Filter
+ *
+ * \brief Square-root formulation of the Unscented Kalman Filter.
+ *
+ * Instead of the state covariance P, this filter propagates its lower Cholesky factor S (with P = S * S^T). The
+ * factor is updated by QR decompositions and rank-one Cholesky updates / downdates, hence the covariance never
+ * needs to be re-factorized when drawing sigma points, and it stays symmetric positive definite by construction.
+ * The noise covariances provided by the system and measurement models are only factorized when they change.
+ *
+ * Reference: R. van der Merwe, E. Wan, "The square-root unscented Kalman filter for state and parameter-estimation",
+ * ICASSP 2001.
+ *
+ * @tparam STATE_DIM
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR = double>
+class SquareRootUnscentedKalmanFilter final : public EstimatorBase<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    using Base = EstimatorBase<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>;
+    using typename Base::control_vector_t;
+    using typename Base::output_matrix_t;
+    using typename Base::output_vector_t;
+    using typename Base::state_matrix_t;
+    using typename Base::state_vector_t;
+
+    static constexpr size_t SigmaPointCount = 2 * STATE_DIM + 1;
+
+    template <size_t SIZE>
+    using SigmaPoints = Eigen::Matrix<SCALAR, SIZE, SigmaPointCount>;
+
+    template <size_t SIZE>
+    using CovarianceSquareRoot = Cholesky<Eigen::Matrix<SCALAR, SIZE, SIZE>>;
+
+    //! Constructor.
+    SquareRootUnscentedKalmanFilter(std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+        std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+        const state_vector_t& x0 = state_vector_t::Zero(),
+        SCALAR alpha = SCALAR(1.0),
+        SCALAR beta = SCALAR(2.0),
+        SCALAR kappa = SCALAR(0.0),
+        const ct::core::StateMatrix<STATE_DIM, SCALAR>& P0 = ct::core::StateMatrix<STATE_DIM, SCALAR>::Identity());
+
+    //! Constructor from settings.
+    SquareRootUnscentedKalmanFilter(std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+        std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+        const UnscentedKalmanFilterSettings<STATE_DIM, SCALAR>& ukf_settings);
+
+    //! Estimator predict method.
+    const state_vector_t& predict(const control_vector_t& u,
+        const ct::core::Time& dt,
+        const ct::core::Time& t) override;
+
+    //! Estimator update method.
+    const state_vector_t& update(const output_vector_t& y, const ct::core::Time& dt, const ct::core::Time& t) override;
+
+    //! Get the lower Cholesky factor of the state covariance.
+    const state_matrix_t& getCovarianceSquareRoot() const;
+
+    //! Get the state covariance (computed from its square root).
+    state_matrix_t getCovariance() const;
+
+    //! Set the state covariance, which gets factorized once.
+    void setCovariance(const state_matrix_t& P);
+
+private:
+    //! Compute weights of sigma points.
+    void computeWeights();
+
+    //! Compute sigma points from the current state and covariance square root estimates.
+    void computeSigmaPoints();
+
+    //! Compute the square root of a noise covariance, re-using the previous factorization if it is unchanged.
+    template <size_t SIZE>
+    void updateNoiseSquareRoot(const Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseCov,
+        Eigen::Matrix<SCALAR, SIZE, SIZE>& lastNoiseCov,
+        Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseSqrt);
+
+    //! Compute the lower Cholesky factor of the covariance of sigma points plus additive noise.
+    template <size_t SIZE>
+    void computeSquareRootFromSigmaPoints(const Eigen::Matrix<SCALAR, SIZE, 1>& mean,
+        const SigmaPoints<SIZE>& sigmaPoints,
+        const Eigen::Matrix<SCALAR, SIZE, SIZE>& noiseSqrt,
+        Eigen::Matrix<SCALAR, SIZE, SIZE>& S);
+
+    //! Rank-one update (sigma > 0) or downdate (sigma < 0) of the lower Cholesky factor S with sigma * v * v^T.
+    template <size_t SIZE>
+    static void choleskyUpdate(Eigen::Matrix<SCALAR, SIZE, SIZE>& S, Eigen::Matrix<SCALAR, SIZE, 1> v, SCALAR sigma);
+
+    state_matrix_t S_;                                          //! Lower Cholesky factor of the covariance.
+    Eigen::Matrix<SCALAR, SigmaPointCount, 1> sigmaWeights_m_;  //! Sigma measurement weights.
+    Eigen::Matrix<SCALAR, SigmaPointCount, 1> sigmaWeights_c_;  //! Sigma covariance weights.
+    SigmaPoints<STATE_DIM> sigmaStatePoints_;                   //! Sigma points.
+
+    state_matrix_t Q_;      //! Last process noise covariance.
+    state_matrix_t Q_sqrt_;  //! Square root of the last process noise covariance.
+    output_matrix_t R_;      //! Last measurement noise covariance.
+    output_matrix_t R_sqrt_;  //! Square root of the last measurement noise covariance.
+
+    SCALAR alpha_;   //! Scaling parameter for spread of sigma points (usually \f$ 1E-4 \leq \alpha \leq 1 \f$)
+    SCALAR beta_;    //! Parameter for prior knowledge about the distribution (\f$ \beta = 2 \f$ is optimal for Gaussian)
+    SCALAR kappa_;   //! Secondary scaling parameter (usually 0)
+    SCALAR gamma_;   //! \f$ \gamma = \sqrt{L + \lambda} \f$ with \f$ L \f$ being the state dimensionality
+    SCALAR lambda_;  //! \f$ \lambda = \alpha^2 ( L + \kappa ) - L\f$ with \f$ L \f$ being the state dimensionality
+};
+
+}  // namespace optcon
+}  // namespace ct
@@ -16,7 +16,7 @@ SteadyStateKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::SteadyState
     const output_matrix_t& R,
     const state_vector_t& x0,
     size_t maxDAREIterations)
-    : Base(f, h, x0), Q_(Q), R_(R), maxDAREIterations_(maxDAREIterations)
+    : Base(f, h, x0), maxDAREIterations_(maxDAREIterations), R_(R), Q_(Q), gainValid_(false)
 {
     P_.setZero();
 }
@@ -27,10 +27,12 @@ SteadyStateKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::SteadyState
     std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
     const SteadyStateKalmanFilterSettings<STATE_DIM, SCALAR>& sskf_settings)
     : Base(f, h, sskf_settings.x0),
-      Q_(sskf_settings.Q),
+      maxDAREIterations_(sskf_settings.maxDAREIterations),
       R_(sskf_settings.R),
-      maxDAREIterations_(sskf_settings.maxDAREIterations)
+      Q_(sskf_settings.Q),
+      gainValid_(false)
 {
+    P_.setZero();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
@@ -38,8 +40,8 @@ auto SteadyStateKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::predic
     const ct::core::Time& dt,
     const ct::core::Time& t) -> const state_vector_t&
 {
-    A_ = this->f_->computeDerivativeState(this->x_est_, u, t);
-    this->x_est_ = this->f_->computeDynamics(this->x_est_, u, t);
+    A_ = this->f_->computeDerivativeState(this->x_est_, u, dt, t);
+    this->x_est_ = this->f_->computeDynamics(this->x_est_, u, dt, t);
     return this->x_est_;
 }
 
@@ -49,19 +51,20 @@ auto SteadyStateKalmanFilter<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update
     const ct::core::Time& t) -> const state_vector_t&
 {
     ct::core::OutputStateMatrix<OUTPUT_DIM, STATE_DIM, SCALAR> dHdx = this->h_->computeDerivativeState(this->x_est_, t);
-    Eigen::Matrix<SCALAR, OUTPUT_DIM, STATE_DIM> K;
 
-    DARE<STATE_DIM, OUTPUT_DIM, SCALAR> dare;
-    try
+    // the steady state gain only changes with the linearization
+    if (!gainValid_ || A_ != A_K_ || dHdx != C_K_)
     {
-        P_ = dare.computeSteadyStateRiccatiMatrix(
-            Q_, R_, A_.transpose(), dHdx.transpose(), P_, K, false, 1e-6, maxDAREIterations_);
-    } catch (...)
-    {
-        throw;
+        DARE<STATE_DIM, OUTPUT_DIM, SCALAR> dare;
+        P_ = dare.computeSteadyStateRiccatiMatrixDirect(
+            Q_, R_, A_.transpose(), dHdx.transpose(), K_, false, 1e-6, maxDAREIterations_);
+
+        A_K_ = A_;
+        C_K_ = dHdx;
+        gainValid_ = true;
     }
 
-    this->x_est_ -= K.transpose() * (y - this->h_->computeMeasurement(this->x_est_, t));
+    this->x_est_ -= K_.transpose() * (y - this->h_->computeMeasurement(this->x_est_, t));
     return this->x_est_;
 }
 
@@ -22,6 +22,8 @@ struct SteadyStateKalmanFilterSettings;
  *        standard Kalman Filter, but instead of propagating the covariance and estimate through time, it assumes
  *        convergence reducing the problem to solving an Algebraic Ricatti Equation.
  *
+ * The Riccati equation is solved directly (see DARE::computeSteadyStateRiccatiMatrixDirect()) and the resulting
+ * gain is cached. It only gets recomputed if the linearized system or measurement matrices change.
  */
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR = double>
 class SteadyStateKalmanFilter final : public EstimatorBase<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>
@@ -57,7 +59,7 @@ public:
     //! Estimator update method.
     const state_vector_t& update(const output_vector_t& y, const ct::core::Time& dt, const ct::core::Time& t) override;
 
-    //! Limit number of iterations of the DARE solver.
+    //! Limit number of iterations of the iterative DARE solver, which is used if the direct solvers fail.
     void setMaxDAREIterations(size_t maxDAREIterations);
 
 private:
@@ -66,6 +68,11 @@ private:
     state_matrix_t A_;  //! Computed linearized system matrix
     output_matrix_t R_;
     state_matrix_t Q_;
+
+    bool gainValid_;                                                     //! True if K_ belongs to A_K_ and C_K_.
+    Eigen::Matrix<SCALAR, OUTPUT_DIM, STATE_DIM> K_;                     //! Cached steady state gain.
+    state_matrix_t A_K_;                                                 //! System matrix the gain was computed for.
+    ct::core::OutputStateMatrix<OUTPUT_DIM, STATE_DIM, SCALAR> C_K_;  //! Measurement matrix the gain was computed for.
 };
 
 }  // namespace optcon
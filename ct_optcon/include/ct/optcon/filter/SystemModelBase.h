@@ -26,6 +26,13 @@ public:
     using control_vector_t = ct::core::ControlVector<CONTROL_DIM, SCALAR>;
     using Time_t = SCALAR;
 
+    //! a batch of states, stored column-wise
+    using state_batch_t = Eigen::Matrix<SCALAR, STATE_DIM, Eigen::Dynamic>;
+    //! a batch of controls, stored column-wise
+    using control_batch_t = Eigen::Matrix<SCALAR, CONTROL_DIM, Eigen::Dynamic>;
+    //! a batch of state matrices, stored as consecutive STATE_DIM x STATE_DIM blocks
+    using state_matrix_batch_t = Eigen::Matrix<SCALAR, STATE_DIM, Eigen::Dynamic>;
+
     //! Virtual destructor.
     virtual ~SystemModelBase() = default;
 
@@ -35,6 +42,38 @@ public:
         const Time_t dt,
         Time_t t) = 0;
 
+    //! Propagates a batch of states (e.g. sigma points) in-place, all with the same control input.
+    /*!
+     * The default implementation propagates the columns one by one. Models can override this to vectorize the
+     * propagation across the batch or to distribute it over several threads.
+     */
+    virtual void computeDynamicsBatch(Eigen::Ref<state_batch_t> states,
+        const control_vector_t& control,
+        const Time_t dt,
+        Time_t t)
+    {
+        for (Eigen::Index i = 0; i < states.cols(); ++i)
+            states.col(i) = computeDynamics(states.col(i), control, dt, t);
+    }
+
+    //! Propagates a batch of states in-place, each group of consecutive states with its own control input.
+    /*!
+     * The states are split into controls.cols() groups of equal size, group j is propagated with column j of the
+     * controls. This lets the filter banks propagate the states or sigma points of all instances with a single call.
+     * The default implementation propagates each group with computeDynamicsBatch().
+     */
+    virtual void computeDynamicsBatchPerControl(Eigen::Ref<state_batch_t> states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t)
+    {
+        const Eigen::Index groupSize = controls.cols() > 0 ? states.cols() / controls.cols() : 0;
+        assert(groupSize * controls.cols() == states.cols());
+
+        for (Eigen::Index j = 0; j < controls.cols(); ++j)
+            computeDynamicsBatch(states.middleCols(j * groupSize, groupSize), control_vector_t(controls.col(j)), dt, t);
+    }
+
     //! Computes the derivative w.r.t state.
     virtual state_matrix_t computeDerivativeState(const state_vector_t& state,
         const control_vector_t& control,
@@ -46,6 +85,38 @@ public:
         const control_vector_t& control,
         const Time_t dt,
         Time_t t) = 0;
+
+    //! Computes the derivatives w.r.t. state of a batch of states, column i of the controls belongs to state i.
+    /*!
+     * The default implementation evaluates computeDerivativeState() column by column.
+     * @param derivatives the derivative of state i is written to the i-th STATE_DIM x STATE_DIM block
+     */
+    virtual void computeDerivativeStateBatch(const Eigen::Ref<const state_batch_t>& states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t,
+        Eigen::Ref<state_matrix_batch_t> derivatives)
+    {
+        for (Eigen::Index i = 0; i < states.cols(); ++i)
+            derivatives.template middleCols<STATE_DIM>(i * STATE_DIM) =
+                computeDerivativeState(states.col(i), controls.col(i), dt, t);
+    }
+
+    //! Computes the derivatives w.r.t. noise of a batch of states, column i of the controls belongs to state i.
+    /*!
+     * The default implementation evaluates computeDerivativeNoise() column by column.
+     * @param derivatives the derivative of state i is written to the i-th STATE_DIM x STATE_DIM block
+     */
+    virtual void computeDerivativeNoiseBatch(const Eigen::Ref<const state_batch_t>& states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t,
+        Eigen::Ref<state_matrix_batch_t> derivatives)
+    {
+        for (Eigen::Index i = 0; i < states.cols(); ++i)
+            derivatives.template middleCols<STATE_DIM>(i * STATE_DIM) =
+                computeDerivativeNoise(states.col(i), controls.col(i), dt, t);
+    }
 };
 
 }  // namespace optcon
@@ -137,8 +137,8 @@ public:
     void computeWeights();
 
     /*!
-     * \brief Propagate sigma points through the system dynamics. Using CTSystemModel here will not provide a desired
-     *        effect since it disregards the control input u.
+     * \brief Propagate sigma points through the system dynamics. All points are handed to the system model as one
+     *        batch, such that it can vectorize or parallelize the propagation.
      */
     void computeSigmaPointTransition(const ct::core::ControlVector<CONTROL_DIM, SCALAR>& u,
         const ct::core::Time& dt,
@@ -149,7 +149,7 @@ public:
 
     //! Make a prediction based on sigma points.
     template <size_t DIM>
-    state_vector_t computePredictionFromSigmaPoints(const SigmaPoints<DIM>& sigmaPoints);
+    Eigen::Matrix<SCALAR, DIM, 1> computePredictionFromSigmaPoints(const SigmaPoints<DIM>& sigmaPoints);
 
 private:
     state_matrix_t P_;                                          //! Covariance matrix.
@@ -0,0 +1,181 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::UnscentedKalmanFilterBank(
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+    const size_t nInstances,
+    const state_vector_t& x0,
+    SCALAR alpha,
+    SCALAR beta,
+    SCALAR kappa,
+    const state_matrix_t& P0)
+    : f_(f),
+      h_(h),
+      states_(x0.replicate(1, nInstances)),
+      covariances_(P0.replicate(1, nInstances)),
+      sigmaStatePoints_(state_batch_t::Zero(STATE_DIM, nInstances * SigmaPointCount)),
+      sigmaMeasurementPoints_(OUTPUT_DIM, nInstances * SigmaPointCount),
+      dFdv_(STATE_DIM, nInstances * STATE_DIM),
+      alpha_(alpha),
+      beta_(beta),
+      kappa_(kappa)
+{
+    computeWeights();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::UnscentedKalmanFilterBank(
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+    const size_t nInstances,
+    const UnscentedKalmanFilterSettings<STATE_DIM, SCALAR>& ukf_settings)
+    : UnscentedKalmanFilterBank(f,
+          h,
+          nInstances,
+          ukf_settings.x0,
+          ukf_settings.alpha,
+          ukf_settings.beta,
+          ukf_settings.kappa,
+          ukf_settings.P0)
+{
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::predict(const control_batch_t& u,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    if (static_cast<size_t>(u.cols()) != getNumInstances())
+        throw std::runtime_error("UnscentedKalmanFilterBank: number of controls does not match number of instances.");
+
+    Eigen::LLT<Eigen::Matrix<SCALAR, STATE_DIM, STATE_DIM>> llt;
+
+    // draw sigma points around the current estimates
+    for (size_t i = 0; i < getNumInstances(); ++i)
+    {
+        auto sigmaPoints = sigmaStatePoints_.template middleCols<SigmaPointCount>(i * SigmaPointCount);
+
+        llt.compute(covariances_.template middleCols<STATE_DIM>(i * STATE_DIM));
+        if (llt.info() != Eigen::Success)
+            throw std::runtime_error("UnscentedKalmanFilterBank : Numerical error.");
+
+        const state_matrix_t S = gamma_ * llt.matrixL().toDenseMatrix();
+        sigmaPoints.template leftCols<1>() = states_.col(i);
+        sigmaPoints.template block<STATE_DIM, STATE_DIM>(0, 1) = S.colwise() + states_.col(i);
+        sigmaPoints.template rightCols<STATE_DIM>() = (-S).colwise() + states_.col(i);
+    }
+
+    // propagate the sigma points of all instances at once and recover means and covariances
+    f_->computeDynamicsBatchPerControl(sigmaStatePoints_, u, dt, t);
+
+    for (size_t i = 0; i < getNumInstances(); ++i)
+        states_.col(i) = sigmaStatePoints_.template middleCols<SigmaPointCount>(i * SigmaPointCount) * sigmaWeights_m_;
+
+    f_->computeDerivativeNoiseBatch(states_, u, dt, t, dFdv_);
+
+    for (size_t i = 0; i < getNumInstances(); ++i)
+    {
+        const Eigen::Matrix<SCALAR, STATE_DIM, SigmaPointCount> deviations =
+            sigmaStatePoints_.template middleCols<SigmaPointCount>(i * SigmaPointCount).colwise() - states_.col(i);
+        covariances_.template middleCols<STATE_DIM>(i * STATE_DIM) =
+            deviations * sigmaWeights_c_.asDiagonal() * deviations.transpose() +
+            dFdv_.template middleCols<STATE_DIM>(i * STATE_DIM);
+    }
+
+    return states_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update(const output_batch_t& y,
+    const mask_t& mask,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    if (static_cast<size_t>(y.cols()) != getNumInstances() || static_cast<size_t>(mask.size()) != getNumInstances())
+        throw std::runtime_error(
+            "UnscentedKalmanFilterBank: number of measurements does not match number of instances.");
+
+    // predict the measurements of all sigma points of each run of consecutive flagged instances at once, masked
+    // instances are skipped
+    for (size_t begin = 0; begin < getNumInstances();)
+    {
+        if (!mask(begin))
+        {
+            ++begin;
+            continue;
+        }
+        size_t end = begin + 1;
+        while (end < getNumInstances() && mask(end))
+            ++end;
+
+        const size_t nPoints = (end - begin) * SigmaPointCount;
+        auto measurements = sigmaMeasurementPoints_.middleCols(begin * SigmaPointCount, nPoints);
+        h_->computeMeasurementBatch(sigmaStatePoints_.middleCols(begin * SigmaPointCount, nPoints), measurements, t);
+        begin = end;
+    }
+
+    for (size_t i = 0; i < getNumInstances(); ++i)
+    {
+        if (!mask(i))
+            continue;
+
+        const state_vector_t x = states_.col(i);
+        auto P = covariances_.template middleCols<STATE_DIM>(i * STATE_DIM);
+        const auto sigmaPoints = sigmaStatePoints_.template middleCols<SigmaPointCount>(i * SigmaPointCount);
+        const auto sigmaMeasurements =
+            sigmaMeasurementPoints_.template middleCols<SigmaPointCount>(i * SigmaPointCount);
+
+        const ct::core::OutputVector<OUTPUT_DIM, SCALAR> y_pred = sigmaMeasurements * sigmaWeights_m_;
+
+        const Eigen::Matrix<SCALAR, OUTPUT_DIM, SigmaPointCount> dy = sigmaMeasurements.colwise() - y_pred;
+        const Eigen::Matrix<SCALAR, STATE_DIM, SigmaPointCount> dx = sigmaPoints.colwise() - x;
+
+        // innovation and cross covariance
+        const Eigen::Matrix<SCALAR, OUTPUT_DIM, OUTPUT_DIM> P_yy =
+            dy * sigmaWeights_c_.asDiagonal() * dy.transpose() + h_->computeDerivativeNoise(x, t);
+        const Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> P_xy = dx * sigmaWeights_c_.asDiagonal() * dy.transpose();
+
+        const Eigen::Matrix<SCALAR, STATE_DIM, OUTPUT_DIM> K = P_yy.llt().solve(P_xy.transpose()).transpose();
+
+        states_.col(i) += K * (y.col(i) - y_pred);
+        P -= K * P_yy * K.transpose();
+    }
+
+    return states_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+auto UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::update(const output_batch_t& y,
+    const ct::core::Time& dt,
+    const ct::core::Time& t) -> const state_batch_t&
+{
+    return update(y, mask_t::Constant(getNumInstances(), true), dt, t);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR>
+void UnscentedKalmanFilterBank<STATE_DIM, CONTROL_DIM, OUTPUT_DIM, SCALAR>::computeWeights()
+{
+    SCALAR L = SCALAR(STATE_DIM);
+    lambda_ = alpha_ * alpha_ * (L + kappa_) - L;
+    gamma_ = std::sqrt(L + lambda_);
+
+    assert(std::abs(L + lambda_) > 1e-6);
+    assert(std::abs(L + kappa_) > 1e-6);
+
+    sigmaWeights_m_.setConstant(SCALAR(1) / (SCALAR(2) * alpha_ * alpha_ * (L + kappa_)));
+    sigmaWeights_c_ = sigmaWeights_m_;
+    sigmaWeights_m_[0] = lambda_ / (L + lambda_);
+    sigmaWeights_c_[0] = sigmaWeights_m_[0] + (SCALAR(1) - alpha_ * alpha_ + beta_);
+}
+
+}  // namespace optcon
+}  // namespace ct
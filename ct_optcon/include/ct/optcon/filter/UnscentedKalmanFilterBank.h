@@ -0,0 +1,138 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include "EstimatorBase.h"
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * \ingroup Filter
+ *
+ * \brief A bank of independent Unscented Kalman Filters of equal dimensions.
+ *
+ * Counterpart of the ExtendedKalmanFilterBank for the UnscentedKalmanFilter. States, covariances and the sigma points
+ * of all instances are stored contiguously. predict() propagates the sigma points of all instances with a single call
+ * to SystemModelBase::computeDynamicsBatchPerControl() and evaluates the process noise of all instances with a single
+ * call to SystemModelBase::computeDerivativeNoiseBatch().
+ *
+ * Instances without a measurement in the current step are excluded from the update by a mask. update() predicts the
+ * measurements of all sigma points with one call to LinearMeasurementModel::computeMeasurementBatch() per run of
+ * consecutive flagged instances, the measurements of masked instances are not predicted.
+ * Per instance, the filter behaves exactly like an UnscentedKalmanFilter with the same parameters.
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t OUTPUT_DIM, typename SCALAR = double>
+class UnscentedKalmanFilterBank
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static constexpr size_t SigmaPointCount = 2 * STATE_DIM + 1;
+
+    using state_vector_t = ct::core::StateVector<STATE_DIM, SCALAR>;
+    using state_matrix_t = ct::core::StateMatrix<STATE_DIM, SCALAR>;
+    using output_matrix_t = ct::core::OutputMatrix<OUTPUT_DIM, SCALAR>;
+
+    //! states of all instances, stored column-wise
+    using state_batch_t = Eigen::Matrix<SCALAR, STATE_DIM, Eigen::Dynamic>;
+    //! controls of all instances, stored column-wise
+    using control_batch_t = Eigen::Matrix<SCALAR, CONTROL_DIM, Eigen::Dynamic>;
+    //! measurements of all instances, stored column-wise
+    using output_batch_t = Eigen::Matrix<SCALAR, OUTPUT_DIM, Eigen::Dynamic>;
+    //! covariances of all instances, stored as consecutive STATE_DIM x STATE_DIM blocks
+    using covariance_batch_t = Eigen::Matrix<SCALAR, STATE_DIM, Eigen::Dynamic>;
+    //! flags which instances receive a measurement
+    using mask_t = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+    //! Constructor, all instances start from the same initial state and covariance.
+    UnscentedKalmanFilterBank(std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+        std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+        const size_t nInstances,
+        const state_vector_t& x0 = state_vector_t::Zero(),
+        SCALAR alpha = SCALAR(1.0),
+        SCALAR beta = SCALAR(2.0),
+        SCALAR kappa = SCALAR(0.0),
+        const state_matrix_t& P0 = state_matrix_t::Identity());
+
+    //! Constructor from settings.
+    UnscentedKalmanFilterBank(std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f,
+        std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h,
+        const size_t nInstances,
+        const UnscentedKalmanFilterSettings<STATE_DIM, SCALAR>& ukf_settings);
+
+    //! Predict all instances.
+    /*!
+     * @param u controls, one column per instance
+     * @param dt time step
+     * @param t current time
+     * @return the predicted states
+     */
+    const state_batch_t& predict(const control_batch_t& u, const ct::core::Time& dt, const ct::core::Time& t);
+
+    //! Update the instances which are flagged in the mask.
+    /*!
+     * @param y measurements, one column per instance. Columns of instances not flagged in the mask are ignored.
+     * @param mask flags which instances received a measurement
+     * @param dt time step
+     * @param t current time
+     * @return the updated states
+     */
+    const state_batch_t& update(const output_batch_t& y,
+        const mask_t& mask,
+        const ct::core::Time& dt,
+        const ct::core::Time& t);
+
+    //! Update all instances.
+    const state_batch_t& update(const output_batch_t& y, const ct::core::Time& dt, const ct::core::Time& t);
+
+    //! Number of filter instances.
+    size_t getNumInstances() const { return states_.cols(); }
+    //! Estimates of all instances.
+    const state_batch_t& getEstimates() const { return states_; }
+    //! Estimate of instance i.
+    state_vector_t getEstimate(const size_t i) const { return states_.col(i); }
+    //! Set the estimate of instance i.
+    void setEstimate(const size_t i, const state_vector_t& x) { states_.col(i) = x; }
+    //! Covariance of instance i.
+    state_matrix_t getCovarianceMatrix(const size_t i) const
+    {
+        return covariances_.template middleCols<STATE_DIM>(i * STATE_DIM);
+    }
+    //! Set the covariance of instance i.
+    void setCovarianceMatrix(const size_t i, const state_matrix_t& P)
+    {
+        covariances_.template middleCols<STATE_DIM>(i * STATE_DIM) = P;
+    }
+
+private:
+    //! Compute weights of sigma points.
+    void computeWeights();
+
+    //! System model for propagating the system, shared by all instances.
+    std::shared_ptr<SystemModelBase<STATE_DIM, CONTROL_DIM, SCALAR>> f_;
+
+    //! Observation model, shared by all instances.
+    std::shared_ptr<LinearMeasurementModel<OUTPUT_DIM, STATE_DIM, SCALAR>> h_;
+
+    state_batch_t states_;            //! State estimates.
+    covariance_batch_t covariances_;  //! Covariance estimates.
+    state_batch_t sigmaStatePoints_;  //! Sigma points of all instances, SigmaPointCount consecutive columns each.
+    output_batch_t sigmaMeasurementPoints_;  //! Measurements of all sigma points (workspace).
+    covariance_batch_t dFdv_;                //! Process noise of all instances (workspace).
+
+    Eigen::Matrix<SCALAR, SigmaPointCount, 1> sigmaWeights_m_;  //! Sigma measurement weights.
+    Eigen::Matrix<SCALAR, SigmaPointCount, 1> sigmaWeights_c_;  //! Sigma covariance weights.
+
+    SCALAR alpha_;   //! Scaling parameter for spread of sigma points (usually \f$ 1E-4 \leq \alpha \leq 1 \f$)
+    SCALAR beta_;    //! Parameter for prior knowledge about the distribution (\f$ \beta = 2 \f$ is optimal for Gaussian)
+    SCALAR kappa_;   //! Secondary scaling parameter (usually 0)
+    SCALAR gamma_;   //! \f$ \gamma = \sqrt{L + \lambda} \f$ with \f$ L \f$ being the state dimensionality
+    SCALAR lambda_;  //! \f$ \lambda = \alpha^2 ( L + \kappa ) - L\f$ with \f$ L \f$ being the state dimensionality
+};
+
+}  // namespace optcon
+}  // namespace ct
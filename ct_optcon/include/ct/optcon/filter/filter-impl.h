@@ -11,5 +11,8 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "DisturbedSystemController-impl.h"
 #include "LTIMeasurementModel-impl.h"
 #include "ExtendedKalmanFilter-impl.h"
+#include "ExtendedKalmanFilterBank-impl.h"
 #include "SteadyStateKalmanFilter-impl.h"
 #include "UnscentedKalmanFilter-impl.h"
+#include "SquareRootUnscentedKalmanFilter-impl.h"
+#include "UnscentedKalmanFilterBank-impl.h"
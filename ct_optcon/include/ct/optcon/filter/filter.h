@@ -10,6 +10,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "DisturbedSystemController.h"
 #include "InputDisturbedSystem.h"
 #include "ExtendedKalmanFilter.h"
+#include "ExtendedKalmanFilterBank.h"
 #include "EstimatorBase.h"
 #include "FilterSettings.h"
 #include "LinearMeasurementModel.h"
@@ -18,3 +19,5 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "SteadyStateKalmanFilter.h"
 #include "SystemModelBase.h"
 #include "UnscentedKalmanFilter.h"
+#include "SquareRootUnscentedKalmanFilter.h"
+#include "UnscentedKalmanFilterBank.h"
@@ -0,0 +1,289 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+#include <ct/core/common/ThreadPool.h>
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::GainScheduledLQR() : hasGains_(false)
+{
+    strides_.fill(0);
+    uniformSpacing_.fill(0.0);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::GainScheduledLQR(const Axes& axes) : hasGains_(false)
+{
+    setAxes(axes);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::setAxes(const Axes& axes)
+{
+    axes_ = axes;
+    initializeGrid();
+    gains_.assign(getNumGridPoints() * GAIN_SIZE, 0.0);
+    hasGains_ = false;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+bool GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::compute(const LinearSystem_t& system,
+    const OperatingPointFunction& operatingPoint,
+    const state_matrix_t& Q,
+    const control_matrix_t& R,
+    size_t nThreads,
+    bool RisDiagonal,
+    bool solveRiccatiIteratively)
+{
+    const size_t nPoints = getNumGridPoints();
+    if (nPoints == 0)
+        throw std::runtime_error("GainScheduledLQR: grid is empty.");
+
+    nThreads = std::max(size_t(1), std::min(nThreads, nPoints));
+
+    // every thread works on its own system and LQR, the latter holds the Riccati solver workspace
+    std::vector<std::shared_ptr<LinearSystem_t>> systems;
+    std::vector<std::shared_ptr<LQR<STATE_DIM, CONTROL_DIM>>> lqrs;
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        systems.emplace_back(system.clone());
+        lqrs.emplace_back(new LQR<STATE_DIM, CONTROL_DIM>());
+    }
+
+    std::atomic<bool> success(true);
+
+    ct::core::ThreadPool pool(nThreads);
+    pool.parallelFor(nPoints, [&](size_t threadId, size_t gridIndex) {
+        // recover the scheduling variable from the grid index
+        schedule_vector_t s;
+        size_t remainder = gridIndex;
+        for (size_t d = 0; d < SCHEDULE_DIM; d++)
+        {
+            s(d) = axes_[d][remainder % axes_[d].size()];
+            remainder /= axes_[d].size();
+        }
+
+        ct::core::StateVector<STATE_DIM> x;
+        ct::core::ControlVector<CONTROL_DIM> u;
+        operatingPoint(s, x, u);
+
+        ct::core::StateMatrix<STATE_DIM> A;
+        ct::core::StateControlMatrix<STATE_DIM, CONTROL_DIM> B;
+        systems[threadId]->getDerivatives(A, B, x, u);
+
+        control_feedback_t K;
+        if (!lqrs[threadId]->compute(Q, R, A, B, K, RisDiagonal, solveRiccatiIteratively) || !K.allFinite())
+            success = false;
+
+        Eigen::Map<control_feedback_t>(gains_.data() + gridIndex * GAIN_SIZE) = K;
+    });
+
+    hasGains_ = success;
+    return success;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+bool GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::hasGains() const
+{
+    return hasGains_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::getGain(const schedule_vector_t& s,
+    control_feedback_t& K) const
+{
+    if (!hasGains_)
+        throw std::runtime_error("GainScheduledLQR: the table holds no gains, call compute() or load() first.");
+
+    size_t lower[SCHEDULE_DIM];
+    double weight[SCHEDULE_DIM];
+
+    size_t base = 0;
+    for (size_t d = 0; d < SCHEDULE_DIM; d++)
+    {
+        locate(d, s(d), lower[d], weight[d]);
+        base += lower[d] * strides_[d];
+    }
+
+    // multilinear interpolation over the corners of the cell
+    K.setZero();
+    for (size_t corner = 0; corner < (size_t(1) << SCHEDULE_DIM); corner++)
+    {
+        double w = 1.0;
+        size_t offset = base;
+        for (size_t d = 0; d < SCHEDULE_DIM; d++)
+        {
+            if (corner & (size_t(1) << d))
+            {
+                w *= weight[d];
+                offset += strides_[d];
+            }
+            else
+                w *= 1.0 - weight[d];
+        }
+
+        if (w != 0.0)
+            K += w * Eigen::Map<const control_feedback_t>(gains_.data() + offset * GAIN_SIZE);
+    }
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+auto GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::getGridGain(size_t gridIndex) const
+    -> Eigen::Map<const control_feedback_t>
+{
+    if (!hasGains_)
+        throw std::runtime_error("GainScheduledLQR: the table holds no gains, call compute() or load() first.");
+    if (gridIndex >= getNumGridPoints())
+        throw std::runtime_error("GainScheduledLQR: grid index out of range.");
+
+    return Eigen::Map<const control_feedback_t>(gains_.data() + gridIndex * GAIN_SIZE);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+size_t GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::getNumGridPoints() const
+{
+    size_t n = 1;
+    for (const Axis& axis : axes_)
+        n *= axis.size();
+    return n;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+auto GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::getAxes() const -> const Axes&
+{
+    return axes_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::save(const std::string& filename) const
+{
+    if (!hasGains_)
+        throw std::runtime_error("GainScheduledLQR: the table holds no gains, nothing to save.");
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("GainScheduledLQR: cannot open file " + filename + " for writing.");
+
+    // header: dimensions, followed by the axes and the gains
+    const uint64_t header[3] = {STATE_DIM, CONTROL_DIM, SCHEDULE_DIM};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    for (const Axis& axis : axes_)
+    {
+        const uint64_t size = axis.size();
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(reinterpret_cast<const char*>(axis.data()), axis.size() * sizeof(double));
+    }
+
+    file.write(reinterpret_cast<const char*>(gains_.data()), gains_.size() * sizeof(double));
+
+    if (!file.good())
+        throw std::runtime_error("GainScheduledLQR: failed to write " + filename);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::load(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("GainScheduledLQR: cannot open file " + filename + " for reading.");
+
+    uint64_t header[3];
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!file.good() || header[0] != STATE_DIM || header[1] != CONTROL_DIM || header[2] != SCHEDULE_DIM)
+        throw std::runtime_error("GainScheduledLQR: dimensions in " + filename + " do not match.");
+
+    Axes axes;
+    for (Axis& axis : axes)
+    {
+        uint64_t size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        axis.resize(size);
+        file.read(reinterpret_cast<char*>(axis.data()), size * sizeof(double));
+    }
+
+    setAxes(axes);
+    file.read(reinterpret_cast<char*>(gains_.data()), gains_.size() * sizeof(double));
+
+    if (!file.good())
+        throw std::runtime_error("GainScheduledLQR: " + filename + " is truncated.");
+
+    hasGains_ = true;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::initializeGrid()
+{
+    size_t stride = 1;
+    for (size_t d = 0; d < SCHEDULE_DIM; d++)
+    {
+        const Axis& axis = axes_[d];
+
+        if (axis.empty())
+            throw std::runtime_error("GainScheduledLQR: every axis needs at least one grid point.");
+
+        for (size_t i = 1; i < axis.size(); i++)
+            if (!(axis[i] > axis[i - 1]))
+                throw std::runtime_error("GainScheduledLQR: grid points need to be strictly increasing.");
+
+        strides_[d] = stride;
+        stride *= axis.size();
+
+        // detect uniform spacing, which allows locating the cell without a search
+        uniformSpacing_[d] = 0.0;
+        if (axis.size() > 1)
+        {
+            const double h = (axis.back() - axis.front()) / (axis.size() - 1);
+            bool uniform = true;
+            for (size_t i = 1; i < axis.size() && uniform; i++)
+                uniform = std::abs(axis[i] - axis[i - 1] - h) <= 1e-9 * h;
+            if (uniform)
+                uniformSpacing_[d] = h;
+        }
+    }
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM>
+void GainScheduledLQR<STATE_DIM, CONTROL_DIM, SCHEDULE_DIM>::locate(size_t dim,
+    double s,
+    size_t& index,
+    double& weight) const
+{
+    const Axis& axis = axes_[dim];
+
+    // clamp to the grid
+    if (axis.size() == 1 || s <= axis.front())
+    {
+        index = 0;
+        weight = 0.0;
+        return;
+    }
+    if (s >= axis.back())
+    {
+        index = axis.size() - 2;
+        weight = 1.0;
+        return;
+    }
+
+    if (uniformSpacing_[dim] > 0.0)
+        index = std::min(static_cast<size_t>((s - axis.front()) / uniformSpacing_[dim]), axis.size() - 2);
+    else
+        index = std::upper_bound(axis.begin(), axis.end(), s) - axis.begin() - 1;
+
+    weight = (s - axis[index]) / (axis[index + 1] - axis[index]);
+}
+
+}  // namespace optcon
+}  // namespace ct
@@ -0,0 +1,141 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "LQR.hpp"
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * \ingroup LQR
+ *
+ * \brief gain-scheduled continuous-time infinite-horizon LQR
+ *
+ * Precomputes infinite-horizon LQR gains for operating points on a rectilinear grid over a scheduling variable
+ * \f$ s \in \mathbb{R}^{SCHEDULE\_DIM} \f$ and stores them in a contiguous table. At runtime, the gain for an
+ * arbitrary scheduling variable is obtained by multilinear interpolation between the neighbouring grid points.
+ * The lookup locates the grid cell in O(1) for uniformly spaced axes and O(log n) otherwise, and does not allocate.
+ * Scheduling variables outside the grid are clamped to its boundary.
+ *
+ * The table can be stored to and restored from a binary file, such that it does not need to be recomputed on start-up.
+ *
+ * @tparam STATE_DIM
+ * @tparam CONTROL_DIM
+ * @tparam SCHEDULE_DIM dimension of the scheduling variable
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t SCHEDULE_DIM = 1>
+class GainScheduledLQR
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef Eigen::Matrix<double, STATE_DIM, STATE_DIM> state_matrix_t;
+    typedef Eigen::Matrix<double, CONTROL_DIM, CONTROL_DIM> control_matrix_t;
+    typedef Eigen::Matrix<double, STATE_DIM, CONTROL_DIM> control_gain_matrix_t;
+    typedef Eigen::Matrix<double, CONTROL_DIM, STATE_DIM> control_feedback_t;
+    typedef Eigen::Matrix<double, SCHEDULE_DIM, 1> schedule_vector_t;
+
+    typedef ct::core::LinearSystem<STATE_DIM, CONTROL_DIM> LinearSystem_t;
+
+    //! grid points along one dimension of the scheduling variable, strictly increasing
+    typedef std::vector<double> Axis;
+    typedef std::array<Axis, SCHEDULE_DIM> Axes;
+
+    //! maps a scheduling variable to the operating point (state and control) the system is linearized about
+    /*!
+     * \warning compute() calls this function concurrently from the ThreadPool workers if nThreads > 1, hence it
+     * needs to be thread-safe.
+     */
+    typedef std::function<void(const schedule_vector_t&,
+        ct::core::StateVector<STATE_DIM>&,
+        ct::core::ControlVector<CONTROL_DIM>&)>
+        OperatingPointFunction;
+
+    //! constructor for an empty table, use setAxes() and compute(), or load() to fill it
+    GainScheduledLQR();
+
+    //! constructor
+    /*!
+     * @param axes grid points for every dimension of the scheduling variable
+     */
+    GainScheduledLQR(const Axes& axes);
+
+    //! set the grid, invalidates all previously computed gains until compute() is called
+    void setAxes(const Axes& axes);
+
+    //! precompute the gains for all grid points
+    /*!
+     * The grid points are distributed over nThreads threads, each of which works on its own clone of the system.
+     * The operatingPoint function is shared and called concurrently by these threads.
+     * @param system linear(ized) system, gets linearized at the operating points
+     * @param operatingPoint maps grid points to operating points, needs to be thread-safe if nThreads > 1
+     * @param Q state-weighting matrix
+     * @param R control input weighting matrix
+     * @param nThreads number of threads
+     * @param RisDiagonal set to true if R is a diagonal matrix (efficiency boost)
+     * @param solveRiccatiIteratively see LQR::compute()
+     * @return true if all gains were computed successfully, otherwise the table stays unusable
+     */
+    bool compute(const LinearSystem_t& system,
+        const OperatingPointFunction& operatingPoint,
+        const state_matrix_t& Q,
+        const control_matrix_t& R,
+        size_t nThreads = 1,
+        bool RisDiagonal = false,
+        bool solveRiccatiIteratively = false);
+
+    //! true if the table holds gains, i.e. compute() succeeded or load() was called after the last setAxes()
+    bool hasGains() const;
+
+    //! get the interpolated gain for a scheduling variable
+    /*!
+     * \throw std::runtime_error if the table holds no gains, see hasGains()
+     */
+    void getGain(const schedule_vector_t& s, control_feedback_t& K) const;
+
+    //! get the gain stored at a grid point, the index runs fastest along the first axis
+    /*!
+     * \throw std::runtime_error if the table holds no gains or if the index is out of range
+     */
+    Eigen::Map<const control_feedback_t> getGridGain(size_t gridIndex) const;
+
+    //! get the total number of grid points
+    size_t getNumGridPoints() const;
+
+    //! get the grid
+    const Axes& getAxes() const;
+
+    //! write the table to a binary file, throws if the table holds no gains
+    void save(const std::string& filename) const;
+
+    //! read a table written by save(), replacing the current grid and gains
+    void load(const std::string& filename);
+
+private:
+    //! checks the axes and precomputes the strides and spacings
+    void initializeGrid();
+
+    //! find the grid cell containing s along one axis and the interpolation weight of its upper neighbour
+    void locate(size_t dim, double s, size_t& index, double& weight) const;
+
+    static const size_t GAIN_SIZE = STATE_DIM * CONTROL_DIM;
+
+    Axes axes_;
+    std::array<size_t, SCHEDULE_DIM> strides_;       //! offset between neighbouring grid points per dimension
+    std::array<double, SCHEDULE_DIM> uniformSpacing_;  //! grid spacing if uniform, zero otherwise
+
+    std::vector<double> gains_;  //! all gains, stored contiguously in grid order
+    bool hasGains_;              //! gains_ was filled by compute() or load() for the current axes
+};
+
+}  // namespace optcon
+}  // namespace ct
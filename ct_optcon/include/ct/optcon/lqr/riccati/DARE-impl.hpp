@@ -67,5 +67,172 @@ DARE<STATE_DIM, CONTROL_DIM, SCALAR>::computeSteadyStateRiccatiMatrix(const stat
     return P;
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+typename DARE<STATE_DIM, CONTROL_DIM, SCALAR>::state_matrix_t
+DARE<STATE_DIM, CONTROL_DIM, SCALAR>::computeSteadyStateRiccatiMatrixDirect(const state_matrix_t& Q,
+    const control_matrix_t& R,
+    const state_matrix_t& A,
+    const control_gain_matrix_t& B,
+    control_feedback_t& K,
+    bool verbose,
+    const SCALAR eps,
+    size_t maxIter)
+{
+    state_matrix_t P;
+
+    if (solveSchurDirect(Q, R, A, B, P))
+    {
+        if (verbose)
+            std::cout << "DARE : solved by ordered QZ decomposition" << std::endl;
+    }
+    else if (solveDoubling(Q, R, A, B, P))
+    {
+        if (verbose)
+            std::cout << "DARE : solved by structure-preserving doubling" << std::endl;
+    }
+    else
+    {
+        if (verbose)
+            std::cout << "DARE : direct methods failed, falling back to iterative solution" << std::endl;
+        return computeSteadyStateRiccatiMatrix(Q, R, A, B, K, verbose, eps, maxIter);
+    }
+
+    K = computeFeedback(R, A, B, P);
+
+    if (!K.allFinite())
+        throw std::runtime_error("DARE : Failed to compute a finite feedback matrix.");
+
+    if (verbose)
+        std::cout << "Resulting K: " << K << std::endl;
+
+    return P;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+bool DARE<STATE_DIM, CONTROL_DIM, SCALAR>::solveDoubling(const state_matrix_t& Q,
+    const control_matrix_t& R,
+    const state_matrix_t& A,
+    const control_gain_matrix_t& B,
+    state_matrix_t& P,
+    const SCALAR relTol,
+    size_t maxIter)
+{
+    Eigen::LLT<control_matrix_t> R_llt(R);
+    if (R_llt.info() != Eigen::Success)
+        return false;
+
+    // A_k, G_k and H_k of the doubling iteration, H_k converges to P
+    state_matrix_t A_k = A;
+    state_matrix_t G_k = B * R_llt.solve(B.transpose());
+    P = Q;
+
+    Eigen::PartialPivLU<state_matrix_t> W_lu;
+
+    for (size_t i = 0; i < maxIter; i++)
+    {
+        W_lu.compute(state_matrix_t::Identity() + G_k * P);
+
+        const state_matrix_t W_inv_A = W_lu.solve(A_k);
+        const state_matrix_t W_inv_G = W_lu.solve(G_k);
+
+        const state_matrix_t P_next = P + A_k.transpose() * P * W_inv_A;
+        G_k += A_k * W_inv_G * A_k.transpose();
+        A_k = (A_k * W_inv_A).eval();
+
+        const SCALAR change = (P_next - P).norm();
+        P = (P_next + P_next.transpose()) / SCALAR(2.0);
+        G_k = (G_k + G_k.transpose()).eval() / SCALAR(2.0);
+
+        if (!P.allFinite())
+            return false;
+
+        if (change <= relTol * P.norm())
+            return true;
+    }
+
+    return false;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+bool DARE<STATE_DIM, CONTROL_DIM, SCALAR>::solveSchurDirect(const state_matrix_t& Q,
+    const control_matrix_t& R,
+    const state_matrix_t& A,
+    const control_gain_matrix_t& B,
+    state_matrix_t& P)
+{
+    return solveSchurDirect(Q, R, A, B, P, std::is_same<SCALAR, double>());
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+bool DARE<STATE_DIM, CONTROL_DIM, SCALAR>::solveSchurDirect(const state_matrix_t& Q,
+    const control_matrix_t& R,
+    const state_matrix_t& A,
+    const control_gain_matrix_t& B,
+    state_matrix_t& P,
+    std::true_type isDouble)
+{
+#ifdef CT_USE_LAPACK
+    Eigen::LLT<control_matrix_t> R_llt(R);
+    if (R_llt.info() != Eigen::Success)
+        return false;
+
+    // symplectic pencil M - lambda * L, its stable deflating subspace is spanned by [I; P]
+    pencil_matrix_t M = pencil_matrix_t::Zero();
+    M.template topLeftCorner<STATE_DIM, STATE_DIM>() = A;
+    M.template bottomLeftCorner<STATE_DIM, STATE_DIM>() = -Q;
+    M.template bottomRightCorner<STATE_DIM, STATE_DIM>().setIdentity();
+
+    pencil_matrix_t L = pencil_matrix_t::Zero();
+    L.template topLeftCorner<STATE_DIM, STATE_DIM>().setIdentity();
+    L.template topRightCorner<STATE_DIM, STATE_DIM>() = B * R_llt.solve(B.transpose());
+    L.template bottomRightCorner<STATE_DIM, STATE_DIM>() = A.transpose();
+
+    const int N = 2 * STATE_DIM;
+    const int LWORK = 8 * N + 16;
+    int SDIM = 0;
+    int INFO = 0;
+    double ALPHAR[2 * STATE_DIM];
+    double ALPHAI[2 * STATE_DIM];
+    double BETA[2 * STATE_DIM];
+    double WORK[8 * 2 * STATE_DIM + 16];
+    int BWORK[2 * STATE_DIM];
+    pencil_matrix_t VSL;
+    pencil_matrix_t VSR;
+
+    dgges_("N", "V", "S", &DARE::selectStableEigenvalue, &N, M.data(), &N, L.data(), &N, &SDIM, ALPHAR, ALPHAI, BETA,
+        VSL.data(), &N, VSR.data(), &N, WORK, &LWORK, BWORK, &INFO);
+
+    // the stable subspace needs to have full dimension
+    if (INFO != 0 || SDIM != static_cast<int>(STATE_DIM))
+        return false;
+
+    const state_matrix_t U11 = VSR.template topLeftCorner<STATE_DIM, STATE_DIM>();
+    const state_matrix_t U21 = VSR.template bottomLeftCorner<STATE_DIM, STATE_DIM>();
+
+    // P = U21 * U11^-1, solved as U11^T * P^T = U21^T
+    Eigen::FullPivLU<state_matrix_t> U11_lu(U11.transpose());
+    if (!U11_lu.isInvertible())
+        return false;
+
+    P = U11_lu.solve(U21.transpose()).transpose();
+    P = (P + P.transpose()).eval() / 2.0;
+
+    return P.allFinite();
+#else
+    return false;
+#endif
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+typename DARE<STATE_DIM, CONTROL_DIM, SCALAR>::control_feedback_t DARE<STATE_DIM, CONTROL_DIM, SCALAR>::computeFeedback(
+    const control_matrix_t& R,
+    const state_matrix_t& A,
+    const control_gain_matrix_t& B,
+    const state_matrix_t& P)
+{
+    const control_matrix_t H = R + B.transpose() * P * B;
+    return -H.ldlt().solve(B.transpose() * P * A);
+}
+
 }  // namespace optcon
 }  // namespace ct
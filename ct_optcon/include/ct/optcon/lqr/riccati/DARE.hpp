@@ -5,8 +5,35 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <type_traits>
+
 #include "DynamicRiccatiEquation.hpp"
 
+// ordered QZ decomposition from Lapack
+#ifdef CT_USE_LAPACK
+extern "C" void dgges_(const char* JOBVSL,
+    const char* JOBVSR,
+    const char* SORT,
+    int (*SELCTG)(const double*, const double*, const double*),
+    const int* N,
+    double* A,
+    const int* LDA,
+    double* B,
+    const int* LDB,
+    int* SDIM,
+    double* ALPHAR,
+    double* ALPHAI,
+    double* BETA,
+    double* VSL,
+    const int* LDVSL,
+    double* VSR,
+    const int* LDVSR,
+    double* WORK,
+    const int* LWORK,
+    int* BWORK,
+    int* INFO);
+#endif
+
 namespace ct {
 namespace optcon {
 
@@ -15,7 +42,8 @@ namespace optcon {
  *+
  * \brief Discrete-Time Algebraic Riccati Equation
  *
- * solves the discrete-time Infinite-Horizon Algebraic Riccati Equation iteratively
+ * solves the discrete-time Infinite-Horizon Algebraic Riccati Equation, either iteratively or with a direct method
+ * (ordered QZ decomposition of the symplectic pencil if Lapack is available, structure-preserving doubling otherwise)
  *
  * @tparam STATE_DIM system state dimension
  * @tparam CONTROL_DIM system control input dimension
@@ -74,9 +102,90 @@ public:
         const SCALAR eps = 1e-6,
         size_t maxIter = 1000);
 
+    /*! compute the discrete-time steady state Riccati-Matrix with a direct method
+     * Uses the ordered QZ decomposition if Lapack is available and the structure-preserving doubling algorithm
+     * otherwise, or if the QZ decomposition fails. If neither converges, falls back to iterating over the time-varying
+     * discrete-time Riccati Equation.
+     * @param Q state weight
+     * @param R control weight
+     * @param A discrete-time linear system matrix A
+     * @param B discrete-time linear system matrix B
+     * @param K resulting feedback matrix
+     * @param verbose print additional information
+     * @param eps treshold to stop iterating in the fallback
+     * @param maxIter maximum number of iterations in the fallback
+     * @return steady state riccati matrix P
+     */
+    state_matrix_t computeSteadyStateRiccatiMatrixDirect(const state_matrix_t& Q,
+        const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        control_feedback_t& K,
+        bool verbose = false,
+        const SCALAR eps = 1e-6,
+        size_t maxIter = 1000);
+
+    /*! solve the DARE with the structure-preserving doubling algorithm
+     * Converges quadratically, hence only few iterations are required even for lightly damped systems.
+     * Reference: E.K.-W. Chu, H.-Y. Fan, W.-W. Lin, "A structure-preserving doubling algorithm for discrete-time
+     * algebraic Riccati equations", Linear Algebra and its Applications, 2005
+     * @param P resulting riccati matrix
+     * @param relTol relative tolerance on the change of P
+     * @param maxIter maximum number of doubling steps
+     * @return true if converged
+     */
+    bool solveDoubling(const state_matrix_t& Q,
+        const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        state_matrix_t& P,
+        const SCALAR relTol = 1e-12,
+        size_t maxIter = 50);
+
+    /*! solve the DARE through the stable deflating subspace of the symplectic pencil, computed by an ordered QZ
+     * decomposition. Requires Lapack and SCALAR = double, returns false otherwise.
+     * @param P resulting riccati matrix
+     * @return true on success
+     */
+    bool solveSchurDirect(const state_matrix_t& Q,
+        const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        state_matrix_t& P);
+
+    //! compute the feedback matrix K = -(R + B^T P B)^{-1} B^T P A corresponding to the riccati matrix P
+    static control_feedback_t computeFeedback(const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        const state_matrix_t& P);
 
 private:
-    DynamicRiccatiEquation<STATE_DIM, CONTROL_DIM> dynamicRDE_;
+    typedef Eigen::Matrix<double, 2 * STATE_DIM, 2 * STATE_DIM> pencil_matrix_t;
+
+    bool solveSchurDirect(const state_matrix_t& Q,
+        const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        state_matrix_t& P,
+        std::true_type isDouble);
+
+    bool solveSchurDirect(const state_matrix_t& Q,
+        const control_matrix_t& R,
+        const state_matrix_t& A,
+        const control_gain_matrix_t& B,
+        state_matrix_t& P,
+        std::false_type isDouble)
+    {
+        return false;
+    }
+
+    //! eigenvalue selection for the QZ reordering, selects the eigenvalues inside the unit circle
+    static int selectStableEigenvalue(const double* alphaReal, const double* alphaImag, const double* beta)
+    {
+        return static_cast<int>((*alphaReal) * (*alphaReal) + (*alphaImag) * (*alphaImag) < (*beta) * (*beta));
+    }
+
+    DynamicRiccatiEquation<STATE_DIM, CONTROL_DIM, SCALAR> dynamicRDE_;
 };
 
 }  // namespace optcon
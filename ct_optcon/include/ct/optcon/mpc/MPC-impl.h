@@ -137,6 +137,8 @@ void MPC<OPTCON_SOLVER>::doForwardIntegration(const Scalar_t& t_forward_start,
 template <typename OPTCON_SOLVER>
 void MPC<OPTCON_SOLVER>::prepareIteration(const Scalar_t& extTime)
 {
+    CT_PROFILE_SCOPE("MPC::prepareIteration");
+
 #ifdef DEBUG_PRINT_MPC
     std::cout << "DEBUG_PRINT_MPC: started to prepare MPC iteration() " << std::endl;
 #endif  //DEBUG_PRINT_MPC
@@ -180,6 +182,8 @@ bool MPC<OPTCON_SOLVER>::finishIteration(const core::StateVector<STATE_DIM, Scal
     Scalar_t& newPolicy_ts,
     const std::shared_ptr<core::Controller<STATE_DIM, CONTROL_DIM, Scalar_t>> forwardIntegrationController)
 {
+    CT_PROFILE_SCOPE("MPC::finishIteration");
+
 #ifdef DEBUG_PRINT_MPC
     std::cout << "DEBUG_PRINT_MPC: started mpc finish Iteration() with state-timestamp " << x_ts << std::endl;
 #endif  //DEBUG_PRINT_MPC
@@ -266,6 +270,20 @@ bool MPC<OPTCON_SOLVER>::finishIteration(const core::StateVector<STATE_DIM, Scal
 }
 
 
+template <typename OPTCON_SOLVER>
+void MPC<OPTCON_SOLVER>::setDeadline(const std::chrono::steady_clock::time_point& deadline)
+{
+    solver_.setDeadline(deadline);
+}
+
+
+template <typename OPTCON_SOLVER>
+void MPC<OPTCON_SOLVER>::clearDeadline()
+{
+    solver_.clearDeadline();
+}
+
+
 template <typename OPTCON_SOLVER>
 void MPC<OPTCON_SOLVER>::resetMpc(const Scalar_t& newTimeHorizon)
 {
@@ -5,6 +5,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <chrono>
 #include <type_traits>
 
 #include <ct/optcon/problem/ContinuousOptConProblem.h>
@@ -176,6 +177,18 @@ public:
             nullptr);
 
 
+    //! set a wall-clock deadline for the solver, by which the next finishIteration() needs to return
+    /*!
+     * The solver skips or truncates phases (line-search candidates, constraint linearizations on distant stages)
+     * which are not expected to complete before the deadline, and always returns the best policy found so far.
+     * @param deadline absolute deadline on the steady clock
+     */
+    void setDeadline(const std::chrono::steady_clock::time_point& deadline);
+
+    //! remove the solver deadline
+    void clearDeadline();
+
+
     //! reset the mpc problem and provide new problem time horizon (mandatory)
     void resetMpc(const Scalar_t& newTimeHorizon);
 
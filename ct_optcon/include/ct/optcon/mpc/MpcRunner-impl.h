@@ -0,0 +1,182 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+template <typename OPTCON_SOLVER>
+MpcRunner<OPTCON_SOLVER>::MpcRunner(std::shared_ptr<MPC_t> mpc,
+    const double iterationBudget,
+    const std::chrono::microseconds& idlePeriod)
+    : mpc_(mpc),
+      iterationBudget_(iterationBudget),
+      idlePeriod_(idlePeriod),
+      stopRequested_(false),
+      running_(false),
+      numIterations_(0)
+{
+    if (!mpc_)
+        throw std::runtime_error("MpcRunner: MPC instance must not be empty.");
+}
+
+
+template <typename OPTCON_SOLVER>
+MpcRunner<OPTCON_SOLVER>::~MpcRunner()
+{
+    stop();
+}
+
+
+template <typename OPTCON_SOLVER>
+void MpcRunner<OPTCON_SOLVER>::setSolverThreadAffinity(const std::vector<int>& cores)
+{
+    solverCores_ = cores;
+}
+
+
+template <typename OPTCON_SOLVER>
+void MpcRunner<OPTCON_SOLVER>::start()
+{
+    if (solverThread_.joinable())
+        throw std::runtime_error("MpcRunner: solver thread was already started.");
+
+    stopRequested_ = false;
+    running_ = true;
+    solverThread_ = std::thread(&MpcRunner::run, this);
+    if (!solverCores_.empty() && !ct::core::setThreadAffinity(solverThread_, solverCores_))
+        std::cout << "MpcRunner: could not set the affinity of the solver thread." << std::endl;
+}
+
+
+template <typename OPTCON_SOLVER>
+void MpcRunner<OPTCON_SOLVER>::stop()
+{
+    stopRequested_ = true;
+    if (solverThread_.joinable())
+        solverThread_.join();
+}
+
+
+template <typename OPTCON_SOLVER>
+bool MpcRunner<OPTCON_SOLVER>::isRunning() const
+{
+    return running_;
+}
+
+
+template <typename OPTCON_SOLVER>
+size_t MpcRunner<OPTCON_SOLVER>::getNumIterations() const
+{
+    return numIterations_;
+}
+
+
+template <typename OPTCON_SOLVER>
+void MpcRunner<OPTCON_SOLVER>::setState(const state_vector_t& x, const Scalar_t& ts)
+{
+    TimedState& s = stateBuffer_.back();
+    s.x = x;
+    s.timestamp = ts;
+    stateBuffer_.publish();
+}
+
+
+template <typename OPTCON_SOLVER>
+bool MpcRunner<OPTCON_SOLVER>::updatePolicy()
+{
+    return policyBuffer_.update();
+}
+
+
+template <typename OPTCON_SOLVER>
+bool MpcRunner<OPTCON_SOLVER>::hasPolicy() const
+{
+    return policyBuffer_.frontSequence() > 0;
+}
+
+
+template <typename OPTCON_SOLVER>
+typename MpcRunner<OPTCON_SOLVER>::Policy_t& MpcRunner<OPTCON_SOLVER>::getPolicy()
+{
+    return policyBuffer_.front().policy;
+}
+
+
+template <typename OPTCON_SOLVER>
+const typename MpcRunner<OPTCON_SOLVER>::Scalar_t& MpcRunner<OPTCON_SOLVER>::getPolicyTimestamp() const
+{
+    return policyBuffer_.front().timestamp;
+}
+
+
+template <typename OPTCON_SOLVER>
+bool MpcRunner<OPTCON_SOLVER>::computeControl(const state_vector_t& x, const Scalar_t& ts, control_vector_t& u)
+{
+    updatePolicy();
+
+    if (!hasPolicy())
+        return false;
+
+    TimedPolicy& p = policyBuffer_.front();
+    p.policy.computeControl(x, ts - p.timestamp, u);
+    return true;
+}
+
+
+template <typename OPTCON_SOLVER>
+void MpcRunner<OPTCON_SOLVER>::run()
+{
+    bool prepared = false;
+
+    while (!stopRequested_)
+    {
+        // one iteration per state measurement
+        if (!stateBuffer_.update())
+        {
+            std::this_thread::sleep_for(idlePeriod_);
+            continue;
+        }
+
+        if (!prepared)
+        {
+            mpc_->prepareIteration(stateBuffer_.front().timestamp);
+            prepared = true;
+
+            // the preparation may take a while, use the most recent measurement
+            stateBuffer_.update();
+        }
+
+        const TimedState& s = stateBuffer_.front();
+
+        if (iterationBudget_ > 0.0)
+            mpc_->setDeadline(std::chrono::steady_clock::now() +
+                              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(iterationBudget_)));
+
+        TimedPolicy& p = policyBuffer_.back();
+        bool success = mpc_->finishIteration(s.x, s.timestamp, p.policy, p.timestamp);
+
+        if (success)
+            policyBuffer_.publish();
+
+        numIterations_++;
+
+        if (mpc_->timeHorizonReached())
+            break;
+
+        // prepare the next iteration while the control thread is busy applying the new policy
+        mpc_->prepareIteration(s.timestamp);
+    }
+
+    if (iterationBudget_ > 0.0)
+        mpc_->clearDeadline();
+
+    running_ = false;
+}
+
+}  // namespace optcon
+}  // namespace ct
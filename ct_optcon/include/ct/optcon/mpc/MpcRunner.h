@@ -0,0 +1,153 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "MPC.h"
+#include "TripleBuffer.h"
+
+namespace ct {
+namespace optcon {
+
+
+/**
+ * \ingroup MPC
+ *
+ * \brief Runs MPC in a dedicated solver thread and publishes its policies wait-free to a control thread
+ *
+ * The control thread hands over state measurements with setState() and obtains the latest policy through
+ * updatePolicy() / getPolicy() or directly evaluates it with computeControl(). States and policies are exchanged
+ * through triple buffers, such that neither thread ever blocks on the other and the control thread never copies a
+ * policy. Exactly one control thread may interact with the runner.
+ *
+ * The solver thread performs one MPC iteration per received state measurement, using the state time stamps as
+ * external MPC time. Make sure to enable mpc_settings::useExternalTiming_ accordingly.
+ *
+ * @tparam OPTCON_SOLVER the optimal control solver used by MPC
+ */
+template <typename OPTCON_SOLVER>
+class MpcRunner
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const size_t STATE_DIM = OPTCON_SOLVER::STATE_D;
+    static const size_t CONTROL_DIM = OPTCON_SOLVER::CONTROL_D;
+
+    using MPC_t = MPC<OPTCON_SOLVER>;
+    using Scalar_t = typename MPC_t::Scalar_t;
+    using Policy_t = typename MPC_t::Policy_t;
+    using state_vector_t = core::StateVector<STATE_DIM, Scalar_t>;
+    using control_vector_t = core::ControlVector<CONTROL_DIM, Scalar_t>;
+
+    //! a policy together with the (external) time at which it starts
+    struct TimedPolicy
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        Policy_t policy;
+        Scalar_t timestamp = Scalar_t(0.0);
+    };
+
+    //! a state measurement together with its (external) time stamp
+    struct TimedState
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        state_vector_t x = state_vector_t::Zero();
+        Scalar_t timestamp = Scalar_t(0.0);
+    };
+
+    //! constructor
+    /*!
+     * @param mpc the MPC instance, which must not be used by anybody else while the runner is active
+     * @param iterationBudget if positive, every MPC iteration receives a solver deadline this many seconds
+     *  after it started (see MPC::setDeadline())
+     * @param idlePeriod time the solver thread sleeps while waiting for a new state measurement
+     */
+    MpcRunner(std::shared_ptr<MPC_t> mpc,
+        const double iterationBudget = 0.0,
+        const std::chrono::microseconds& idlePeriod = std::chrono::microseconds(100));
+
+    //! destructor, stops the solver thread
+    ~MpcRunner();
+
+    MpcRunner(const MpcRunner&) = delete;
+    MpcRunner& operator=(const MpcRunner&) = delete;
+
+    //! restrict the solver thread to the given cores, takes effect at the next start()
+    /*!
+     * Pinning the solver thread keeps its working set in the caches (and on the NUMA node) of these cores and keeps it
+     * away from the cores of the control thread. An empty list allows all cores.
+     */
+    void setSolverThreadAffinity(const std::vector<int>& cores);
+
+    //! start the solver thread
+    void start();
+
+    //! stop the solver thread, waits for the current MPC iteration to finish
+    void stop();
+
+    //! true while the solver thread is active. It terminates itself once the MPC time horizon is reached.
+    bool isRunning() const;
+
+    //! number of MPC iterations performed by the solver thread so far
+    size_t getNumIterations() const;
+
+    //! control thread: provide a new state measurement (wait-free)
+    void setState(const state_vector_t& x, const Scalar_t& ts);
+
+    //! control thread: fetch the latest published policy (wait-free)
+    /*!
+     * @return true if a new policy was fetched since the last call
+     */
+    bool updatePolicy();
+
+    //! control thread: true if at least one policy was received
+    bool hasPolicy() const;
+
+    //! control thread: the policy fetched by the last updatePolicy() call
+    Policy_t& getPolicy();
+
+    //! control thread: the (external) start time of the policy returned by getPolicy()
+    const Scalar_t& getPolicyTimestamp() const;
+
+    //! control thread: fetch the latest policy and evaluate it, does not allocate
+    /*!
+     * @param x the current state
+     * @param ts the current (external) time
+     * @param u the resulting control action
+     * @return false if no policy was received yet, in which case u is left untouched
+     */
+    bool computeControl(const state_vector_t& x, const Scalar_t& ts, control_vector_t& u);
+
+private:
+    //! the solver thread
+    void run();
+
+    std::shared_ptr<MPC_t> mpc_;
+
+    double iterationBudget_;
+    std::chrono::microseconds idlePeriod_;
+
+    //! control thread -> solver thread
+    TripleBuffer<TimedState> stateBuffer_;
+
+    //! solver thread -> control thread
+    TripleBuffer<TimedPolicy> policyBuffer_;
+
+    std::thread solverThread_;
+    std::vector<int> solverCores_;
+    std::atomic<bool> stopRequested_;
+    std::atomic<bool> running_;
+    std::atomic<size_t> numIterations_;
+};
+
+}  // namespace optcon
+}  // namespace ct
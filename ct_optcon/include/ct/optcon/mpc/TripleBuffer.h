@@ -0,0 +1,94 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ct {
+namespace optcon {
+
+
+/*!
+ * \ingroup MPC
+ *
+ * \brief Wait-free single-producer / single-consumer triple buffer
+ *
+ * The producer fills its private back buffer and publishes it by swapping it with the shared middle buffer.
+ * The consumer swaps the middle buffer with its private front buffer whenever fresh data is available.
+ * Both operations consist of a single atomic exchange, hence neither side can ever block the other and
+ * no data is copied during the swap. The buffers are allocated once at construction, such that element types which
+ * reuse their memory on assignment (e.g. fixed-size trajectories) cause no allocations after warm-up.
+ *
+ * Exactly one thread may write and exactly one thread may read.
+ *
+ * @tparam T the buffered type, needs to be default constructible
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() : middle_(1), back_(2), sequence_(0), front_(0), frontSequence_(0)
+    {
+        sequences_.fill(0);
+    }
+
+    //! initialize all three buffers with the same value. Not thread-safe, call before using the buffer concurrently.
+    explicit TripleBuffer(const T& init) : TripleBuffer() { buffers_.fill(init); }
+
+    //! producer: access the private back buffer
+    T& back() { return buffers_[back_]; }
+
+    //! producer: publish the back buffer, which makes it available to the consumer
+    void publish()
+    {
+        sequences_[back_] = ++sequence_;
+        back_ = middle_.exchange(back_ | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    //! consumer: fetch the most recently published buffer, if there is a new one
+    /*!
+     * @return true if the front buffer was updated, false if nothing was published since the last call
+     */
+    bool update()
+    {
+        if (!(middle_.load(std::memory_order_acquire) & FRESH_BIT))
+            return false;
+
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+        frontSequence_ = sequences_[front_];
+        return true;
+    }
+
+    //! consumer: access the private front buffer
+    T& front() { return buffers_[front_]; }
+    const T& front() const { return buffers_[front_]; }
+
+    //! consumer: number of publications up to and including the current front buffer, zero if none was received yet
+    uint64_t frontSequence() const { return frontSequence_; }
+
+private:
+    static const uint8_t INDEX_MASK = 0x3;
+    static const uint8_t FRESH_BIT = 0x4;
+
+    std::array<T, 3> buffers_;
+    std::array<uint64_t, 3> sequences_;
+
+    //! index of the shared buffer, with the fresh bit set if it was not consumed yet
+    std::atomic<uint8_t> middle_;
+
+    //! producer-owned state
+    uint8_t back_;
+    uint64_t sequence_;
+
+    //! consumer-owned state
+    uint8_t front_;
+    uint64_t frontSequence_;
+};
+
+}  // namespace optcon
+}  // namespace ct
@@ -55,7 +55,8 @@ NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::NLOCB
       inputBoxConstraints_(settings.nThreads + 1, nullptr),  // initialize constraints with null
       stateBoxConstraints_(settings.nThreads + 1, nullptr),  // initialize constraints with null
       generalConstraints_(settings.nThreads + 1, nullptr),   // initialize constraints with null
-      lqpCounter_(0)
+      lqpCounter_(0),
+      constraintLinearizationHorizon_(std::numeric_limits<size_t>::max())
 {
     Eigen::initParallel();
 
@@ -264,6 +265,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     // TODO: this should be multi-threaded to save time
     if (iteration_ > 0 && (settings_.lineSearchSettings.type != LineSearchSettings::TYPE::NONE))
         computeCostsOfTrajectory(settings_.nThreads, x_, u_ff_, intermediateCostBest_, finalCostBest_);
+
+    instancesChanged();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
@@ -271,6 +274,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     const typename OptConProblem_t::DynamicsPtr_t& dyn)
 {
     systemInterface_->changeNonlinearSystem(dyn);
+
+    instancesChanged();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
@@ -293,6 +298,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
         computeBoxConstraintErrorOfTrajectory(settings_.nThreads, x_, u_ff_, e_box_norm_);
 
     setInputBoxConstraintsForLQOCProblem();
+
+    instancesChanged();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
@@ -315,6 +322,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
         computeBoxConstraintErrorOfTrajectory(settings_.nThreads, x_, u_ff_, e_box_norm_);
 
     setStateBoxConstraintsForLQOCProblem();
+
+    instancesChanged();
 }
 
 
@@ -333,31 +342,27 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
         generalConstraints_[i] = typename OptConProblem_t::ConstraintPtr_t(con->clone());
     }
 
-    // intermediate stages
+    // the constraint containers of the LQ problem are reserved for the largest number of constraints of all stages
+    // here, since the stage-wise, possibly parallel linearization must not grow them
+    std::vector<int> nConstraints(K_ + 1);
     for (int i = 0; i < K_; i++)
     {
         generalConstraints_[settings_.nThreads]->setCurrentStateAndControl(x_[i], u_ff_[i], i * settings_.dt);
-
-        lqocProblem_->ng_[i] = generalConstraints_[settings_.nThreads]->getIntermediateConstraintsCount();
-
-        lqocProblem_->C_[i].resize(lqocProblem_->ng_[i], STATE_DIM);
-        lqocProblem_->D_[i].resize(lqocProblem_->ng_[i], CONTROL_DIM);
-        lqocProblem_->d_lb_[i].resize(lqocProblem_->ng_[i], 1);
-        lqocProblem_->d_ub_[i].resize(lqocProblem_->ng_[i], 1);
+        nConstraints[i] = generalConstraints_[settings_.nThreads]->getIntermediateConstraintsCount();
     }
+    nConstraints[K_] = generalConstraints_[settings_.nThreads]->getTerminalConstraintsCount();
 
-    // terminal stage
-    lqocProblem_->ng_[K_] = generalConstraints_[settings_.nThreads]->getTerminalConstraintsCount();
-    lqocProblem_->C_[K_].resize(lqocProblem_->ng_[K_], STATE_DIM);
-    lqocProblem_->D_[K_].resize(lqocProblem_->ng_[K_], CONTROL_DIM);
-    lqocProblem_->d_lb_[K_].resize(lqocProblem_->ng_[K_], 1);
-    lqocProblem_->d_ub_[K_].resize(lqocProblem_->ng_[K_], 1);
+    lqocProblem_->reserveGeneralConstraints(*std::max_element(nConstraints.begin(), nConstraints.end()));
+    for (int i = 0; i < K_ + 1; i++)
+        lqocProblem_->setGeneralConstraintCount(i, nConstraints[i]);
 
     lqocSolver_->setProblem(lqocProblem_);
 
     // TODO can we do this multi-threaded?
     if (iteration_ > 0 && (settings_.lineSearchSettings.type != LineSearchSettings::TYPE::NONE))
         computeGeneralConstraintErrorOfTrajectory(settings_.nThreads, x_, u_ff_, e_gen_norm_);
+
+    instancesChanged();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
@@ -365,6 +370,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     const typename OptConProblem_t::LinearPtr_t& lin)
 {
     systemInterface_->changeLinearSystem(lin);
+
+    instancesChanged();
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
@@ -381,6 +388,27 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     }
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+template <typename S>
+typename std::enable_if<std::is_same<S, double>::value, void>::type
+NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::createHPIPMSolver()
+{
+#ifdef HPIPM
+    lqocSolver_ = std::shared_ptr<HPIPMInterface<STATE_DIM, CONTROL_DIM>>(new HPIPMInterface<STATE_DIM, CONTROL_DIM>());
+#else
+    throw std::runtime_error("HPIPM selected but not built.");
+#endif
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+template <typename S>
+typename std::enable_if<!std::is_same<S, double>::value, void>::type
+NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::createHPIPMSolver()
+{
+    throw std::runtime_error("HPIPM is only available in double precision.");
+}
+
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::configure(const Settings_t& settings)
 {
@@ -399,17 +427,16 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     // select the linear quadratic solver based on settings file
     if (settings.lqocp_solver == NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER)
     {
-        lqocSolver_ = std::shared_ptr<GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>>(
-            new GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>());
+        if (settings.doublePrecisionRiccati && !std::is_same<SCALAR, double>::value)
+            lqocSolver_ = std::shared_ptr<MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>>(
+                new MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>());
+        else
+            lqocSolver_ = std::shared_ptr<GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>>(
+                new GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>());
     }
     else if (settings.lqocp_solver == NLOptConSettings::LQOCP_SOLVER::HPIPM_SOLVER)
     {
-#ifdef HPIPM
-        lqocSolver_ =
-            std::shared_ptr<HPIPMInterface<STATE_DIM, CONTROL_DIM>>(new HPIPMInterface<STATE_DIM, CONTROL_DIM>());
-#else
-        throw std::runtime_error("HPIPM selected but not built.");
-#endif
+        createHPIPMSolver();
     }
     else
         throw std::runtime_error("Solver for Linear Quadratic Optimal Control Problem wrongly specified.");
@@ -425,6 +452,11 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 
     lqocSolver_->configure(settings);
 
+    timeBudget_.setSafetyFactor(settings.timeBudgetSafetyFactor);
+
+    if (!settings.logToTrace || settings.loggingPrefix != settings_.loggingPrefix)
+        traceWriter_.reset();
+
     settings_ = settings;
 
     reset();
@@ -443,6 +475,8 @@ bool NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     ControlSubsteps& substepsU,
     std::atomic_bool* terminationFlag) const
 {
+    CT_PROFILE_SCOPE("NLOC::rolloutSingleShot");
+
     const int K_local = K_;
 
     if (u_local.size() < (size_t)K_)
@@ -706,20 +740,16 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     // feed current state and control to cost function
     costFunctions_[threadId]->setCurrentStateAndControl(x_[k], u_ff_[k], dt * k);
 
-    // By using the following order of evaluations, we avoid caching matrices
-    // second derivative w.r.t state
-    p.Q_[k] = costFunctions_[threadId]->stateSecondDerivativeIntermediate() * dt;
-    // second derivative w.r.t control
-    p.R_[k] = costFunctions_[threadId]->controlSecondDerivativeIntermediate() * dt;
-    // cross terms
-    p.P_[k] = costFunctions_[threadId]->stateControlDerivativeIntermediate() * dt;
-
-    // derivative of cost with respect to state
-    p.qv_[k] = costFunctions_[threadId]->stateDerivativeIntermediate() * dt;
-    // derivative of cost with respect to control
-    p.rv_[k] = costFunctions_[threadId]->controlDerivativeIntermediate() * dt;
+    // value, first and second order derivatives of the cost in a single pass over the cost terms
+    QuadraticCostModel<STATE_DIM, CONTROL_DIM, SCALAR> costModel;
+    costFunctions_[threadId]->quadraticModelIntermediate(costModel);
 
-    // p.q_[k] = ... // not evaluated since we don't need it in GNMS/iLQR -- WARNING, potentially implement when using a different QP solver
+    p.q_[k] = costModel.q * dt;
+    p.qv_[k] = costModel.qv * dt;
+    p.Q_[k] = costModel.Q * dt;
+    p.rv_[k] = costModel.rv * dt;
+    p.R_[k] = costModel.R * dt;
+    p.P_[k] = costModel.P * dt;
 }
 
 
@@ -797,24 +827,83 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
         LQOCProblem_t& p = *lqocProblem_;
         const scalar_t& dt = settings_.dt;
 
+        // when running against a deadline, distant stages may keep their Jacobians from the previous iteration
+        const bool reuseJacobians = k > constraintLinearizationHorizon_ && p.ng_[k] > 0;
+
+        const auto start = NLOCTimeBudget::clock_t::now();
+
         // treat general constraints
         generalConstraints_[threadId]->setCurrentStateAndControl(x_[k], u_ff_[k], dt * k);
 
-        p.ng_[k] = generalConstraints_[threadId]->getIntermediateConstraintsCount();
-        if (p.ng_[k] > 0)
+        if (!reuseJacobians)
         {
-            p.C_[k] = generalConstraints_[threadId]->jacobianStateIntermediate();
-            p.D_[k] = generalConstraints_[threadId]->jacobianInputIntermediate();
+            // growing the constraint containers would move the data of all stages, which other threads may access
+            const int nConstraints = generalConstraints_[threadId]->getIntermediateConstraintsCount();
+            if (nConstraints > p.getGeneralConstraintCapacity())
+                throw std::runtime_error("NLOCBackendBase: " + std::to_string(nConstraints) +
+                                         " general constraints at stage " + std::to_string(k) + " exceed the " +
+                                         std::to_string(p.getGeneralConstraintCapacity()) +
+                                         " reserved by changeGeneralConstraints().");
+
+            p.setGeneralConstraintCount(k, nConstraints);
+            if (p.ng_[k] > 0)
+            {
+                p.C_[k] = generalConstraints_[threadId]->jacobianStateIntermediate();
+                p.D_[k] = generalConstraints_[threadId]->jacobianInputIntermediate();
+            }
+        }
 
+        if (p.ng_[k] > 0)
+        {
+            // the bounds are relative to the current iterate, hence they are updated at every stage
             Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> g_eval = generalConstraints_[threadId]->evaluateIntermediate();
 
             // rewrite constraint boundaries in relative coordinates as required by LQOC problem
             p.d_lb_[k] = generalConstraints_[threadId]->getLowerBoundsIntermediate() - g_eval;
             p.d_ub_[k] = generalConstraints_[threadId]->getUpperBoundsIntermediate() - g_eval;
         }
+
+        if (!reuseJacobians)
+            timeBudget_.recordSince(NLOCTimeBudget::CONSTRAINT_LINEARIZATION, start);
     }
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::updateConstraintLinearizationHorizon(
+    size_t firstIndex,
+    size_t lastIndex,
+    size_t parallelism)
+{
+    const size_t nStages = lastIndex - firstIndex + 1;
+    const size_t nAffordable = timeBudget_.affordable(
+        NLOCTimeBudget::CONSTRAINT_LINEARIZATION, parallelism, settings_.timeBudgetConstraintShare, nStages);
+
+    if (nAffordable >= nStages)
+        constraintLinearizationHorizon_ = std::numeric_limits<size_t>::max();
+    else
+        constraintLinearizationHorizon_ = firstIndex + nAffordable;  // the first stage is always re-linearized
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::setDeadline(
+    const NLOCTimeBudget::time_point_t& deadline)
+{
+    timeBudget_.setDeadline(deadline);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::clearDeadline()
+{
+    timeBudget_.clearDeadline();
+    constraintLinearizationHorizon_ = std::numeric_limits<size_t>::max();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+NLOCTimeBudget& NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getTimeBudget()
+{
+    return timeBudget_;
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::initializeCostToGo()
 {
@@ -831,7 +920,7 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     // init terminal general constraints, if any
     if (generalConstraints_[settings_.nThreads] != nullptr)
     {
-        p.ng_[K_] = generalConstraints_[settings_.nThreads]->getTerminalConstraintsCount();
+        p.setGeneralConstraintCount(K_, generalConstraints_[settings_.nThreads]->getTerminalConstraintsCount());
         if (p.ng_[K_] > 0)
         {
             p.C_[K_] = generalConstraints_[settings_.nThreads]->jacobianStateTerminal();
@@ -974,6 +1063,75 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 #endif
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+ct::core::TraceWriter& NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getTraceWriter()
+{
+    if (!traceWriter_)
+        traceWriter_.reset(new ct::core::TraceWriter(settings_.loggingPrefix + ".cttrace"));
+    else if (!traceWriter_->good())
+        throw std::runtime_error(traceWriter_->errorMessage());
+
+    return *traceWriter_;
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::logToTrace(const size_t& iteration)
+{
+    if (!settings_.logToTrace)
+        return;
+
+    ct::core::TraceWriter& trace = getTraceWriter();
+
+    const bool logStages = iteration % settings_.traceDecimation == 0;
+    if (logStages)
+    {
+        trace.write("dt", iteration, SCALAR(settings_.dt));
+        trace.writeArray("x", iteration, x_);
+        trace.writeArray("u_ff", iteration, u_ff_);
+        trace.writeArray("L", iteration, L_);
+        trace.writeArray("d", iteration, d_);
+        trace.writeArray("xShot", iteration, xShot_);
+    }
+
+    if (logStages && settings_.logLQToTrace)
+    {
+        const LQOCProblem_t& p = *lqocProblem_;
+        trace.writeArray("A", iteration, p.A_);
+        trace.writeArray("B", iteration, p.B_);
+        trace.writeArray("qv", iteration, p.qv_);
+        trace.writeArray("Q", iteration, p.Q_);
+        trace.writeArray("P", iteration, p.P_);
+        trace.writeArray("rv", iteration, p.rv_);
+        trace.writeArray("R", iteration, p.R_);
+        trace.writeArray("q", iteration, p.q_);
+
+        lqocSolver_->logToTrace(trace, iteration);
+    }
+
+    trace.write("intermediateCost", iteration, SCALAR(intermediateCostBest_));
+    trace.write("finalCost", iteration, SCALAR(finalCostBest_));
+    trace.write("cost", iteration, getCost());
+    trace.write("alphaStep", iteration, SCALAR(alphaBest_));
+    trace.write("lx_norm", iteration, lx_norm_);
+    trace.write("lu_norm", iteration, lu_norm_);
+    trace.write("d_norm", iteration, d_norm_);
+    trace.write("e_box_norm", iteration, e_box_norm_);
+    trace.write("e_gen_norm", iteration, e_gen_norm_);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::logTimingToTrace(
+    const std::string& phase,
+    const double milliseconds)
+{
+    if (!settings_.logToTrace)
+        return;
+
+    // the name is assembled in a member, such that no memory is allocated once all phases have been logged
+    traceTimingName_.assign("time_").append(phase);
+    getTraceWriter().write(traceTimingName_, iteration_, milliseconds);
+}
+
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 const core::ControlTrajectory<CONTROL_DIM, SCALAR>
@@ -1009,6 +1167,8 @@ SCALAR NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 bool NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::lineSearch()
 {
+    CT_PROFILE_SCOPE("NLOC::lineSearch");
+
     // lowest cost
     scalar_t lowestCostPrevious;
 
@@ -1303,6 +1463,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::finishSolveLQProblem(size_t endIndex)
 {
+    CT_PROFILE_SCOPE("NLOC::finishSolveLQProblem");
+
     lqpCounter_++;
 
     // if solver is HPIPM, solve the full problem
@@ -1327,6 +1489,8 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::solveFullLQProblem()
 {
+    CT_PROFILE_SCOPE("NLOC::solveFullLQProblem");
+
     lqpCounter_++;
 
     lqocSolver_->setProblem(lqocProblem_);
@@ -1460,6 +1624,13 @@ void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
     summaryAllIterations_.logToMatlab(fileName);
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendBase<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::logSummaryToTrace(
+    const std::string& fileName)
+{
+    summaryAllIterations_.logToTrace(fileName);
+}
+
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 const SummaryAllIterations<SCALAR>&
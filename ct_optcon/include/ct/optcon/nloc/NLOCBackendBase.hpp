@@ -13,11 +13,13 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include <ct/optcon/problem/LQOCProblem.hpp>
 
 #include <ct/optcon/solver/lqp/GNRiccatiSolver.hpp>
+#include <ct/optcon/solver/lqp/MixedPrecisionRiccatiSolver.hpp>
 #include <ct/optcon/solver/lqp/HPIPMInterface.hpp>
 
 #include <ct/optcon/solver/NLOptConSettings.hpp>
 
 #include "NLOCResults.hpp"
+#include "NLOCTimeBudget.hpp"
 
 #ifdef MATLAB
 #include <ct/optcon/matlab.hpp>
@@ -185,6 +187,7 @@ public:
 
     /*!
      * \brief Change the general constraints
+     * Reserves the constraint containers of the LQ problem for the largest number of constraints of all stages.
      */
     void changeGeneralConstraints(const typename OptConProblem_t::ConstraintPtr_t& con);
 
@@ -275,6 +278,19 @@ public:
     //! log the initial guess to Matlab
     void logInitToMatlab();
 
+    //! append trajectories, costs and defects of the current iteration to the binary trace
+    /*!
+      Only active if the logToTrace setting is on. The LQ problem and the internals of the LQ solver are only logged
+      if the logLQToTrace setting is on as well. The trajectories and the LQ data are only logged every
+      traceDecimation-th iteration. The data is copied and written to disk from a background thread,
+      see ct::core::TraceWriter.
+      \throw std::runtime_error if writing an earlier record failed
+    */
+    void logToTrace(const size_t& iteration);
+
+    //! append the duration of a phase of the current iteration to the binary trace (if logToTrace is on)
+    void logTimingToTrace(const std::string& phase, const double milliseconds);
+
     //! return the cost of the solution of the current iteration
     SCALAR getCost() const;
 
@@ -380,9 +396,45 @@ public:
 
     void logSummaryToMatlab(const std::string& fileName);
 
+    //! write the summary of all iterations to the binary trace file <fileName>.cttrace
+    void logSummaryToTrace(const std::string& fileName);
+
     const SummaryAllIterations<SCALAR>& getSummary() const;
 
+    //! set a wall-clock deadline, which activates the anytime mode
+    /*!
+     * While a deadline is set, the backend truncates the line search and re-computes the Jacobians of the general
+     * constraints only at those stages that still fit into the remaining time. Stages which are skipped keep the
+     * Jacobians from the previous iteration, their bounds are still evaluated at the current iterate. The current
+     * iterate is only ever replaced by an accepted, better step.
+     */
+    void setDeadline(const NLOCTimeBudget::time_point_t& deadline);
+
+    //! remove the deadline, all phases get executed in full again
+    void clearDeadline();
+
+    //! access the time budget, which holds the deadline and the measured phase durations
+    NLOCTimeBudget& getTimeBudget();
+
 protected:
+    //! decide up to which stage the general constraints get re-linearized, based on the time budget
+    /*!
+     * @param firstIndex first stage of the upcoming LQ approximation
+     * @param lastIndex last stage of the upcoming LQ approximation
+     * @param parallelism number of stages which get linearized concurrently
+     */
+    void updateConstraintLinearizationHorizon(size_t firstIndex, size_t lastIndex, size_t parallelism);
+
+    //! called after the main thread re-created the systems, cost functions or constraints of all threads
+    virtual void instancesChanged() {}
+
+    //! the binary trace, opened on first use
+    /*!
+     * \throw std::runtime_error if writing an earlier record failed
+     */
+    ct::core::TraceWriter& getTraceWriter();
+
+
     //! integrate the individual shots
     bool rolloutSingleShot(const size_t threadId,
         const size_t k,
@@ -429,6 +481,7 @@ protected:
       \param k step k
 
       \note the box constraints do not need to be linearized
+      \note throws if the number of constraints exceeds the capacity reserved by changeGeneralConstraints()
     */
     void computeLinearizedConstraints(size_t threadId, size_t k);
 
@@ -533,6 +586,12 @@ protected:
      */
     void updateFFController(size_t k);
 
+    //! create the HPIPM solver, which is available in double precision only
+    template <typename S = SCALAR>
+    typename std::enable_if<std::is_same<S, double>::value, void>::type createHPIPMSolver();
+    template <typename S = SCALAR>
+    typename std::enable_if<!std::is_same<S, double>::value, void>::type createHPIPMSolver();
+
     //! compute norm of a discrete array (todo move to core)
     template <typename ARRAY_TYPE, size_t ORDER = 1>
     SCALAR computeDiscreteArrayNorm(const ARRAY_TYPE& d) const;
@@ -619,6 +678,16 @@ protected:
 
     SummaryAllIterations<SCALAR> summaryAllIterations_;
 
+    //! deadline and phase duration estimates for the anytime mode
+    NLOCTimeBudget timeBudget_;
+
+    //! stages beyond this index keep their previous constraint linearization (if any)
+    size_t constraintLinearizationHorizon_;
+
+    //! the binary trace, opened on first use by getTraceWriter()
+    std::unique_ptr<ct::core::TraceWriter> traceWriter_;
+    std::string traceTimingName_;  //!< buffer for the record names of logTimingToTrace()
+
     //! if building with MATLAB support, include matfile
 #ifdef MATLAB
     matlab::MatFile matFile_;
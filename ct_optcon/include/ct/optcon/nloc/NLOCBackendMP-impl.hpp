@@ -73,6 +73,9 @@ void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::th
 #endif  // DEBUG_PRINT_MP
 
 
+    size_t instancesGeneration_local = instancesGeneration_;
+    initializeWorker(threadId);
+
     // local variables
     int workerTask_local = IDLE;
     size_t uniqueProcessID = 0;
@@ -131,6 +134,14 @@ void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::th
             break;
         }
 
+        // re-create the instances on this worker's NUMA node if the main thread replaced them since the last task
+        if (workerTask_local != SHUTDOWN && instancesGeneration_local != instancesGeneration_)
+        {
+            instancesGeneration_local = instancesGeneration_;
+            std::lock_guard<std::mutex> lock(workerInitMutex_);
+            createWorkerInstances(threadId);
+        }
+
 
         switch (workerTask_local)
         {
@@ -200,11 +211,59 @@ void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::la
 
     workersActive_ = true;
     workerTask_ = IDLE;
+    workersInitialized_ = 0;
+    instancesGeneration_ = 0;
 
     for (int i = 0; i < (int)this->settings_.nThreads; i++)
     {
         workerThreads_.push_back(std::thread(&NLOCBackendMP::threadWork, this, i));
     }
+
+    // the instances of the workers must not be used before they are placed
+    std::unique_lock<std::mutex> lock(workerInitMutex_);
+    workerInitCondition_.wait(lock, [this] { return workersInitialized_ == workerThreads_.size(); });
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::initializeWorker(size_t threadId)
+{
+    ct::core::pinCurrentThread(this->settings_.workerCores, threadId);
+
+    // the workers take turns, as cloning may not be thread-safe
+    std::lock_guard<std::mutex> lock(workerInitMutex_);
+
+    if (this->settings_.workerLocalInstances)
+        createWorkerInstances(threadId);
+
+    workersInitialized_++;
+    workerInitCondition_.notify_all();
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::createWorkerInstances(size_t threadId)
+{
+    // memory is placed on the NUMA node of the thread which touches it first
+    this->systemInterface_->initializeThread(threadId);
+
+    this->costFunctions_[threadId] =
+        typename OptConProblem_t::CostFunctionPtr_t(this->costFunctions_[threadId]->clone());
+
+    for (auto* constraints : {&this->inputBoxConstraints_, &this->stateBoxConstraints_, &this->generalConstraints_})
+    {
+        if ((*constraints)[threadId])
+            (*constraints)[threadId] = typename OptConProblem_t::ConstraintPtr_t((*constraints)[threadId]->clone());
+    }
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::instancesChanged()
+{
+    // the change*() methods cloned the new instances on the calling thread, the workers are idle in the meantime
+    if (this->settings_.workerLocalInstances)
+        instancesGeneration_++;
 }
 
 
@@ -212,10 +271,14 @@ template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, type
 void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::computeLQApproximation(size_t firstIndex,
     size_t lastIndex)
 {
+    CT_PROFILE_SCOPE("NLOC::computeLQApproximation");
+
     // fill terminal cost
     if (lastIndex == (static_cast<size_t>(this->K_) - 1))
         this->initializeCostToGo();
 
+    this->updateConstraintLinearizationHorizon(firstIndex, lastIndex, this->settings_.nThreads);
+
     /*
 	 * In special cases, this function may be called for a single index, e.g. for the unconstrained GNMS real-time iteration scheme.
 	 * Then, don't wake up workers, but do single-threaded computation for that single index, and return.
@@ -410,30 +473,41 @@ SCALAR NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 {
     Eigen::setNbThreads(1);  // disable Eigen multi-threading
 
+    // truncate the candidate step sizes to those which fit into the time budget (if there is one)
+    const size_t nAlphas = this->timeBudget_.affordable(NLOCTimeBudget::LINE_SEARCH_CANDIDATE,
+        this->settings_.nThreads, 1.0, this->settings_.lineSearchSettings.maxIterations);
+
     alphaProcessed_.clear();
     alphaTaken_ = 0;
     alphaBestFound_ = false;
-    alphaExpBest_ = this->settings_.lineSearchSettings.maxIterations;
-    alphaExpMax_ = this->settings_.lineSearchSettings.maxIterations;
+    alphaExpBest_ = nAlphas;
+    alphaExpMax_ = nAlphas;
     alphaProcessed_.resize(this->settings_.lineSearchSettings.maxIterations, 0);
     lowestCostPrevious_ = this->lowestCost_;
 
+    if (nAlphas > 0)
+    {
 #ifdef DEBUG_PRINT_MP
-    std::cout << "[MP]: Waking up workers." << std::endl;
+        std::cout << "[MP]: Waking up workers." << std::endl;
 #endif  //DEBUG_PRINT_MP
-    workerTask_ = LINE_SEARCH;
-    workerWakeUpCondition_.notify_all();
+        workerTask_ = LINE_SEARCH;
+        workerWakeUpCondition_.notify_all();
 
 #ifdef DEBUG_PRINT_MP
-    std::cout << "[MP]: Will sleep now until done line search." << std::endl;
+        std::cout << "[MP]: Will sleep now until done line search." << std::endl;
 #endif  //DEBUG_PRINT_MP
-    std::unique_lock<std::mutex> waitLock(alphaBestFoundMutex_);
-    alphaBestFoundCondition_.wait(waitLock, [this] { return alphaBestFound_.load(); });
-    waitLock.unlock();
-    workerTask_ = IDLE;
+        std::unique_lock<std::mutex> waitLock(alphaBestFoundMutex_);
+        alphaBestFoundCondition_.wait(waitLock, [this] { return alphaBestFound_.load(); });
+        waitLock.unlock();
+        workerTask_ = IDLE;
 #ifdef DEBUG_PRINT_MP
-    std::cout << "[MP]: Woke up again, should have results now." << std::endl;
+        std::cout << "[MP]: Woke up again, should have results now." << std::endl;
 #endif  //DEBUG_PRINT_MP
+    }
+    else if (this->settings_.lineSearchSettings.debugPrint)
+    {
+        printString("[LineSearch]: Time budget exhausted, no step size evaluated.");
+    }
 
     double alphaBest = 0.0;
     if (alphaExpBest_ != alphaExpMax_)
@@ -477,6 +551,8 @@ void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::li
             return;
         }
 
+        const auto startCandidate = NLOCTimeBudget::clock_t::now();
+
         //! convert to real alpha
         double alpha =
             this->settings_.lineSearchSettings.alpha_0 * std::pow(this->settings_.lineSearchSettings.n_alpha, alphaExp);
@@ -501,6 +577,10 @@ void NLOCBackendMP<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::li
         this->executeLineSearch(threadId, alpha, x_search, x_shot_search, defects_recorded, u_recorded,
             intermediateCost, finalCost, defectNorm, e_box_norm, e_gen_norm, *substepsX, *substepsU, &alphaBestFound_);
 
+        // only complete evaluations are representative for the cost of a candidate
+        if (!alphaBestFound_)
+            this->timeBudget_.recordSince(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, startCandidate);
+
         lineSearchResultMutex_.lock();
         
         // check for step acceptance and get new merit/cost
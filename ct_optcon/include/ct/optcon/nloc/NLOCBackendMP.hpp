@@ -54,6 +54,9 @@ protected:
 
     SCALAR performLineSearch() override;
 
+    //! lets every worker re-create its instances before its next task, if workerLocalInstances is set
+    virtual void instancesChanged() override;
+
 private:
     enum WORKER_STATE
     {
@@ -80,6 +83,18 @@ private:
 	 */
     void threadWork(size_t threadId);
 
+    //! Places a worker according to the settings, called by the worker itself before its first task
+    /*!
+	  Pins the worker to its core and, if workerLocalInstances is set, creates its worker-local instances.
+	 */
+    void initializeWorker(size_t threadId);
+
+    //! Re-creates the systems, cost function and constraints dedicated to the worker, called by the worker itself
+    /*!
+	  Such that they are allocated on the worker's NUMA node. Requires workerInitMutex_ to be locked.
+	 */
+    void createWorkerInstances(size_t threadId);
+
     //! Line search for new controller using multi-threading
     /*!
 	  Line searches for the best controller in update direction. If line search is disabled, it just takes the suggested update step.
@@ -113,6 +128,11 @@ private:
     std::mutex workerWakeUpMutex_;
     std::condition_variable workerWakeUpCondition_;
 
+    std::mutex workerInitMutex_;
+    std::condition_variable workerInitCondition_;
+    size_t workersInitialized_;
+    std::atomic<size_t> instancesGeneration_;  //! incremented whenever the main thread replaced the instances
+
     std::mutex kCompletedMutex_;
     std::condition_variable kCompletedCondition_;
 
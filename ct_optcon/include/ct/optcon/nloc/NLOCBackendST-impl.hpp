@@ -39,9 +39,13 @@ template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, type
 void NLOCBackendST<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::computeLQApproximation(size_t firstIndex,
     size_t lastIndex)
 {
+    CT_PROFILE_SCOPE("NLOC::computeLQApproximation");
+
     if (lastIndex == static_cast<size_t>(this->K_) - 1)
         this->initializeCostToGo();
 
+    this->updateConstraintLinearizationHorizon(firstIndex, lastIndex, 1);
+
     for (size_t k = firstIndex; k <= lastIndex; k++)
     {
         this->executeLQApproximation(this->settings_.nThreads, k);
@@ -80,6 +84,16 @@ SCALAR NLOCBackendST<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
 
     while (iterations < this->settings_.lineSearchSettings.maxIterations)
     {
+        // stop early if the next candidate would miss the deadline, the current iterate remains the best one found
+        if (!this->timeBudget_.hasTimeFor(NLOCTimeBudget::LINE_SEARCH_CANDIDATE))
+        {
+            if (this->settings_.lineSearchSettings.debugPrint)
+                std::cout << "[LineSearch]: Time budget exhausted after " << iterations << " iterations." << std::endl;
+            break;
+        }
+
+        const auto startCandidate = NLOCTimeBudget::clock_t::now();
+
         if (this->settings_.lineSearchSettings.debugPrint)
             std::cout << "[LineSearch]: Iteration: " << iterations << ", try alpha: " << alpha << " out of maximum "
                       << this->settings_.lineSearchSettings.maxIterations << " iterations. " << std::endl;
@@ -108,6 +122,8 @@ SCALAR NLOCBackendST<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::
         this->executeLineSearch(this->settings_.nThreads, alpha, x_search, x_shot_search, defects_recorded, u_recorded,
             intermediateCost, finalCost, defectNorm, e_box_norm, e_gen_norm, *substepsX, *substepsU);
 
+        this->timeBudget_.recordSince(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, startCandidate);
+
         // compute new merit and check for step acceptance
         bool stepAccepted =
             this->acceptStep(alpha, intermediateCost, finalCost, defectNorm, e_box_norm, e_gen_norm, this->lowestCost_, cost);
@@ -5,6 +5,12 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <map>
+#include <string>
+
+#include <ct/core/common/Profiler.h>
+#include <ct/core/common/TraceWriter.h>
+
 #ifdef MATLAB
 #include <ct/optcon/matlab.hpp>
 #endif
@@ -65,6 +71,16 @@ struct SummaryAllIterations
     }
 
 
+    //! timing statistics of the solver phases, aggregated over all solvers and threads of the process
+    /*!
+     * Empty unless compiled with CT_PROFILING. Use ct::core::Profiler to reset the statistics or to export the
+     * individual zones.
+     */
+    std::map<std::string, ct::core::PhaseStatistics> phaseStatistics() const
+    {
+        return ct::core::Profiler::instance().computeStatistics();
+    }
+
     void logToMatlab(const std::string& fileName)
     {
 #ifdef MATLAB
@@ -88,6 +104,32 @@ struct SummaryAllIterations
 #endif
     }
 
+    //! write the summary to the binary trace file <fileName>.cttrace, one record per quantity
+    /*!
+     * The records carry the last iteration, the iteration of each entry is stored in the record "iterations".
+     * \throw std::runtime_error if the file cannot be written
+     */
+    void logToTrace(const std::string& fileName) const
+    {
+        ct::core::TraceWriter trace(fileName + ".cttrace");
+        const uint64_t iteration = iterations.empty() ? 0 : iterations.back();
+
+        trace.writeArray("iterations", iteration, std::vector<SCALAR>(iterations.begin(), iterations.end()));
+        trace.writeArray("defect_l1_norms", iteration, defect_l1_norms);
+        trace.writeArray("defect_l2_norms", iteration, defect_l2_norms);
+        trace.writeArray("box_constr_norms", iteration, e_box_norms);
+        trace.writeArray("gen_constr_norms", iteration, e_gen_norms);
+        trace.writeArray("lx_norms", iteration, lx_norms);
+        trace.writeArray("lu_norms", iteration, lu_norms);
+        trace.writeArray("intermediateCosts", iteration, intermediateCosts);
+        trace.writeArray("finalCosts", iteration, finalCosts);
+        trace.writeArray("totalCosts", iteration, totalCosts);
+        trace.writeArray("merits", iteration, merits);
+        trace.writeArray("stepSizes", iteration, stepSizes);
+        trace.writeArray("smallestEigenvalues", iteration, smallestEigenvalues);
+        trace.flush();
+    }
+
 //! if building with MATLAB support, include matfile
 #ifdef MATLAB
     matlab::MatFile matFile_;
@@ -0,0 +1,179 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace ct {
+namespace optcon {
+
+
+/*!
+ * \ingroup NLOptCon
+ *
+ * \brief Wall-clock time budget for anytime NLOC iterations
+ *
+ * Holds an (optional) deadline and running estimates of the cost of the individual solver phases.
+ * The estimates are exponential moving averages of the measured durations, which allows the
+ * solver to decide up-front whether a phase still fits into the remaining time or needs to be skipped
+ * or truncated. As long as no deadline is set, all queries report that there is enough time left.
+ */
+class NLOCTimeBudget
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+    using time_point_t = clock_t::time_point;
+
+    //! the solver phases for which run times are recorded
+    enum PHASE
+    {
+        ITERATION = 0,          //! a full NLOC iteration (prepare + finish)
+        LINE_SEARCH_CANDIDATE,  //! the evaluation of a single step size during line search
+        CONSTRAINT_LINEARIZATION,  //! the linearization of the general constraints at a single stage
+        NUM_PHASES
+    };
+
+    /*!
+     * @param smoothing weight of the latest measurement in the moving average, in (0, 1]
+     * @param safetyFactor factor by which all estimates get inflated before comparing against the remaining time
+     */
+    NLOCTimeBudget(const double smoothing = 0.3, const double safetyFactor = 1.2)
+        : active_(false), smoothing_(smoothing), safetyFactor_(safetyFactor)
+    {
+        estimates_.fill(0.0);
+        samples_.fill(0);
+    }
+
+    //! set an absolute deadline, which activates the time budget
+    void setDeadline(const time_point_t& deadline)
+    {
+        deadline_ = deadline;
+        active_ = true;
+    }
+
+    //! set the deadline relative to now
+    /*!
+     * @param budget available time in seconds
+     */
+    void setBudget(const double budget)
+    {
+        setDeadline(clock_t::now() + std::chrono::duration_cast<clock_t::duration>(std::chrono::duration<double>(budget)));
+    }
+
+    //! deactivate the time budget, the phase estimates are kept
+    void clearDeadline() { active_ = false; }
+
+    //! true if a deadline is currently set
+    bool isActive() const { return active_; }
+
+    //! get the current deadline
+    const time_point_t& getDeadline() const { return deadline_; }
+
+    //! the time left until the deadline in seconds (infinity if no deadline is set, may become negative)
+    double remaining() const
+    {
+        if (!active_)
+            return std::numeric_limits<double>::infinity();
+
+        return std::chrono::duration<double>(deadline_ - clock_t::now()).count();
+    }
+
+    //! true if the deadline is set and has passed
+    bool expired() const { return active_ && remaining() <= 0.0; }
+
+    //! set the factor by which all estimates get inflated
+    void setSafetyFactor(const double safetyFactor) { safetyFactor_ = safetyFactor; }
+
+    //! record a measured duration for a phase
+    /*!
+     * May be called concurrently from several worker threads.
+     * @param phase the solver phase
+     * @param duration measured duration in seconds
+     */
+    void record(const PHASE phase, const double duration)
+    {
+        std::lock_guard<std::mutex> lock(recordMutex_);
+
+        if (samples_[phase] == 0)
+            estimates_[phase] = duration;
+        else
+            estimates_[phase] = smoothing_ * duration + (1.0 - smoothing_) * estimates_[phase];
+
+        samples_[phase]++;
+    }
+
+    //! record the duration of a phase which started at 'start' and ends now
+    void recordSince(const PHASE phase, const time_point_t& start)
+    {
+        record(phase, std::chrono::duration<double>(clock_t::now() - start).count());
+    }
+
+    //! the estimated duration of a phase in seconds (zero if it was never measured)
+    double estimate(const PHASE phase) const { return safetyFactor_ * estimates_[phase]; }
+
+    //! true if the phase has been measured at least once
+    bool hasEstimate(const PHASE phase) const { return samples_[phase] > 0; }
+
+    //! check if n executions of a phase fit into the remaining time
+    /*!
+     * Phases without an estimate are always admitted, such that the first execution can be measured.
+     */
+    bool hasTimeFor(const PHASE phase, const size_t n = 1) const
+    {
+        if (!active_ || !hasEstimate(phase))
+            return true;
+
+        return (n * estimate(phase) <= remaining());
+    }
+
+    //! number of executions of a phase that fit into a share of the remaining time
+    /*!
+     * @param phase the solver phase
+     * @param parallelism number of executions that can run concurrently
+     * @param share share of the remaining time which may be spent on this phase, in (0, 1]
+     * @param upperLimit value returned if there is no deadline or no estimate
+     * @return the affordable number of executions, clamped to upperLimit
+     */
+    size_t affordable(const PHASE phase, const size_t parallelism, const double share, const size_t upperLimit) const
+    {
+        if (!active_ || !hasEstimate(phase) || estimate(phase) <= 0.0)
+            return upperLimit;
+
+        const double available = share * remaining();
+        if (available <= 0.0)
+            return 0;
+
+        const double n = std::floor(available / estimate(phase)) * parallelism;
+        return static_cast<size_t>(std::min(n, static_cast<double>(upperLimit)));
+    }
+
+    //! forget all phase estimates
+    void resetEstimates()
+    {
+        estimates_.fill(0.0);
+        samples_.fill(0);
+    }
+
+private:
+    bool active_;
+    time_point_t deadline_;
+
+    double smoothing_;
+    double safetyFactor_;
+
+    std::array<double, NUM_PHASES> estimates_;
+    std::array<size_t, NUM_PHASES> samples_;
+
+    std::mutex recordMutex_;
+};
+
+}  // namespace optcon
+}  // namespace ct
@@ -114,6 +114,7 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->computeLQApproximation(0, K_shot - 1);
     auto end = std::chrono::steady_clock::now();
     auto diff = end - start;
+    this->backend_->logTimingToTrace("lqApproximation", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting]: computing LQ approximation for first multiple-shooting interval took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -126,6 +127,7 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->extractSolution();
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("lqSolve", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting]: Finish solving LQOC problem took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -134,17 +136,18 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     bool foundBetter = this->backend_->lineSearch();
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("lineSearch", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting]: Line search took " << std::chrono::duration<double, std::milli>(diff).count() << " ms"
                   << std::endl;
 
 
+    auto endFinish = std::chrono::steady_clock::now();
+    this->backend_->logTimingToTrace(
+        "finishIteration", std::chrono::duration<double, std::milli>(endFinish - startFinish).count());
     if (debugPrint)
-    {
-        auto endFinish = std::chrono::steady_clock::now();
         std::cout << "[MultipleShooting]: finishIteration() took "
                   << std::chrono::duration<double, std::milli>(endFinish - startFinish).count() << " ms" << std::endl;
-    }
 
 
     this->backend_->printSummary();
@@ -153,6 +156,8 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->logToMatlab(this->backend_->iteration());
 #endif  //MATLAB_FULL_LOG
 
+    this->backend_->logToTrace(this->backend_->iteration());
+
     this->backend_->iteration()++;
 
     return foundBetter;
@@ -237,6 +242,7 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->computeLQApproximation(0, K_shot - 1);
     auto end = std::chrono::steady_clock::now();
     auto diff = end - start;
+    this->backend_->logTimingToTrace("lqApproximation", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting-MPC]: computing LQ approximation for first multiple-shooting interval took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -249,6 +255,7 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->extractSolution();
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("lqSolve", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting-MPC]: Finish solving LQOC problem took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -260,17 +267,18 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
 
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("update", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[MultipleShooting-MPC]: Solution update took " << std::chrono::duration<double, std::milli>(diff).count()
                   << " ms" << std::endl;
 
 
+    auto endFinish = std::chrono::steady_clock::now();
+    this->backend_->logTimingToTrace(
+        "finishIteration", std::chrono::duration<double, std::milli>(endFinish - startFinish).count());
     if (debugPrint)
-    {
-        auto endFinish = std::chrono::steady_clock::now();
         std::cout << "[MultipleShooting-MPC]: finishIteration() took "
                   << std::chrono::duration<double, std::milli>(endFinish - startFinish).count() << " ms" << std::endl;
-    }
 
     this->backend_->printSummary();
 
@@ -278,6 +286,8 @@ bool MultipleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>:
     this->backend_->logToMatlab(this->backend_->iteration());
 #endif  //MATLAB_FULL_LOG
 
+    this->backend_->logToTrace(this->backend_->iteration());
+
     this->backend_->iteration()++;
 
     return true;  // note: will always return foundBetter
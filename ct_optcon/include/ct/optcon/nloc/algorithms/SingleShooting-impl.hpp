@@ -82,6 +82,7 @@ bool SingleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::f
     this->backend_->computeLQApproximation(0, K - 1);
     auto end = std::chrono::steady_clock::now();
     auto diff = end - start;
+    this->backend_->logTimingToTrace("lqApproximation", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[SingleShooting]: Computing LQ approximation took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -100,6 +101,7 @@ bool SingleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::f
     this->backend_->extractSolution();
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("lqSolve", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[SingleShooting]: Solving LQOC problem took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -112,11 +114,13 @@ bool SingleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::f
     bool foundBetter = this->backend_->lineSearch();
     end = std::chrono::steady_clock::now();
     diff = end - start;
+    this->backend_->logTimingToTrace("lineSearch", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[SingleShooting]: Line search took " << std::chrono::duration<double, std::milli>(diff).count()
                   << " ms" << std::endl;
 
     diff = end - startEntire;
+    this->backend_->logTimingToTrace("finishIteration", std::chrono::duration<double, std::milli>(diff).count());
     if (debugPrint)
         std::cout << "[SingleShooting]: finishIteration took "
                   << std::chrono::duration<double, std::milli>(diff).count() << " ms" << std::endl;
@@ -127,6 +131,8 @@ bool SingleShooting<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::f
     this->backend_->logToMatlab(this->backend_->iteration());
 #endif
 
+    this->backend_->logToTrace(this->backend_->iteration());
+
     this->backend_->iteration()++;
 
     return foundBetter;
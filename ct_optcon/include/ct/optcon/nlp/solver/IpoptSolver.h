@@ -61,6 +61,15 @@ public:
 
     bool solve() override;
 
+    /**
+	 * @brief      Solves the NLP again, reusing the IPOPT application and the problem structure of the last
+	 *             successful solve. Falls back to solve() if there is none. The dimensions and sparsity patterns
+	 *             of the NLP must not change in between.
+	 *
+	 * @return     true if the solve was successful
+	 */
+    bool reoptimize();
+
     void prepareWarmStart(size_t maxIterations) override;
 
     void configureDerived(const NlpSolverSettings& settings) override;
@@ -149,9 +158,18 @@ private:
 	 * @brief      Sets the IPOPT solver options.
 	 */
     void setSolverOptions();
+
+    /**
+	 * @brief      Evaluates the return status of the last solve
+	 *
+	 * @return     true if the solve was successful
+	 */
+    bool evaluateStatus();
+
     std::shared_ptr<Ipopt::IpoptApplication> ipoptApp_; /*!< A pointer to ipopt*/
     Ipopt::ApplicationReturnStatus status_;             /*!< The return status of IPOPT*/
     IpoptSettings settings_;                            /*!< Contains the IPOPT settings*/
+    bool structureAvailable_;                           /*!< True if the last solve can be reoptimized*/
 };
 
 #include "implementation/IpoptSolver-impl.h"
@@ -169,6 +187,7 @@ public:
     }
 
     bool solve() override { return false; }
+    bool reoptimize() { return false; }
     void prepareWarmStart(size_t maxIterations) override {}
     void configureDerived(const NlpSolverSettings& settings) override {}
 };
@@ -34,6 +34,7 @@ void IpoptSolver<SCALAR>::configureDerived(const NlpSolverSettings& settings)
     std::cout << "calling Ipopt configure derived" << std::endl;
     settings_ = settings.ipoptSettings_;
     setSolverOptions();
+    structureAvailable_ = false;
     this->isInitialized_ = true;
 }
 
@@ -71,7 +72,27 @@ bool IpoptSolver<SCALAR>::solve()
     // Ask Ipopt to solve the problem
     status_ = ipoptApp_->OptimizeTNLP(this);
 
-    if (status_ == Ipopt::Solve_Succeeded || status_ == Ipopt::Solved_To_Acceptable_Level)
+    return evaluateStatus();
+}
+
+template <typename SCALAR>
+bool IpoptSolver<SCALAR>::reoptimize()
+{
+    if (!structureAvailable_)
+        return solve();
+
+    // skips the initialization of the application and reuses the problem structure
+    status_ = ipoptApp_->ReOptimizeTNLP(this);
+
+    return evaluateStatus();
+}
+
+template <typename SCALAR>
+bool IpoptSolver<SCALAR>::evaluateStatus()
+{
+    structureAvailable_ = (status_ == Ipopt::Solve_Succeeded || status_ == Ipopt::Solved_To_Acceptable_Level);
+
+    if (structureAvailable_)
     {
         // Retrieve some statistics about the solve
         if (settings_.printLevel_ > 1)
@@ -34,18 +34,23 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "solver/OptConSolver.h"
 #include "solver/lqp/HPIPMInterface.hpp"
 #include "solver/lqp/GNRiccatiSolver.hpp"
+#include "solver/lqp/MixedPrecisionRiccatiSolver.hpp"
 #include "solver/NLOptConSolver.hpp"
+#include "solver/BatchNLOptConSolver.hpp"
 #include "solver/NLOptConSettings.hpp"
 
 #include "lqr/riccati/CARE.hpp"
 #include "lqr/riccati/DARE.hpp"
 #include "lqr/FHDTLQR.hpp"
 #include "lqr/LQR.hpp"
+#include "lqr/GainScheduledLQR.hpp"
 
 #include "dms/dms.h"
 
 #include "mpc/MpcSettings.h"
 #include "mpc/MPC.h"
+#include "mpc/TripleBuffer.h"
+#include "mpc/MpcRunner.h"
 #include "mpc/timehorizon/MpcTimeHorizon.h"
 #include "mpc/policyhandler/PolicyHandler.h"
 #include "mpc/policyhandler/default/StateFeedbackPolicyHandler.h"
@@ -22,6 +22,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "system_interface/OptconContinuousSystemInterface.h"
 #include "system_interface/OptconDiscreteSystemInterface.h"
 
+#include "nloc/NLOCTimeBudget.hpp"
 #include "nloc/NLOCBackendBase.hpp"
 #include "nloc/NLOCBackendST.hpp"
 #include "nloc/NLOCBackendMP.hpp"
@@ -31,17 +32,22 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "solver/OptConSolver.h"
 #include "solver/lqp/HPIPMInterface.hpp"
 #include "solver/lqp/GNRiccatiSolver.hpp"
+#include "solver/lqp/MixedPrecisionRiccatiSolver.hpp"
 #include "solver/NLOptConSolver.hpp"
+#include "solver/BatchNLOptConSolver.hpp"
 
 #include "lqr/riccati/CARE.hpp"
 #include "lqr/riccati/DARE.hpp"
 #include "lqr/FHDTLQR.hpp"
 #include "lqr/LQR.hpp"
+#include "lqr/GainScheduledLQR.hpp"
 
 #include "dms/dms.h"
 
 #include "mpc/MpcSettings.h"
 #include "mpc/MPC.h"
+#include "mpc/TripleBuffer.h"
+#include "mpc/MpcRunner.h"
 #include "mpc/timehorizon/MpcTimeHorizon.h"
 #include "mpc/policyhandler/PolicyHandler.h"
 #include "mpc/policyhandler/default/StateFeedbackPolicyHandler.h"
@@ -60,13 +66,16 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "problem/LQOCProblem-impl.hpp"
 
 #include "solver/lqp/GNRiccatiSolver-impl.hpp"
+#include "solver/lqp/MixedPrecisionRiccatiSolver-impl.hpp"
 #include "solver/lqp/HPIPMInterface-impl.hpp"
 #include "solver/NLOptConSolver-impl.hpp"
+#include "solver/BatchNLOptConSolver-impl.hpp"
 
 #include "lqr/riccati/CARE-impl.hpp"
 #include "lqr/riccati/DARE-impl.hpp"
 #include "lqr/FHDTLQR-impl.hpp"
 #include "lqr/LQR-impl.hpp"
+#include "lqr/GainScheduledLQR-impl.hpp"
 
 #include "nloc/NLOCBackendBase-impl.hpp"
 #include "nloc/NLOCBackendST-impl.hpp"
@@ -75,6 +84,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include "nloc/algorithms/SingleShooting-impl.hpp"
 
 #include "mpc/MPC-impl.h"
+#include "mpc/MpcRunner-impl.h"
 #include "mpc/timehorizon/MpcTimeHorizon-impl.h"
 #include "mpc/policyhandler/PolicyHandler-impl.h"
 #include "mpc/policyhandler/default/StateFeedbackPolicyHandler-impl.h"
@@ -0,0 +1,151 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * \brief An array of matrices with a per-stage variable number of rows and a fixed number of columns
+ *
+ * All matrices live in one contiguous buffer, in which every stage owns a slot of capacity() x COLS entries. The
+ * matrix of a stage is stored column-major with a leading dimension equal to its number of rows, i.e. densely packed
+ * at the beginning of its slot, such that its data() can be handed to solvers such as HPIPM without a copy.
+ *
+ * Changing the number of rows of a stage within the capacity only rebinds the Eigen::Map of that stage, it does not
+ * allocate and does not touch other stages. Hence different stages may be changed concurrently. Exceeding the
+ * capacity reallocates the buffer and invalidates the data pointers of all stages.
+ *
+ * \tparam SCALAR the scalar type
+ * \tparam COLS the number of columns of every matrix
+ */
+template <typename SCALAR, int COLS>
+class FixedCapacityMatrixArray
+{
+public:
+    typedef Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic> matrix_t;
+    typedef Eigen::Map<matrix_t> map_t;
+
+    //! constructor
+    /*!
+     * @param nStages the number of stages
+     * @param capacity the maximum number of rows per stage which can be set without allocation
+     */
+    FixedCapacityMatrixArray(size_t nStages = 0, int capacity = 0) : capacity_(0)
+    {
+        resize(nStages);
+        reserve(capacity);
+    }
+
+    //! copy constructor, the copy maps its own buffer
+    FixedCapacityMatrixArray(const FixedCapacityMatrixArray& other)
+        : buffer_(other.buffer_), rows_(other.rows_), capacity_(other.capacity_)
+    {
+        remap();
+    }
+
+    //! assignment operator, the result maps its own buffer
+    FixedCapacityMatrixArray& operator=(const FixedCapacityMatrixArray& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        buffer_ = rhs.buffer_;
+        rows_ = rhs.rows_;
+        capacity_ = rhs.capacity_;
+        remap();
+        return *this;
+    }
+
+    //! the number of stages
+    size_t size() const { return rows_.size(); }
+    //! the maximum number of rows per stage which can be set without allocation
+    int capacity() const { return capacity_; }
+    //! the number of rows of stage k
+    int rows(size_t k) const { return rows_[k]; }
+
+    //! change the number of stages, the matrices of the remaining stages are kept and new stages have zero rows
+    void resize(size_t nStages)
+    {
+        if (nStages == size())
+            return;
+
+        // the slots are stored stage after stage, hence the remaining stages keep their position
+        buffer_.resize(nStages * capacity_ * COLS);
+        rows_.resize(nStages, 0);
+        remap();
+    }
+
+    //! grow the capacity of every stage to at least capacity rows, keeping all matrices
+    void reserve(int capacity)
+    {
+        if (capacity <= capacity_)
+            return;
+
+        std::vector<SCALAR> buffer(size() * capacity * COLS);
+        for (size_t k = 0; k < size(); k++)
+            std::copy_n(stageData(k), rows_[k] * COLS, buffer.data() + k * capacity * COLS);
+
+        buffer_.swap(buffer);
+        capacity_ = capacity;
+        remap();
+    }
+
+    //! set the number of rows of stage k, growing the capacity if required
+    /*!
+     * Within the capacity, this neither allocates nor invalidates data pointers of other stages. The entries of the
+     * matrix are unspecified after its number of rows changed.
+     */
+    void setRows(size_t k, int rows)
+    {
+        if (rows == rows_[k])
+            return;
+
+        reserve(rows);
+        rows_[k] = rows;
+        new (&maps_[k]) map_t(stageData(k), rows, COLS);
+    }
+
+    //! set the number of rows of all stages
+    void setRows(int rows)
+    {
+        reserve(rows);
+        for (size_t k = 0; k < size(); k++)
+            setRows(k, rows);
+    }
+
+    //! the matrix of stage k, mapping its slot in the buffer
+    map_t& operator[](size_t k) { return maps_[k]; }
+    const map_t& operator[](size_t k) const { return maps_[k]; }
+
+    //! the contiguous buffer of all stages, the slot of stage k starts at k * capacity() * COLS
+    SCALAR* data() { return buffer_.data(); }
+    const SCALAR* data() const { return buffer_.data(); }
+
+private:
+    SCALAR* stageData(size_t k) { return buffer_.data() + k * capacity_ * COLS; }
+
+    //! rebuild the maps of all stages after the buffer moved
+    void remap()
+    {
+        maps_.clear();
+        maps_.reserve(size());
+        for (size_t k = 0; k < size(); k++)
+            maps_.emplace_back(stageData(k), rows_[k], COLS);
+    }
+
+    std::vector<SCALAR> buffer_;
+    std::vector<map_t> maps_;
+    std::vector<int> rows_;
+    int capacity_;
+};
+
+}  // namespace optcon
+}  // namespace ct
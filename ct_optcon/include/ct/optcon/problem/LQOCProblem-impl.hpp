@@ -110,21 +110,46 @@ void LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::setZero(const int& nGenConstr)
     assert(d_lb_.size() == d_ub_.size());
     assert(d_lb_.size() == C_.size());
     assert(d_lb_.size() == D_.size());
-    std::fill(ng_.begin(), ng_.end(), nGenConstr);
+    reserveGeneralConstraints(nGenConstr);
     for (size_t i = 0; i < ng_.size(); i++)
     {
-        d_lb_[i].resize(nGenConstr, 1);
+        setGeneralConstraintCount(i, nGenConstr);
         d_lb_[i].setZero();
-        d_ub_[i].resize(nGenConstr, 1);
         d_ub_[i].setZero();
-        C_[i].resize(nGenConstr, STATE_DIM);
         C_[i].setZero();
-        D_[i].resize(nGenConstr, CONTROL_DIM);
         D_[i].setZero();
     }
 }
 
 
+template <int STATE_DIM, int CONTROL_DIM, typename SCALAR>
+void LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::reserveGeneralConstraints(const int capacity)
+{
+    d_lb_.reserve(capacity);
+    d_ub_.reserve(capacity);
+    C_.reserve(capacity);
+    D_.reserve(capacity);
+}
+
+
+template <int STATE_DIM, int CONTROL_DIM, typename SCALAR>
+int LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::getGeneralConstraintCapacity() const
+{
+    return C_.capacity();
+}
+
+
+template <int STATE_DIM, int CONTROL_DIM, typename SCALAR>
+void LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::setGeneralConstraintCount(const int index, const int nConstr)
+{
+    ng_[index] = nConstr;
+    d_lb_.setRows(index, nConstr);
+    d_ub_.setRows(index, nConstr);
+    C_.setRows(index, nConstr);
+    D_.setRows(index, nConstr);
+}
+
+
 template <int STATE_DIM, int CONTROL_DIM, typename SCALAR>
 void LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::setInputBoxConstraint(const int index,
     const int nConstr,
@@ -259,11 +284,15 @@ void LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR>::setGeneralConstraints(const co
         throw(std::runtime_error("LQOCProblem setGeneralConstraints: error in constraint config"));
     }
 
-    std::fill(ng_.begin(), ng_.end(), d_lb.rows());
-    d_lb_.setConstant(d_lb);
-    d_ub_.setConstant(d_ub);
-    C_.setConstant(C);
-    D_.setConstant(D);
+    reserveGeneralConstraints(d_lb.rows());
+    for (size_t i = 0; i < ng_.size(); i++)
+    {
+        setGeneralConstraintCount(i, d_lb.rows());
+        d_lb_[i] = d_lb;
+        d_ub_[i] = d_ub;
+        C_[i] = C;
+        D_[i] = D;
+    }
 }
 
 
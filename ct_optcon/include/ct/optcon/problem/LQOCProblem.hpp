@@ -5,6 +5,8 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include "FixedCapacityMatrixArray.hpp"
+
 namespace ct {
 namespace optcon {
 
@@ -45,6 +47,11 @@ namespace optcon {
  * \note The box constraint containers within this class are made fixed-size. Solvers can get the
  * actual number of box constraints from a a dedicated container nbu_ and nbx_
  *
+ * \note The general constraint containers are preallocated for a maximum number of constraints per stage, see
+ * reserveGeneralConstraints(). The actual number of general constraints is stored in ng_ and must be changed through
+ * setGeneralConstraintCount(), which does not allocate within the capacity. Hence the number of general constraints
+ * may vary between MPC iterations without reallocation, and the constraint data can be handed to solvers in place.
+ *
  * \note In the differential notation we define
  * \f$ \delta \mathbf x_n = \mathbf x_n - \hat \mathbf x_n \f$ and \f$ \delta \mathbf u_n = \mathbf u_n - \hat \mathbf u_n \f$
  * where  \hat \mathbf x_n and  \hat \mathbf u_n are current nominal/reference trajectories, around which the LQP is formed.
@@ -63,9 +70,10 @@ public:
     using constr_state_jac_t = Eigen::Matrix<SCALAR, -1, -1>;
     using constr_control_jac_t = Eigen::Matrix<SCALAR, -1, -1>;
 
-    using constr_vec_array_t = ct::core::DiscreteArray<constr_vec_t>;
-    using constr_state_jac_array_t = ct::core::DiscreteArray<constr_state_jac_t>;
-    using constr_control_jac_array_t = ct::core::DiscreteArray<constr_control_jac_t>;
+    //! per-stage general constraint containers with preallocated capacity, see FixedCapacityMatrixArray
+    using constr_vec_array_t = FixedCapacityMatrixArray<SCALAR, 1>;
+    using constr_state_jac_array_t = FixedCapacityMatrixArray<SCALAR, STATE_DIM>;
+    using constr_control_jac_array_t = FixedCapacityMatrixArray<SCALAR, CONTROL_DIM>;
 
     using input_box_constr_vec_t = Eigen::Matrix<SCALAR, CONTROL_DIM, 1>;
     using state_box_constr_vec_t = Eigen::Matrix<SCALAR, STATE_DIM, 1>;
@@ -96,6 +104,26 @@ public:
      */
     void setZero(const int& nGenConstr = 0);
 
+    /*!
+     * \brief preallocate the general constraint containers for at most capacity constraints per stage
+     * Existing constraints are kept, a smaller capacity than the current one has no effect.
+     */
+    void reserveGeneralConstraints(const int capacity);
+
+    //! the maximum number of general constraints per stage which can be set without allocation
+    int getGeneralConstraintCapacity() const;
+
+    /*!
+     * \brief set the number of general constraints at a stage and resize its constraint containers accordingly
+     * Within the capacity, this does not allocate and only affects the given stage, hence it may be called for
+     * different stages concurrently. Exceeding the capacity grows the containers of all stages, which is not
+     * thread-safe.
+     * The content of the constraint containers of the stage is unspecified after the number of constraints changed.
+     * @param index the stage
+     * @param nConstr the number of general constraints
+     */
+    void setGeneralConstraintCount(const int index, const int nConstr);
+
     /*!
      * \brief set input box constraints at a specific index
      * @param index the index
@@ -248,7 +276,7 @@ public:
     //! linear general constraint matrices
     constr_state_jac_array_t C_;
     constr_control_jac_array_t D_;
-    //! number of general inequality constraints
+    //! number of general inequality constraints, to be changed through setGeneralConstraintCount()
     std::vector<int> ng_;
 
 
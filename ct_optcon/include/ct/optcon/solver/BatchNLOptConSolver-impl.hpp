@@ -0,0 +1,140 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <limits>
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::BatchNLOptConSolver(
+    const OptConProblem_t& optConProblem,
+    const NLOptConSettings& settings,
+    const size_t nThreads)
+    : settings_(settings), pool_(nThreads)
+{
+    // the problems are solved concurrently, hence every solver runs single-threaded
+    settings_.nThreads = 1;
+    settings_.nThreadsEigen = 1;
+
+    for (size_t i = 0; i < pool_.getNumThreads(); i++)
+        solvers_.emplace_back(new NLOptConSolver_t(optConProblem, settings_));
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::solve(
+    const PolicyArray_t& initialGuesses,
+    const ProblemSetup_t& setup)
+{
+    solveBatch(initialGuesses.size(), [&](size_t problemId, NLOptConSolver_t& solver) {
+        if (setup)
+            setup(problemId, solver);
+        solver.setInitialGuess(initialGuesses[problemId]);
+    });
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::solve(
+    const core::StateVectorArray<STATE_DIM, SCALAR>& initialStates,
+    const Policy_t& initialGuess,
+    const ProblemSetup_t& setup)
+{
+    solveBatch(initialStates.size(), [&](size_t problemId, NLOptConSolver_t& solver) {
+        if (setup)
+            setup(problemId, solver);
+        solver.setInitialGuess(initialGuess);
+        solver.changeInitialState(initialStates[problemId]);
+    });
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::solveBatch(
+    const size_t nProblems,
+    const ProblemSetup_t& initializeProblem)
+{
+    solutions_.resize(nProblems);
+    costs_.resize(nProblems);
+    status_.resize(nProblems);
+    errors_.resize(nProblems);
+
+    pool_.parallelFor(nProblems, [&](size_t threadId, size_t problemId) {
+        // a failing problem must not abort the batch, nor leave the results of the previous batch behind
+        try
+        {
+            // thread 0 is the calling thread, which keeps its affinity
+            core::pinPoolWorker(settings_.workerCores, threadId);
+
+            NLOptConSolver_t& solver = *solvers_[threadId];
+            initializeProblem(problemId, solver);
+            const bool converged = solver.solve();
+
+            solutions_[problemId] = solver.getSolution();
+            costs_[problemId] = solver.getCost();
+            status_[problemId] = converged ? CONVERGED : NOT_CONVERGED;
+            errors_[problemId].clear();
+        } catch (const std::exception& e)
+        {
+            solutions_[problemId] = Policy_t();
+            costs_[problemId] = std::numeric_limits<SCALAR>::quiet_NaN();
+            status_[problemId] = FAILED;
+            errors_[problemId] = e.what();
+        }
+    });
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+auto BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getSolutions() const
+    -> const PolicyArray_t&
+{
+    return solutions_;
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+const std::vector<SCALAR>& BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getCosts()
+    const
+{
+    return costs_;
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+auto BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getStatus() const
+    -> const std::vector<PROBLEM_STATUS>&
+{
+    return status_;
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+auto BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getErrors() const
+    -> const std::vector<std::string>&
+{
+    return errors_;
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+size_t BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getNumThreads() const
+{
+    return pool_.getNumThreads();
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+auto BatchNLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getSolver(const size_t threadId)
+    -> NLOptConSolver_t&
+{
+    return *solvers_.at(threadId);
+}
+
+}  // namespace optcon
+}  // namespace ct
@@ -0,0 +1,133 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NLOptConSolver.hpp"
+
+namespace ct {
+namespace optcon {
+
+
+/** \ingroup OptConSolver
+ *
+ * \brief Solves a batch of optimal control problems which share their dynamics and cost structure concurrently
+ *
+ * Typical use cases are dataset generation and sampling-based planning, where many problems differ only in their
+ * initial state, references or other parameters. The problems are distributed dynamically over a pool of threads.
+ * Every thread owns one single-threaded NLOptConSolver, which is reused for all problems the thread solves. Hence the
+ * number of system, cost and constraint clones scales with the number of threads instead of the number of problems,
+ * and clones of code-generated systems share their compiled libraries.
+ *
+ * The problems are solved independently of each other, the batch is parallelized across problems only. Rollouts and
+ * Riccati sweeps of different problems do not run in lockstep and are not vectorized across problems.
+ *
+ * A problem which throws, e.g. in its setup function or due to a numerical error, does not abort the batch. It is
+ * marked as FAILED in getStatus() and its error message is available from getErrors().
+ *
+ * \todo lockstep solution of problems with equal K: a structure-of-arrays layout of the trajectories and LQ problems
+ * of all problems, such that the rollout and the GNRiccatiSolver backward sweep vectorize across problems
+ *
+ * Each problem is defined by its initial guess, which also carries its initial state, and an optional setup
+ * function. The setup function receives the index of the problem and the solver it will be solved with, and applies
+ * all problem-specific parameters, e.g. through getCostFunctionInstances(). Since the solvers are reused, the setup
+ * function must set every parameter which differs between problems, not only those which differ from the base problem.
+ */
+template <size_t STATE_DIM,
+    size_t CONTROL_DIM,
+    size_t P_DIM = STATE_DIM / 2,
+    size_t V_DIM = STATE_DIM / 2,
+    typename SCALAR = double,
+    bool CONTINUOUS = true>
+class BatchNLOptConSolver
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS> NLOptConSolver_t;
+    typedef typename NLOptConSolver_t::OptConProblem_t OptConProblem_t;
+    typedef typename NLOptConSolver_t::Policy_t Policy_t;
+    typedef std::vector<Policy_t, Eigen::aligned_allocator<Policy_t>> PolicyArray_t;
+
+    //! the outcome of a problem of the last batch
+    enum PROBLEM_STATUS
+    {
+        CONVERGED = 0,  //!< the solver converged
+        NOT_CONVERGED,  //!< the solver stopped without converging, e.g. at the maximum number of iterations
+        FAILED          //!< solving the problem threw an exception, there is no solution
+    };
+
+    //! applies the parameters of problem problemId to the solver, called before the initial guess is set
+    typedef std::function<void(size_t problemId, NLOptConSolver_t& solver)> ProblemSetup_t;
+
+    //! constructor
+    /*!
+     * @param optConProblem the base problem, which is cloned once per thread
+     * @param settings the settings of every solver. nThreads is ignored, since the solvers are single-threaded.
+     *  If workerCores is set, thread i > 0 of the pool is pinned to workerCores[i % size]. Thread 0 is the calling
+     *  thread, which is not pinned.
+     * @param nThreads the number of threads, including the calling thread
+     */
+    BatchNLOptConSolver(const OptConProblem_t& optConProblem, const NLOptConSettings& settings, const size_t nThreads);
+
+    BatchNLOptConSolver(const BatchNLOptConSolver&) = delete;
+    BatchNLOptConSolver& operator=(const BatchNLOptConSolver&) = delete;
+
+    //! solve one problem per initial guess, blocks until all problems are solved
+    /*!
+     * Exceptions thrown while solving a problem are caught and recorded per problem, see getStatus().
+     * @param initialGuesses the initial guesses, the first state of each guess is the initial state of its problem
+     * @param setup optional problem-specific setup
+     */
+    void solve(const PolicyArray_t& initialGuesses, const ProblemSetup_t& setup = ProblemSetup_t());
+
+    //! solve one problem per initial state, all starting from the same initial guess
+    void solve(const core::StateVectorArray<STATE_DIM, SCALAR>& initialStates,
+        const Policy_t& initialGuess,
+        const ProblemSetup_t& setup = ProblemSetup_t());
+
+    //! the solutions of the last batch, in the order of the problems. Empty for problems which FAILED.
+    const PolicyArray_t& getSolutions() const;
+
+    //! the costs of the solutions of the last batch, NaN for problems which FAILED
+    const std::vector<SCALAR>& getCosts() const;
+
+    //! the outcome of every problem of the last batch
+    const std::vector<PROBLEM_STATUS>& getStatus() const;
+
+    //! the error messages of the problems of the last batch which FAILED, empty for all other problems
+    const std::vector<std::string>& getErrors() const;
+
+    //! the number of threads solving problems concurrently
+    size_t getNumThreads() const;
+
+    //! the solver used by thread threadId, e.g. to change parameters shared by all problems
+    NLOptConSolver_t& getSolver(const size_t threadId);
+
+private:
+    //! solves nProblems problems, initializeProblem(i, solver) sets up problem i including its initial guess
+    void solveBatch(const size_t nProblems, const ProblemSetup_t& initializeProblem);
+
+    NLOptConSettings settings_;
+
+    core::ThreadPool pool_;
+
+    //! one solver per thread of the pool
+    std::vector<std::unique_ptr<NLOptConSolver_t>> solvers_;
+
+    PolicyArray_t solutions_;
+    std::vector<SCALAR> costs_;
+    std::vector<PROBLEM_STATUS> status_;
+    std::vector<std::string> errors_;
+};
+
+
+}  // namespace optcon
+}  // namespace ct
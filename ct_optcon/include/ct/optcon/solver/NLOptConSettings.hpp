@@ -228,8 +228,10 @@ public:
         : integrator(ct::core::IntegrationType::RK4),
           discretization(APPROXIMATION::BACKWARD_EULER),
           timeVaryingDiscretization(false),
+          timeInvariantDynamics(false),
           nlocp_algorithm(GNMS),
           lqocp_solver(GNRICCATI_SOLVER),
+          doublePrecisionRiccati(false),
           loggingPrefix("alg"),
           epsilon(1e-5),
           dt(0.001),
@@ -244,19 +246,28 @@ public:
           recordSmallestEigenvalue(false),
           nThreads(4),
           nThreadsEigen(4),
+          workerCores(),
+          workerLocalInstances(false),
           lineSearchSettings(),
           debugPrint(false),
           printSummary(true),
           useSensitivityIntegrator(false),
-          logToMatlab(false)
+          logToMatlab(false),
+          logToTrace(false),
+          logLQToTrace(false),
+          traceDecimation(20),
+          timeBudgetSafetyFactor(1.2),
+          timeBudgetConstraintShare(0.5)
     {
     }
 
     ct::core::IntegrationType integrator;  //! which integrator to use during the NLOptCon forward rollout
     APPROXIMATION discretization;
     bool timeVaryingDiscretization;
+    bool timeInvariantDynamics;  //! the linearized dynamics are constant (LTI), discretize them only once
     NLOCP_ALGORITHM nlocp_algorithm;  //! which nonlinear optimal control algorithm is to be used
     LQOCP_SOLVER lqocp_solver;        //! the solver for the linear-quadratic optimal control problem
+    bool doublePrecisionRiccati;      //! for float solvers, run the GNRiccatiSolver recursion in double precision
     std::string loggingPrefix;        //! the prefix to be stored before the matfile name for logging
     double epsilon;                   //! Eigenvalue correction factor for Hessian regularization
     double dt;                        //! sampling time for the control input (seconds)
@@ -272,12 +283,19 @@ public:
     int nThreads;                   //! number of threads, for MP version
     size_t
         nThreadsEigen;  //! number of threads for eigen parallelization (applies both to MP and ST) Note. in order to activate Eigen parallelization, compile with '-fopenmp'
+    std::vector<int> workerCores;  //! MP version: worker i is pinned to core workerCores[i % size], empty: no pinning
+    bool workerLocalInstances;     //! MP version: workers clone their own systems, costs and constraints (NUMA)
     LineSearchSettings lineSearchSettings;  //! the line search settings
     LQOCSolverSettings lqoc_solver_settings;
     bool debugPrint;
     bool printSummary;
     bool useSensitivityIntegrator;
-    bool logToMatlab;  //! log to matlab (true/false)
+    bool logToMatlab;     //! log to matlab (true/false)
+    bool logToTrace;      //! log every iteration to the binary trace file <loggingPrefix>.cttrace (true/false)
+    bool logLQToTrace;    //! with logToTrace, also log the LQ problem and the Riccati matrices of every iteration
+    int traceDecimation;  //! log trajectories and LQ data to the trace only every n-th iteration, costs every iteration
+    double timeBudgetSafetyFactor;  //! inflation of the measured phase durations when planning against a deadline
+    double timeBudgetConstraintShare;  //! share of the remaining time which may be spent re-linearizing general constraints under a deadline
 
 
     //! compute the number of discrete time steps for an arbitrary input time interval
@@ -313,8 +331,10 @@ public:
         std::cout << "integrator: " << integratorToString.at(integrator) << std::endl;
         std::cout << "discretization: " << discretizationToString.at(discretization) << std::endl;
         std::cout << "time varying discretization: " << timeVaryingDiscretization << std::endl;
+        std::cout << "time invariant dynamics: " << timeInvariantDynamics << std::endl;
         std::cout << "nonlinear OCP algorithm: " << nlocAlgorithmToString.at(nlocp_algorithm) << std::endl;
         std::cout << "linear-quadratic OCP solver: " << lqocSolverToString.at(lqocp_solver) << std::endl;
+        std::cout << "double precision Riccati: " << doublePrecisionRiccati << std::endl;
         std::cout << "dt:\t" << dt << std::endl;
         std::cout << "K_sim:\t" << K_sim << std::endl;
         std::cout << "K_shot:\t" << K_shot << std::endl;
@@ -328,11 +348,21 @@ public:
         std::cout << "epsilon:\t" << epsilon << std::endl;
         std::cout << "nThreads:\t" << nThreads << std::endl;
         std::cout << "nThreadsEigen:\t" << nThreadsEigen << std::endl;
+        std::cout << "workerCores:\t";
+        for (int core : workerCores)
+            std::cout << core << " ";
+        std::cout << std::endl;
+        std::cout << "workerLocalInstances:\t" << workerLocalInstances << std::endl;
         std::cout << "loggingPrefix:\t" << loggingPrefix << std::endl;
         std::cout << "debugPrint:\t" << debugPrint << std::endl;
         std::cout << "printSummary:\t" << printSummary << std::endl;
         std::cout << "useSensitivityIntegrator:\t" << useSensitivityIntegrator << std::endl;
         std::cout << "logToMatlab:\t" << logToMatlab << std::endl;
+        std::cout << "logToTrace:\t" << logToTrace << std::endl;
+        std::cout << "logLQToTrace:\t" << logLQToTrace << std::endl;
+        std::cout << "traceDecimation:\t" << traceDecimation << std::endl;
+        std::cout << "timeBudgetSafetyFactor:\t" << timeBudgetSafetyFactor << std::endl;
+        std::cout << "timeBudgetConstraintShare:\t" << timeBudgetConstraintShare << std::endl;
         std::cout << std::endl;
 
         lineSearchSettings.print();
@@ -377,6 +407,22 @@ public:
             return false;
         }
 
+        if (timeBudgetSafetyFactor <= 0.0 || timeBudgetConstraintShare <= 0.0 || timeBudgetConstraintShare > 1.0)
+        {
+            std::cout << "Invalid time budget parameters in NLOptConSettings, the safety factor needs to be > 0 and "
+                         "the constraint share needs to be in (0, 1]."
+                      << std::endl;
+            return false;
+        }
+
+        if (traceDecimation <= 0)
+        {
+            std::cout << "Invalid parameter traceDecimation in NLOptConSettings, needs to be >= 1. traceDecimation "
+                         "currently is "
+                      << traceDecimation << std::endl;
+            return false;
+        }
+
         if (nThreads > 100 || nThreadsEigen > 100)
         {
             std::cout << "Number of threads should not exceed 100." << std::endl;
@@ -414,6 +460,18 @@ public:
         {
         }
         try
+        {
+            timeInvariantDynamics = pt.get<bool>(ns + ".timeInvariantDynamics");
+        } catch (...)
+        {
+        }
+        try
+        {
+            doublePrecisionRiccati = pt.get<bool>(ns + ".doublePrecisionRiccati");
+        } catch (...)
+        {
+        }
+        try
         {
             min_cost_improvement = pt.get<double>(ns + ".min_cost_improvement");
         } catch (...)
@@ -480,6 +538,24 @@ public:
         {
         }
         try
+        {
+            logToTrace = pt.get<bool>(ns + ".logToTrace");
+        } catch (...)
+        {
+        }
+        try
+        {
+            logLQToTrace = pt.get<bool>(ns + ".logLQToTrace");
+        } catch (...)
+        {
+        }
+        try
+        {
+            traceDecimation = pt.get<int>(ns + ".traceDecimation");
+        } catch (...)
+        {
+        }
+        try
         {
             dt = pt.get<double>(ns + ".dt");
         } catch (...)
@@ -504,6 +580,18 @@ public:
         {
         }
         try
+        {
+            workerCores = ct::core::parseCoreList(pt.get<std::string>(ns + ".workerCores"));
+        } catch (const boost::property_tree::ptree_error&)
+        {
+        }
+        try
+        {
+            workerLocalInstances = pt.get<bool>(ns + ".workerLocalInstances");
+        } catch (...)
+        {
+        }
+        try
         {
             recordSmallestEigenvalue = pt.get<bool>(ns + ".recordSmallestEigenvalue");
         } catch (...)
@@ -515,6 +603,18 @@ public:
         } catch (...)
         {
         }
+        try
+        {
+            timeBudgetSafetyFactor = pt.get<double>(ns + ".timeBudgetSafetyFactor");
+        } catch (...)
+        {
+        }
+        try
+        {
+            timeBudgetConstraintShare = pt.get<double>(ns + ".timeBudgetConstraintShare");
+        } catch (...)
+        {
+        }
 
         try
         {
@@ -12,6 +12,7 @@ template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, type
 NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::NLOptConSolver(
     const OptConProblem_t& optConProblem,
     const Settings_t& settings)
+    : prepareDuration_(0.0)
 {
     initialize(optConProblem, settings);
 }
@@ -73,38 +74,51 @@ void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::c
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::prepareIteration()
 {
+    const auto start = NLOCTimeBudget::clock_t::now();
     nlocAlgorithm_->prepareIteration();
+    prepareDuration_ = std::chrono::duration<double>(NLOCTimeBudget::clock_t::now() - start).count();
 }
 
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 bool NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::finishIteration()
 {
-    return nlocAlgorithm_->finishIteration();
+    // the ITERATION estimate covers prepare and finish, but not the time in between
+    const auto start = NLOCTimeBudget::clock_t::now();
+    bool success = nlocAlgorithm_->finishIteration();
+    const double finishDuration = std::chrono::duration<double>(NLOCTimeBudget::clock_t::now() - start).count();
+    nlocBackend_->getTimeBudget().record(NLOCTimeBudget::ITERATION, prepareDuration_ + finishDuration);
+    return success;
 }
 
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::prepareMPCIteration()
 {
+    const auto start = NLOCTimeBudget::clock_t::now();
     nlocAlgorithm_->prepareMPCIteration();
+    prepareDuration_ = std::chrono::duration<double>(NLOCTimeBudget::clock_t::now() - start).count();
 }
 
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 bool NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::finishMPCIteration()
 {
-    return nlocAlgorithm_->finishMPCIteration();
+    // the ITERATION estimate covers prepare and finish, but not the time in between
+    const auto start = NLOCTimeBudget::clock_t::now();
+    bool success = nlocAlgorithm_->finishMPCIteration();
+    const double finishDuration = std::chrono::duration<double>(NLOCTimeBudget::clock_t::now() - start).count();
+    nlocBackend_->getTimeBudget().record(NLOCTimeBudget::ITERATION, prepareDuration_ + finishDuration);
+    return success;
 }
 
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 bool NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::runIteration()
 {
-#ifdef DEBUG_PRINT
     auto startSolve = std::chrono::steady_clock::now();
-#endif
     bool success = nlocAlgorithm_->runIteration();
+    nlocBackend_->getTimeBudget().recordSince(NLOCTimeBudget::ITERATION, startSolve);
 #ifdef DEBUG_PRINT
     auto endSolve = std::chrono::steady_clock::now();
     std::cout << "[NLOC]: runIteration() took "
@@ -128,8 +142,14 @@ bool NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::s
     bool foundBetter = true;
     int numIterations = 0;
 
+    const NLOCTimeBudget& timeBudget = nlocBackend_->getTimeBudget();
+
     while (foundBetter && (numIterations < nlocBackend_->getSettings().max_iterations))
     {
+        // anytime mode: do not start an iteration which is expected to miss the deadline
+        if (timeBudget.expired() || !timeBudget.hasTimeFor(NLOCTimeBudget::ITERATION))
+            break;
+
         foundBetter = runIteration();
 
         numIterations++;
@@ -139,6 +159,21 @@ bool NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::s
 }
 
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::setDeadline(
+    const NLOCTimeBudget::time_point_t& deadline)
+{
+    nlocBackend_->setDeadline(deadline);
+}
+
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::clearDeadline()
+{
+    nlocBackend_->clearDeadline();
+}
+
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
 const typename NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::Policy_t&
 NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::getSolution()
@@ -354,5 +389,12 @@ void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::l
     nlocBackend_->logSummaryToMatlab(fileName);
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR, bool CONTINUOUS>
+void NLOptConSolver<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR, CONTINUOUS>::logSummaryToTrace(
+    const std::string& fileName)
+{
+    nlocBackend_->logSummaryToTrace(fileName);
+}
+
 }  // namespace optcon
 }  // namespace ct
@@ -122,9 +122,22 @@ public:
 
     /**
 	 * solve the optimal control problem
+	 *
+	 * If a deadline is set, no new iteration is started once the estimated iteration time exceeds the remaining time.
 	 * */
     virtual bool solve() override;
 
+    /*!
+	 * \brief Set a wall-clock deadline for the following solve() or MPC iteration calls.
+	 *
+	 * Iterations, line-search candidates and constraint linearizations on distant stages are skipped or truncated
+	 * based on run-time estimates from previous iterations. The solution always holds the best iterate found so far.
+	 */
+    void setDeadline(const NLOCTimeBudget::time_point_t& deadline);
+
+    //! remove the deadline
+    void clearDeadline();
+
     /**
 	 * Get the optimized control policy to the optimal control problem
 	 * @return
@@ -242,6 +255,9 @@ public:
     //! logging a short summary to matlab
     void logSummaryToMatlab(const std::string& fileName);
 
+    //! write a short summary to the binary trace file <fileName>.cttrace
+    void logSummaryToTrace(const std::string& fileName);
+
 protected:
     //! the backend holding all the math operations
     std::shared_ptr<Backend_t> nlocBackend_;
@@ -252,6 +268,9 @@ protected:
 private:
     //! set algorithm, use as private only
     void setAlgorithm(const Settings_t& settings);
+
+    //! the duration of the last prepare step in seconds, which counts towards the ITERATION estimate
+    double prepareDuration_;
 };
 
 
@@ -27,6 +27,8 @@ GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::GNRiccatiSolver(int N)
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 void GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::solve()
 {
+    CT_PROFILE_SCOPE("GNRiccatiSolver::solve");
+
     for (int i = this->lqocProblem_->getNumberOfStages() - 1; i >= 0; i--)
         solveSingleStage(i);
 }
@@ -280,6 +282,18 @@ void GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::logToMatlab()
 #endif
 }
 
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::logToTrace(ct::core::TraceWriter& trace, uint64_t iteration)
+{
+    trace.writeArray("riccati_sv", iteration, sv_);
+    trace.writeArray("riccati_S", iteration, S_);
+    trace.writeArray("riccati_H", iteration, H_);
+    trace.writeArray("riccati_Hi", iteration, Hi_);
+    trace.writeArray("riccati_Hi_inverse", iteration, Hi_inverse_);
+    trace.writeArray("riccati_G", iteration, G_);
+    trace.writeArray("riccati_gv", iteration, gv_);
+}
+
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
 void GNRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::initializeAndAllocate()
 {
@@ -60,6 +60,9 @@ public:
 
     virtual SCALAR getSmallestEigenvalue() override;
 
+    //! append the cost-to-go and the control Hessians of the last solve, the content of logToMatlab()
+    virtual void logToTrace(ct::core::TraceWriter& trace, uint64_t iteration) override;
+
 protected:
     /*!
 	 * resize matrices
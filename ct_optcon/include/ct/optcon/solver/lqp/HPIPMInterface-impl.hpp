@@ -184,6 +184,8 @@ void HPIPMInterface<STATE_DIM, CONTROL_DIM>::configure(const NLOptConSettings& s
 template <int STATE_DIM, int CONTROL_DIM>
 void HPIPMInterface<STATE_DIM, CONTROL_DIM>::solve()
 {
+    CT_PROFILE_SCOPE("HPIPMInterface::solve");
+
 // optional printout
 #ifdef HPIPM_PRINT_MATRICES
     for (int i = 0; i < N_ + 1; i++)
@@ -557,6 +559,12 @@ bool HPIPMInterface<STATE_DIM, CONTROL_DIM>::configureGeneralConstraints(
     }
 
 
+    // grow all containers before taking pointers, such that no stage invalidates the pointers of earlier stages
+    const int maxConstraints = *std::max_element(lqocProblem->ng_.begin(), lqocProblem->ng_.end());
+    lqocProblem->reserveGeneralConstraints(maxConstraints);
+    hlg_mask_Eigen_.reserve(maxConstraints);
+    hug_mask_Eigen_.reserve(maxConstraints);
+
     // HPIPM-specific correction for first-stage general constraint bounds
     hd_lg_0_Eigen_ = lqocProblem->d_lb_[0];  // - lqocProblem->C_[0] * x0; // uncommented since x0=0
     hd_ug_0_Eigen_ = lqocProblem->d_ub_[0];  // - lqocProblem->C_[0] * x0; // uncommented since x0=0
@@ -570,14 +578,10 @@ bool HPIPMInterface<STATE_DIM, CONTROL_DIM>::configureGeneralConstraints(
             configChanged = true;
         }
 
-        lqocProblem->C_[i].resize(lqocProblem->ng_[i], STATE_DIM);
-        lqocProblem->D_[i].resize(lqocProblem->ng_[i], CONTROL_DIM);
-        lqocProblem->d_lb_[i].resize(lqocProblem->ng_[i], 1);
-        lqocProblem->d_ub_[i].resize(lqocProblem->ng_[i], 1);
-
-        // resize constraint mask data
-        hlg_mask_Eigen_[i] = Eigen::VectorXd(ng_[i]);
-        hug_mask_Eigen_[i] = Eigen::VectorXd(ng_[i]);
+        // the constraint data is passed in place, within the capacity resizing does not allocate
+        lqocProblem->setGeneralConstraintCount(i, ng_[i]);
+        hlg_mask_Eigen_.setRows(i, ng_[i]);
+        hug_mask_Eigen_.setRows(i, ng_[i]);
 
         // set pointers to hpipm-style box constraint boundaries and sparsity pattern
         if (i == 0)
@@ -217,9 +217,9 @@ private:
     std::vector<double*> hlg_mask_;
     std::vector<double*> hug_mask_;
 
-    // containers for general constraints masks
-    std::vector<Eigen::VectorXd, Eigen::aligned_allocator<Eigen::VectorXd>> hlg_mask_Eigen_;
-    std::vector<Eigen::VectorXd, Eigen::aligned_allocator<Eigen::VectorXd>> hug_mask_Eigen_;
+    // containers for general constraints masks, preallocated like the general constraints of the LQOCProblem
+    FixedCapacityMatrixArray<double, 1> hlg_mask_Eigen_;
+    FixedCapacityMatrixArray<double, 1> hug_mask_Eigen_;
 
     //  local vars for constraint bounds for statge k=0, which need to be different by HPIPM convention
     Eigen::VectorXd hd_lg_0_Eigen_;
@@ -5,6 +5,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <ct/core/common/TraceWriter.h>
 #include <ct/optcon/solver/NLOptConSettings.hpp>
 
 #include <ct/optcon/problem/LQOCProblem.hpp>
@@ -100,6 +101,9 @@ public:
         throw std::runtime_error("getSmallestEigenvalue not available for this solver.");
     }
 
+    //! append the internal matrices of the last solve to a binary trace, solvers without internals write nothing
+    virtual void logToTrace(ct::core::TraceWriter& trace, uint64_t iteration) {}
+
 
 protected:
     virtual void setProblemImpl(std::shared_ptr<LQOCProblem_t> lqocProblem) = 0;
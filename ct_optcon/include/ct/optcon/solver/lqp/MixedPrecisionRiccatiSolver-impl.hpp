@@ -0,0 +1,144 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+ **********************************************************************************************************************/
+
+#pragma once
+
+namespace ct {
+namespace optcon {
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::MixedPrecisionRiccatiSolver(
+    const std::shared_ptr<LQOCProblem_t>& lqocProblem)
+    : LQOCSolver<STATE_DIM, CONTROL_DIM, SCALAR>(lqocProblem), lqocProblemDouble_(new LQOCProblemDouble_t())
+{
+    if (lqocProblem)
+        setProblemImpl(lqocProblem);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::solve()
+{
+    CT_PROFILE_SCOPE("MixedPrecisionRiccatiSolver::solve");
+
+    for (int i = this->lqocProblem_->getNumberOfStages() - 1; i >= 0; i--)
+        solveSingleStage(i);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::initializeAndAllocate()
+{
+    riccatiSolver_.initializeAndAllocate();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::solveSingleStage(int N)
+{
+    const int K = this->lqocProblem_->getNumberOfStages();
+    if (N == K - 1)
+    {
+        // terminal cost
+        lqocProblemDouble_->Q_[K] = this->lqocProblem_->Q_[K].template cast<double>();
+        lqocProblemDouble_->qv_[K] = this->lqocProblem_->qv_[K].template cast<double>();
+        lqocProblemDouble_->q_[K] = this->lqocProblem_->q_[K];
+    }
+
+    convertStage(N);
+    riccatiSolver_.solveSingleStage(N);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::configure(const NLOptConSettings& settings)
+{
+    riccatiSolver_.configure(settings);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::computeStatesAndControls()
+{
+    riccatiSolver_.computeStatesAndControls();
+
+    const core::StateVectorArray<STATE_DIM, double>& x = riccatiSolver_.getSolutionState();
+    const core::ControlVectorArray<CONTROL_DIM, double>& u = riccatiSolver_.getSolutionControl();
+    for (size_t k = 0; k < u.size(); k++)
+        this->u_sol_[k] = u[k].template cast<SCALAR>();
+    for (size_t k = 0; k < x.size(); k++)
+        this->x_sol_[k] = x[k].template cast<SCALAR>();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::computeFeedbackMatrices()
+{
+    riccatiSolver_.computeFeedbackMatrices();
+
+    const core::FeedbackArray<STATE_DIM, CONTROL_DIM, double>& L = riccatiSolver_.getSolutionFeedback();
+    for (size_t k = 0; k < L.size(); k++)
+        this->L_[k] = L[k].template cast<SCALAR>();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::compute_lv()
+{
+    riccatiSolver_.compute_lv();
+
+    const core::ControlVectorArray<CONTROL_DIM, double>& lv = riccatiSolver_.get_lv();
+    for (size_t k = 0; k < lv.size(); k++)
+        this->lv_[k] = lv[k].template cast<SCALAR>();
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+SCALAR MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::getSmallestEigenvalue()
+{
+    return static_cast<SCALAR>(riccatiSolver_.getSmallestEigenvalue());
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::logToTrace(ct::core::TraceWriter& trace,
+    uint64_t iteration)
+{
+    riccatiSolver_.logToTrace(trace, iteration);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::setProblemImpl(
+    std::shared_ptr<LQOCProblem_t> lqocProblem)
+{
+    if (lqocProblem->isConstrained())
+    {
+        throw std::runtime_error(
+            "Selected wrong solver - MixedPrecisionRiccatiSolver cannot handle constrained problems. Use a different "
+            "solver");
+    }
+
+    const int N = lqocProblem->getNumberOfStages();
+    if (N != lqocProblemDouble_->getNumberOfStages())
+    {
+        lqocProblemDouble_->changeNumStages(N);
+        this->x_sol_.resize(N + 1);
+        this->u_sol_.resize(N);
+        this->L_.resize(N);
+        this->lv_.resize(N);
+    }
+    riccatiSolver_.setProblem(lqocProblemDouble_);
+}
+
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void MixedPrecisionRiccatiSolver<STATE_DIM, CONTROL_DIM, SCALAR>::convertStage(int k)
+{
+    const LQOCProblem_t& p = *this->lqocProblem_;
+    LQOCProblemDouble_t& pd = *lqocProblemDouble_;
+
+    pd.A_[k] = p.A_[k].template cast<double>();
+    pd.B_[k] = p.B_[k].template cast<double>();
+    pd.b_[k] = p.b_[k].template cast<double>();
+    pd.q_[k] = p.q_[k];
+    pd.qv_[k] = p.qv_[k].template cast<double>();
+    pd.Q_[k] = p.Q_[k].template cast<double>();
+    pd.rv_[k] = p.rv_[k].template cast<double>();
+    pd.R_[k] = p.R_[k].template cast<double>();
+    pd.P_[k] = p.P_[k].template cast<double>();
+}
+
+}  // namespace optcon
+}  // namespace ct
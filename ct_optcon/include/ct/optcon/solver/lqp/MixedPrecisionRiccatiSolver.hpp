@@ -0,0 +1,64 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include "GNRiccatiSolver.hpp"
+
+namespace ct {
+namespace optcon {
+
+/*!
+ * Solves an unconstrained LQOCProblem given in reduced precision (typically float) with a GNRiccatiSolver in double
+ * precision.
+ *
+ * This allows running the rollouts and the LQ approximation in single precision, while the Riccati recursion, which
+ * is sensitive to round-off in the cost-to-go, is performed in double precision. The problem is converted stage by
+ * stage as the recursion proceeds, such that the solver can also be used with the stage-wise solution of the
+ * multi-threaded NLOC backend. The solution is converted back to SCALAR.
+ */
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR = float>
+class MixedPrecisionRiccatiSolver : public LQOCSolver<STATE_DIM, CONTROL_DIM, SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef LQOCProblem<STATE_DIM, CONTROL_DIM, SCALAR> LQOCProblem_t;
+    typedef LQOCProblem<STATE_DIM, CONTROL_DIM, double> LQOCProblemDouble_t;
+
+    MixedPrecisionRiccatiSolver(const std::shared_ptr<LQOCProblem_t>& lqocProblem = nullptr);
+
+    virtual void solve() override;
+
+    virtual void initializeAndAllocate() override;
+
+    virtual void solveSingleStage(int N) override;
+
+    virtual void configure(const NLOptConSettings& settings) override;
+
+    virtual void computeStatesAndControls() override;
+
+    virtual void computeFeedbackMatrices() override;
+
+    virtual void compute_lv() override;
+
+    virtual SCALAR getSmallestEigenvalue() override;
+
+    //! append the double precision internals of the Riccati recursion, see GNRiccatiSolver::logToTrace()
+    virtual void logToTrace(ct::core::TraceWriter& trace, uint64_t iteration) override;
+
+protected:
+    virtual void setProblemImpl(std::shared_ptr<LQOCProblem_t> lqocProblem) override;
+
+    //! convert the dynamics and cost of stage k to double precision
+    void convertStage(int k);
+
+    std::shared_ptr<LQOCProblemDouble_t> lqocProblemDouble_;
+
+    GNRiccatiSolver<STATE_DIM, CONTROL_DIM, double> riccatiSolver_;
+};
+
+}  // namespace optcon
+}  // namespace ct
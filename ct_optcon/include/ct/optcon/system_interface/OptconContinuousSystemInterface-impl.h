@@ -28,6 +28,9 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
     if (dyn == nullptr)
         throw std::runtime_error("system dynamics are nullptr");
 
+    // initializeThread() re-creates the instances of a thread from the problem
+    this->optConProblem_.setNonlinearSystem(dyn);
+
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
     {
         this->systems_.at(i) = typename optConProblem_t::DynamicsPtr_t(dyn->clone());
@@ -35,6 +38,7 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
 
         discretizers_.at(i) = system_discretizer_ptr_t(new discretizer_t(
             this->systems_.at(i), this->settings_.dt, this->settings_.integrator, this->settings_.K_sim));
+        discretizers_.at(i)->setSplitAtSwitchingTimes(!this->settings_.useSensitivityIntegrator);
         discretizers_.at(i)->initialize();
     }
 }
@@ -45,6 +49,8 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
     if (lin == nullptr)
         throw std::runtime_error("linear system dynamics are nullptr");
 
+    this->optConProblem_.setLinearSystem(lin);
+
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
     {
         this->linearSystems_.at(i) = typename optConProblem_t::LinearPtr_t(lin->clone());
@@ -61,39 +67,51 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
     sensitivity_.resize(this->settings_.nThreads + 1);
 
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
-    {
-        // make a deep copy of the system for each thread
-        this->systems_.at(i) =
-            typename optConProblem_t::DynamicsPtr_t(this->optConProblem_.getNonlinearSystem()->clone());
-        this->systems_.at(i)->setController(this->controller_.at(i));
+        initializeThread(i);
+}
 
-        this->linearSystems_.at(i) =
-            typename optConProblem_t::LinearPtr_t(this->optConProblem_.getLinearSystem()->clone());
+template <size_t STATE_DIM, size_t CONTROL_DIM, size_t P_DIM, size_t V_DIM, typename SCALAR>
+void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALAR>::initializeThread(
+    const size_t threadId)
+{
+    const size_t i = threadId;
 
-        discretizers_.at(i) = system_discretizer_ptr_t(new discretizer_t(
-            this->systems_.at(i), this->settings_.dt, this->settings_.integrator, this->settings_.K_sim));
-        discretizers_.at(i)->initialize();
+    this->controller_.at(i) = typename Base::ConstantControllerPtr(new typename Base::constant_controller_t());
 
-        if (this->settings_.useSensitivityIntegrator)
-        {
-            if (this->settings_.integrator != ct::core::IntegrationType::EULER &&
-                this->settings_.integrator != ct::core::IntegrationType::EULERCT &&
-                this->settings_.integrator != ct::core::IntegrationType::RK4 &&
-                this->settings_.integrator != ct::core::IntegrationType::RK4CT &&
-                this->settings_.integrator != ct::core::IntegrationType::EULER_SYM)
-                throw std::runtime_error("sensitivity integrator only available for Euler and RK4 integrators");
-
-            sensitivity_.at(i) = SensitivityPtr(
-                new ct::core::SensitivityIntegrator<STATE_DIM, CONTROL_DIM, STATE_DIM / 2, STATE_DIM / 2, SCALAR>(
-                    this->settings_.getSimulationTimestep(), this->linearSystems_.at(i), this->controller_.at(i),
-                    this->settings_.integrator, this->settings_.timeVaryingDiscretization));
-        }
-        else
-        {
-            sensitivity_.at(i) = SensitivityPtr(
-                new ct::core::SensitivityApproximation<STATE_DIM, CONTROL_DIM, STATE_DIM / 2, STATE_DIM / 2, SCALAR>(
-                    this->settings_.dt, this->linearSystems_.at(i), this->settings_.discretization));
-        }
+    // make a deep copy of the system for each thread
+    this->systems_.at(i) =
+        typename optConProblem_t::DynamicsPtr_t(this->optConProblem_.getNonlinearSystem()->clone());
+    this->systems_.at(i)->setController(this->controller_.at(i));
+
+    this->linearSystems_.at(i) =
+        typename optConProblem_t::LinearPtr_t(this->optConProblem_.getLinearSystem()->clone());
+
+    discretizers_.at(i) = system_discretizer_ptr_t(new discretizer_t(
+        this->systems_.at(i), this->settings_.dt, this->settings_.integrator, this->settings_.K_sim));
+    // the sensitivity integrator differentiates equally long substeps, which must not be split at switches
+    discretizers_.at(i)->setSplitAtSwitchingTimes(!this->settings_.useSensitivityIntegrator);
+    discretizers_.at(i)->initialize();
+
+    if (this->settings_.useSensitivityIntegrator)
+    {
+        if (this->settings_.integrator != ct::core::IntegrationType::EULER &&
+            this->settings_.integrator != ct::core::IntegrationType::EULERCT &&
+            this->settings_.integrator != ct::core::IntegrationType::RK4 &&
+            this->settings_.integrator != ct::core::IntegrationType::RK4CT &&
+            this->settings_.integrator != ct::core::IntegrationType::EULER_SYM)
+            throw std::runtime_error("sensitivity integrator only available for Euler and RK4 integrators");
+
+        sensitivity_.at(i) = SensitivityPtr(
+            new ct::core::SensitivityIntegrator<STATE_DIM, CONTROL_DIM, STATE_DIM / 2, STATE_DIM / 2, SCALAR>(
+                this->settings_.getSimulationTimestep(), this->linearSystems_.at(i), this->controller_.at(i),
+                this->settings_.integrator, this->settings_.timeVaryingDiscretization));
+    }
+    else
+    {
+        sensitivity_.at(i) = SensitivityPtr(
+            new ct::core::SensitivityApproximation<STATE_DIM, CONTROL_DIM, STATE_DIM / 2, STATE_DIM / 2, SCALAR>(
+                this->settings_.dt, this->linearSystems_.at(i), this->settings_.discretization,
+                this->settings_.timeInvariantDynamics));
     }
 }
 
@@ -117,6 +135,7 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
             break;
 
         sensitivity_[i]->setApproximation(settings.discretization);
+        sensitivity_[i]->setTimeInvariant(settings.timeInvariantDynamics);
 
         if (settings.useSensitivityIntegrator)
             sensitivity_[i]->setTimeDiscretization(settings.getSimulationTimestep());
@@ -124,6 +143,7 @@ void OptconContinuousSystemInterface<STATE_DIM, CONTROL_DIM, P_DIM, V_DIM, SCALA
             sensitivity_[i]->setTimeDiscretization(settings.dt);
 
         discretizers_[i]->setParameters(settings.dt, settings.K_sim);
+        discretizers_[i]->setSplitAtSwitchingTimes(!settings.useSensitivityIntegrator);
     }
 
     this->settings_ = settings;
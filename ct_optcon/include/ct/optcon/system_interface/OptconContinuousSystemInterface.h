@@ -65,6 +65,7 @@ public:
     virtual ~OptconContinuousSystemInterface() {}
     //! perform necessary setup work
     virtual void initialize() override;
+    virtual void initializeThread(const size_t threadId) override;
     virtual void configure(const settings_t& settings) override;
 
     //! retrieve discrete-time linear system matrices A and B.
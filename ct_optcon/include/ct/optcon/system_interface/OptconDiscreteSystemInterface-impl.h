@@ -48,6 +48,9 @@ void OptconDiscreteSystemInterface<STATE_DIM, CONTROL_DIM, SCALAR>::changeNonlin
     if (dyn == nullptr)
         throw std::runtime_error("system dynamics are nullptr");
 
+    // initializeThread() re-creates the instances of a thread from the problem
+    this->optConProblem_.setNonlinearSystem(dyn);
+
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
     {
         this->systems_.at(i) = typename optConProblem_t::DynamicsPtr_t(dyn->clone());
@@ -62,6 +65,8 @@ void OptconDiscreteSystemInterface<STATE_DIM, CONTROL_DIM, SCALAR>::changeLinear
     if (lin == nullptr)
         throw std::runtime_error("linear system dynamics are nullptr");
 
+    this->optConProblem_.setLinearSystem(lin);
+
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
     {
         this->linearSystems_.at(i) = typename optConProblem_t::LinearPtr_t(lin->clone());
@@ -75,15 +80,23 @@ void OptconDiscreteSystemInterface<STATE_DIM, CONTROL_DIM, SCALAR>::initialize()
     this->linearSystems_.resize(this->settings_.nThreads + 1);
 
     for (int i = 0; i < this->settings_.nThreads + 1; i++)
-    {
-        // make a deep copy of the system for each thread
-        this->systems_.at(i) =
-            typename optConProblem_t::DynamicsPtr_t(this->optConProblem_.getNonlinearSystem()->clone());
-        this->systems_.at(i)->setController(this->controller_.at(i));
+        initializeThread(i);
+}
 
-        this->linearSystems_.at(i) =
-            typename optConProblem_t::LinearPtr_t(this->optConProblem_.getLinearSystem()->clone());
-    }
+template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
+void OptconDiscreteSystemInterface<STATE_DIM, CONTROL_DIM, SCALAR>::initializeThread(const size_t threadId)
+{
+    const size_t i = threadId;
+
+    this->controller_.at(i) = typename Base::ConstantControllerPtr(new typename Base::constant_controller_t());
+
+    // make a deep copy of the system for each thread
+    this->systems_.at(i) =
+        typename optConProblem_t::DynamicsPtr_t(this->optConProblem_.getNonlinearSystem()->clone());
+    this->systems_.at(i)->setController(this->controller_.at(i));
+
+    this->linearSystems_.at(i) =
+        typename optConProblem_t::LinearPtr_t(this->optConProblem_.getLinearSystem()->clone());
 }
 
 template <size_t STATE_DIM, size_t CONTROL_DIM, typename SCALAR>
@@ -60,6 +60,11 @@ public:
 
     //! perform any required setup work
     virtual void initialize() {}
+    //! (re-)create the instances dedicated to thread threadId from the optConProblem
+    /*!
+     * When called by that thread itself, its instances are allocated on the NUMA node the thread runs on.
+     */
+    virtual void initializeThread(const size_t threadId) {}
     virtual void configure(const settings_t& settings) {}
     //! retrieve discrete-time linear system matrices A and B.
     /*!
@@ -338,6 +338,162 @@ TEST(CostFunctionTest, TrackingTermTest)
     ASSERT_TRUE(costFunction->controlDerivativeIntermediateTest());
 }
 
+/*!
+ * Test that a cost function bound to a time grid, with precomputed activations and references, evaluates to the
+ * same costs and derivatives as the unbound cost function, both on and off the grid.
+ */
+TEST(CostFunctionTest, TimeGridBindingTest)
+{
+    const size_t state_dim = 12;
+    const size_t control_dim = 4;
+
+    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim>> costFunction(
+        new CostFunctionAnalytical<state_dim, control_dim>());
+
+    Eigen::Matrix<double, state_dim, state_dim> Q = Eigen::Matrix<double, state_dim, state_dim>::Identity();
+    Eigen::Matrix<double, control_dim, control_dim> R = Eigen::Matrix<double, control_dim, control_dim>::Identity();
+
+    core::StateTrajectory<state_dim> stateTraj;
+    core::ControlTrajectory<control_dim> controlTraj;
+    for (size_t i = 0; i < 11; ++i)
+    {
+        stateTraj.push_back(core::StateVector<state_dim>::Random(), double(i), true);
+        controlTraj.push_back(core::ControlVector<control_dim>::Random(), double(i), true);
+    }
+
+    std::shared_ptr<TermQuadTracking<state_dim, control_dim>> trackingTerm(new TermQuadTracking<state_dim, control_dim>(
+        Q, R, core::InterpolationType::LIN, core::InterpolationType::ZOH, true));
+    trackingTerm->setStateAndControlReference(stateTraj, controlTraj);
+    costFunction->addIntermediateTerm(trackingTerm);
+    costFunction->addFinalTerm(std::shared_ptr<TermQuadTracking<state_dim, control_dim>>(trackingTerm->clone()));
+
+    std::shared_ptr<TermQuadratic<state_dim, control_dim>> gaussTerm(new TermQuadratic<state_dim, control_dim>(Q, R));
+    gaussTerm->setTimeActivation(std::shared_ptr<core::RBFGaussActivation>(new core::RBFGaussActivation(4.0, 1.5)));
+    costFunction->addIntermediateTerm(gaussTerm);
+
+    std::shared_ptr<TermQuadratic<state_dim, control_dim>> singleTerm(new TermQuadratic<state_dim, control_dim>(Q, R));
+    singleTerm->setTimeActivation(std::shared_ptr<core::SingleActivation>(new core::SingleActivation(2.0, 5.0)));
+
+    core::TimeArray grid(0.1, 101);
+    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim>> boundCostFunction(costFunction->clone());
+    boundCostFunction->bindToTimeGrid(grid);
+
+    // terms added after binding are bound as well
+    costFunction->addIntermediateTerm(singleTerm);
+    boundCostFunction->addIntermediateTerm(
+        std::shared_ptr<TermQuadratic<state_dim, control_dim>>(singleTerm->clone()));
+
+    // clones keep the binding
+    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim>> boundClone(boundCostFunction->clone());
+
+    for (size_t k = 0; k < grid.size(); k++)
+    {
+        ct::core::StateVector<state_dim> x = ct::core::StateVector<state_dim>::Random();
+        ct::core::ControlVector<control_dim> u = ct::core::ControlVector<control_dim>::Random();
+
+        // query the grid points and the times in between
+        for (double t : {grid[k], grid[k] + 0.05})
+        {
+            costFunction->setCurrentStateAndControl(x, u, t);
+            boundCostFunction->setCurrentStateAndControl(x, u, t);
+            boundClone->setCurrentStateAndControl(x, u, t);
+
+            compareCostFunctionOutput(*costFunction, *boundCostFunction);
+            compareCostFunctionOutput(*costFunction, *boundClone);
+        }
+    }
+
+    // changing the reference of a bound term updates the precomputed reference
+    for (size_t i = 0; i < stateTraj.size(); ++i)
+        stateTraj[i].setRandom();
+    trackingTerm->setStateAndControlReference(stateTraj, controlTraj);
+    std::static_pointer_cast<TermQuadTracking<state_dim, control_dim>>(boundCostFunction->getIntermediateTermById(0))
+        ->setStateAndControlReference(stateTraj, controlTraj);
+
+    ct::core::StateVector<state_dim> x = ct::core::StateVector<state_dim>::Random();
+    ct::core::ControlVector<control_dim> u = ct::core::ControlVector<control_dim>::Random();
+    costFunction->setCurrentStateAndControl(x, u, 3.3);
+    boundCostFunction->setCurrentStateAndControl(x, u, 3.3);
+    compareCostFunctionOutput(*costFunction, *boundCostFunction);
+
+    ASSERT_TRUE(boundCostFunction->stateDerivativeIntermediateTest());
+    ASSERT_TRUE(boundCostFunction->controlDerivativeIntermediateTest());
+}
+
+/*!
+ * Test that the single-pass quadratic model of the built-in terms matches the individual evaluations
+ */
+TEST(CostFunctionTest, QuadraticModelTest)
+{
+    const size_t state_dim = 12;
+    const size_t control_dim = 4;
+
+    typedef CostFunctionQuadratic<state_dim, control_dim> CostFunctionQuadratic_t;
+
+    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim>> costFunction(
+        new CostFunctionAnalytical<state_dim, control_dim>());
+
+    Eigen::Matrix<double, state_dim, state_dim> Q = Eigen::Matrix<double, state_dim, state_dim>::Random();
+    Eigen::Matrix<double, control_dim, control_dim> R = Eigen::Matrix<double, control_dim, control_dim>::Random();
+    Eigen::Matrix<double, control_dim, state_dim> P = Eigen::Matrix<double, control_dim, state_dim>::Random();
+    core::StateVector<state_dim> x_ref = core::StateVector<state_dim>::Random();
+    core::ControlVector<control_dim> u_ref = core::ControlVector<control_dim>::Random();
+
+    core::StateTrajectory<state_dim> stateTraj;
+    core::ControlTrajectory<control_dim> controlTraj;
+    for (size_t i = 0; i < 11; ++i)
+    {
+        stateTraj.push_back(core::StateVector<state_dim>::Random(), double(i), true);
+        controlTraj.push_back(core::ControlVector<control_dim>::Random(), double(i), true);
+    }
+    std::shared_ptr<TermQuadTracking<state_dim, control_dim>> trackingTerm(new TermQuadTracking<state_dim, control_dim>(
+        Q, R, core::InterpolationType::LIN, core::InterpolationType::ZOH, true));
+    trackingTerm->setStateAndControlReference(stateTraj, controlTraj);
+
+    std::shared_ptr<TermQuadratic<state_dim, control_dim>> quadraticTerm(
+        new TermQuadratic<state_dim, control_dim>(Q, R, x_ref, u_ref));
+    quadraticTerm->setTimeActivation(std::shared_ptr<core::RBFGaussActivation>(new core::RBFGaussActivation(4.0, 1.5)));
+
+    core::StateVector<state_dim> ub = core::StateVector<state_dim>::Ones();
+    core::StateVector<state_dim> lb = -core::StateVector<state_dim>::Ones();
+    core::StateVector<state_dim> alpha = core::StateVector<state_dim>::Constant(2.0);
+
+    costFunction->addIntermediateTerm(trackingTerm);
+    costFunction->addIntermediateTerm(quadraticTerm);
+    costFunction->addIntermediateTerm(
+        std::shared_ptr<TermMixed<state_dim, control_dim>>(new TermMixed<state_dim, control_dim>(P, x_ref, u_ref)));
+    costFunction->addIntermediateTerm(std::shared_ptr<TermLinear<state_dim, control_dim>>(
+        new TermLinear<state_dim, control_dim>(x_ref, u_ref, 0.5)));
+    costFunction->addIntermediateTerm(std::shared_ptr<TermQuadMult<state_dim, control_dim>>(
+        new TermQuadMult<state_dim, control_dim>(Q, R, x_ref, u_ref)));
+    costFunction->addIntermediateTerm(std::shared_ptr<TermStateBarrier<state_dim, control_dim>>(
+        new TermStateBarrier<state_dim, control_dim>(ub, lb, alpha)));
+    costFunction->addIntermediateTerm(std::shared_ptr<TermSmoothAbs<state_dim, control_dim>>(
+        new TermSmoothAbs<state_dim, control_dim>(x_ref, x_ref, u_ref, u_ref, 0.5)));
+
+    QuadraticCostModel<state_dim, control_dim> model, reference;
+    for (size_t i = 0; i < 100; i++)
+    {
+        ct::core::StateVector<state_dim> x = ct::core::StateVector<state_dim>::Random();
+        ct::core::ControlVector<control_dim> u = ct::core::ControlVector<control_dim>::Random();
+        costFunction->setCurrentStateAndControl(x, u, 0.1 * i);
+
+        costFunction->quadraticModelIntermediate(model);
+        // the default implementation calls the individual evaluations
+        costFunction->CostFunctionQuadratic_t::quadraticModelIntermediate(reference);
+
+        ASSERT_NEAR(model.q, reference.q, 1e-9 * std::abs(reference.q));
+        ASSERT_TRUE(model.qv.isApprox(reference.qv));
+        ASSERT_TRUE(model.Q.isApprox(reference.Q));
+        ASSERT_TRUE(model.rv.isApprox(reference.rv));
+        ASSERT_TRUE(model.R.isApprox(reference.R));
+        ASSERT_TRUE(model.P.isApprox(reference.P));
+    }
+
+    ASSERT_TRUE(costFunction->stateDerivativeIntermediateTest());
+    ASSERT_TRUE(costFunction->controlDerivativeIntermediateTest());
+}
+
 /*!
  * Test the TermSmoothAbs term for first and second order derivatives
  */
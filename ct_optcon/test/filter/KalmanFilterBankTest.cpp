@@ -0,0 +1,269 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <ct/optcon/optcon.h>
+#include <gtest/gtest.h>
+
+using namespace ct::core;
+using namespace ct::optcon;
+
+const size_t state_dim = 2;
+const size_t control_dim = 1;
+const size_t output_dim = 1;
+const size_t nInstances = 7;
+
+//! a discretized pendulum
+class PendulumModel : public SystemModelBase<state_dim, control_dim>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    state_vector_t computeDynamics(const state_vector_t& x, const control_vector_t& u, const Time_t dt, Time_t) override
+    {
+        state_vector_t xNext;
+        xNext << x(0) + dt * x(1), x(1) + dt * (-9.81 * std::sin(x(0)) + u(0));
+        return xNext;
+    }
+
+    state_matrix_t computeDerivativeState(const state_vector_t& x,
+        const control_vector_t&,
+        const Time_t dt,
+        Time_t) override
+    {
+        state_matrix_t A;
+        A << 1.0, dt, -dt * 9.81 * std::cos(x(0)), 1.0;
+        return A;
+    }
+
+    state_matrix_t computeDerivativeNoise(const state_vector_t&,
+        const control_vector_t&,
+        const Time_t dt,
+        Time_t) override
+    {
+        return dt * state_matrix_t::Identity();
+    }
+};
+
+//! the pendulum, counting the calls of the batch functions
+class CountingPendulumModel : public PendulumModel
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    CountingPendulumModel() : nDynamicsCalls(0), nDerivativeStateCalls(0), nDerivativeNoiseCalls(0) {}
+    void computeDynamicsBatchPerControl(Eigen::Ref<state_batch_t> states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t) override
+    {
+        nDynamicsCalls++;
+        PendulumModel::computeDynamicsBatchPerControl(states, controls, dt, t);
+    }
+
+    void computeDerivativeStateBatch(const Eigen::Ref<const state_batch_t>& states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t,
+        Eigen::Ref<state_matrix_batch_t> derivatives) override
+    {
+        nDerivativeStateCalls++;
+        PendulumModel::computeDerivativeStateBatch(states, controls, dt, t, derivatives);
+    }
+
+    void computeDerivativeNoiseBatch(const Eigen::Ref<const state_batch_t>& states,
+        const control_batch_t& controls,
+        const Time_t dt,
+        Time_t t,
+        Eigen::Ref<state_matrix_batch_t> derivatives) override
+    {
+        nDerivativeNoiseCalls++;
+        PendulumModel::computeDerivativeNoiseBatch(states, controls, dt, t, derivatives);
+    }
+
+    size_t nDynamicsCalls;
+    size_t nDerivativeStateCalls;
+    size_t nDerivativeNoiseCalls;
+};
+
+//! measurement of the pendulum angle
+std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>> measurePosition()
+{
+    OutputStateMatrix<output_dim, state_dim> C;
+    C << 1.0, 0.0;
+    return std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>>(
+        new LTIMeasurementModel<output_dim, state_dim>(C, OutputMatrix<output_dim>::Identity()));
+}
+
+//! measurement of the pendulum angle which counts the batch-evaluated states
+class CountingMeasurementModel : public LTIMeasurementModel<output_dim, state_dim>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    CountingMeasurementModel()
+        : LTIMeasurementModel<output_dim, state_dim>(
+              OutputStateMatrix<output_dim, state_dim>(Eigen::RowVector2d(1.0, 0.0)),
+              OutputMatrix<output_dim>::Identity()),
+          nEvaluations(0)
+    {
+    }
+
+    void computeMeasurementBatch(const Eigen::Ref<const state_batch_t>& states,
+        Eigen::Ref<output_batch_t> outputs,
+        const Time_t& t = 0) override
+    {
+        nEvaluations += states.cols();
+        LTIMeasurementModel<output_dim, state_dim>::computeMeasurementBatch(states, outputs, t);
+    }
+
+    Eigen::Index nEvaluations;
+};
+
+//! run a filter bank and individual filters side by side, some instances miss measurements
+template <typename BANK, typename FILTER>
+void compareBankToIndividualFilters(BANK& bank, std::vector<std::shared_ptr<FILTER>>& filters)
+{
+    const double dt = 0.01;
+
+    Eigen::Matrix<double, control_dim, Eigen::Dynamic> u(control_dim, nInstances);
+    Eigen::Matrix<double, output_dim, Eigen::Dynamic> y(output_dim, nInstances);
+    typename BANK::mask_t mask(nInstances);
+
+    for (size_t i = 0; i < nInstances; i++)
+    {
+        StateVector<state_dim> x0;
+        x0 << 0.1 * i, -0.05 * i;
+        bank.setEstimate(i, x0);
+        filters[i]->setEstimate(x0);
+    }
+
+    for (size_t k = 0; k < 50; k++)
+    {
+        for (size_t i = 0; i < nInstances; i++)
+        {
+            u(0, i) = std::sin(0.1 * k + i);
+            y(0, i) = 0.1 * i * std::cos(0.2 * k);
+            mask(i) = (k + i) % 3 != 0;
+        }
+
+        bank.predict(u, dt, k * dt);
+        for (size_t i = 0; i < nInstances; i++)
+            filters[i]->predict(u.col(i), dt, k * dt);
+
+        bank.update(y, mask, dt, k * dt);
+        for (size_t i = 0; i < nInstances; i++)
+            if (mask(i))
+                filters[i]->update(y.col(i), dt, k * dt);
+
+        for (size_t i = 0; i < nInstances; i++)
+            ASSERT_LT((bank.getEstimate(i) - filters[i]->getEstimate()).norm(), 1e-10);
+    }
+}
+
+
+TEST(KalmanFilterBankTest, ExtendedKalmanFilterBank)
+{
+    std::shared_ptr<PendulumModel> f(new PendulumModel);
+    std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>> h = measurePosition();
+
+    const StateMatrix<state_dim> Q = 0.1 * StateMatrix<state_dim>::Identity();
+    const OutputMatrix<output_dim> R = 0.01 * OutputMatrix<output_dim>::Identity();
+    const StateMatrix<state_dim> P0 = StateMatrix<state_dim>::Identity();
+
+    ExtendedKalmanFilterBank<state_dim, control_dim, output_dim> bank(
+        f, h, Q, R, nInstances, StateVector<state_dim>::Zero(), P0);
+
+    std::vector<std::shared_ptr<ExtendedKalmanFilter<state_dim, control_dim, output_dim>>> filters;
+    for (size_t i = 0; i < nInstances; i++)
+        filters.emplace_back(new ExtendedKalmanFilter<state_dim, control_dim, output_dim>(
+            f, h, Q, R, StateVector<state_dim>::Zero(), P0));
+
+    compareBankToIndividualFilters(bank, filters);
+
+    for (size_t i = 0; i < nInstances; i++)
+        ASSERT_LT((bank.getCovarianceMatrix(i) - filters[i]->getCovarianceMatrix()).norm(), 1e-10);
+}
+
+
+TEST(KalmanFilterBankTest, UnscentedKalmanFilterBank)
+{
+    std::shared_ptr<PendulumModel> f(new PendulumModel);
+    std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>> h = measurePosition();
+
+    const StateMatrix<state_dim> P0 = 0.1 * StateMatrix<state_dim>::Identity();
+
+    UnscentedKalmanFilterBank<state_dim, control_dim, output_dim> bank(
+        f, h, nInstances, StateVector<state_dim>::Zero(), 0.5, 2.0, 0.0, P0);
+
+    std::vector<std::shared_ptr<UnscentedKalmanFilter<state_dim, control_dim, output_dim>>> filters;
+    for (size_t i = 0; i < nInstances; i++)
+        filters.emplace_back(new UnscentedKalmanFilter<state_dim, control_dim, output_dim>(
+            f, h, StateVector<state_dim>::Zero(), 0.5, 2.0, 0.0, P0));
+
+    compareBankToIndividualFilters(bank, filters);
+}
+
+
+TEST(KalmanFilterBankTest, MaskedInstancesAreSkipped)
+{
+    std::shared_ptr<PendulumModel> f(new PendulumModel);
+    std::shared_ptr<CountingMeasurementModel> h(new CountingMeasurementModel);
+
+    ExtendedKalmanFilterBank<state_dim, control_dim, output_dim> ekfBank(f, h, StateMatrix<state_dim>::Identity(),
+        OutputMatrix<output_dim>::Identity(), nInstances, StateVector<state_dim>::Zero(),
+        StateMatrix<state_dim>::Identity());
+    UnscentedKalmanFilterBank<state_dim, control_dim, output_dim> ukfBank(f, h, nInstances);
+
+    Eigen::Matrix<double, control_dim, Eigen::Dynamic> u = Eigen::MatrixXd::Zero(control_dim, nInstances);
+    Eigen::Matrix<double, output_dim, Eigen::Dynamic> y = Eigen::MatrixXd::Ones(output_dim, nInstances);
+    ExtendedKalmanFilterBank<state_dim, control_dim, output_dim>::mask_t mask(nInstances);
+    mask << true, true, false, true, false, false, true;
+    const Eigen::Index nFlagged = mask.count();
+
+    ekfBank.predict(u, 0.01, 0.0);
+    ekfBank.update(y, mask, 0.01, 0.0);
+    ASSERT_EQ(h->nEvaluations, nFlagged);
+
+    h->nEvaluations = 0;
+    ukfBank.predict(u, 0.01, 0.0);
+    ukfBank.update(y, mask, 0.01, 0.0);
+    ASSERT_EQ(h->nEvaluations, nFlagged * static_cast<Eigen::Index>(ukfBank.SigmaPointCount));
+
+    // the estimates of masked instances are only predicted
+    for (size_t i = 0; i < nInstances; i++)
+        if (!mask(i))
+            ASSERT_TRUE(ekfBank.getEstimate(i).isZero());
+}
+
+
+TEST(KalmanFilterBankTest, PredictPropagatesAllInstancesAtOnce)
+{
+    std::shared_ptr<CountingPendulumModel> f(new CountingPendulumModel);
+    std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>> h = measurePosition();
+
+    ExtendedKalmanFilterBank<state_dim, control_dim, output_dim> ekfBank(f, h, StateMatrix<state_dim>::Identity(),
+        OutputMatrix<output_dim>::Identity(), nInstances, StateVector<state_dim>::Zero(),
+        StateMatrix<state_dim>::Identity());
+    UnscentedKalmanFilterBank<state_dim, control_dim, output_dim> ukfBank(f, h, nInstances);
+
+    Eigen::Matrix<double, control_dim, Eigen::Dynamic> u = Eigen::MatrixXd::Ones(control_dim, nInstances);
+
+    ekfBank.predict(u, 0.01, 0.0);
+    ASSERT_EQ(f->nDynamicsCalls, 1u);
+    ASSERT_EQ(f->nDerivativeStateCalls, 1u);
+    ASSERT_EQ(f->nDerivativeNoiseCalls, 1u);
+
+    ukfBank.predict(u, 0.01, 0.0);
+    ASSERT_EQ(f->nDynamicsCalls, 2u);
+    ASSERT_EQ(f->nDerivativeStateCalls, 1u);
+    ASSERT_EQ(f->nDerivativeNoiseCalls, 2u);
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,188 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <ct/optcon/optcon.h>
+#include <gtest/gtest.h>
+
+using namespace ct::core;
+using namespace ct::optcon;
+
+const size_t state_dim = 4;
+const size_t control_dim = 1;
+const size_t output_dim = 2;
+
+//! a discrete linear system model with vectorized batch propagation
+class LinearSystemModel : public SystemModelBase<state_dim, control_dim>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    LinearSystemModel(const state_matrix_t& A, const StateControlMatrix<state_dim, control_dim>& B, const state_matrix_t& Q)
+        : A_(A), B_(B), Q_(Q)
+    {
+    }
+
+    state_vector_t computeDynamics(const state_vector_t& x, const control_vector_t& u, const Time_t dt, Time_t t) override
+    {
+        return A_ * x + B_ * u;
+    }
+
+    void computeDynamicsBatch(Eigen::Ref<state_batch_t> x, const control_vector_t& u, const Time_t dt, Time_t t) override
+    {
+        x = (A_ * x).colwise() + B_ * u;
+    }
+
+    state_matrix_t computeDerivativeState(const state_vector_t&, const control_vector_t&, const Time_t, Time_t) override
+    {
+        return A_;
+    }
+
+    state_matrix_t computeDerivativeNoise(const state_vector_t&, const control_vector_t&, const Time_t, Time_t) override
+    {
+        return Q_;
+    }
+
+    state_matrix_t A_;
+    StateControlMatrix<state_dim, control_dim> B_;
+    state_matrix_t Q_;
+};
+
+
+/*!
+ * For linear systems, the square-root UKF needs to reproduce the Kalman filter exactly, the UKF approximately
+ */
+TEST(UnscentedKalmanFilterTest, LinearSystemMatchesKalmanFilter)
+{
+    const double dt = 0.01;
+
+    StateMatrix<state_dim> A = StateMatrix<state_dim>::Identity();
+    A.topRightCorner<2, 2>() = dt * Eigen::Matrix2d::Identity();
+    A(2, 0) = -dt;
+    A(3, 1) = -0.5 * dt;
+    StateControlMatrix<state_dim, control_dim> B;
+    B << 0.0, 0.0, dt, dt;
+    StateMatrix<state_dim> Q = 1e-3 * StateMatrix<state_dim>::Identity();
+    OutputStateMatrix<output_dim, state_dim> C = OutputStateMatrix<output_dim, state_dim>::Zero();
+    C(0, 0) = 1.0;
+    C(1, 1) = 1.0;
+    OutputMatrix<output_dim> R = 1e-2 * OutputMatrix<output_dim>::Identity();
+
+    StateVector<state_dim> x0;
+    x0 << 1.0, -1.0, 0.5, 0.0;
+    StateMatrix<state_dim> P0 = 0.1 * StateMatrix<state_dim>::Identity();
+
+    std::shared_ptr<LinearSystemModel> f(new LinearSystemModel(A, B, Q));
+    std::shared_ptr<LTIMeasurementModel<output_dim, state_dim>> h(new LTIMeasurementModel<output_dim, state_dim>(C, R));
+
+    UnscentedKalmanFilter<state_dim, control_dim, output_dim> ukf(f, h, x0, 1.0, 2.0, 0.0, P0);
+    SquareRootUnscentedKalmanFilter<state_dim, control_dim, output_dim> srukf(f, h, x0, 1.0, 2.0, 0.0, P0);
+
+    StateVector<state_dim> x_kf = x0;
+    StateMatrix<state_dim> P_kf = P0;
+
+    GaussianNoise noise(0.0, 0.1, 1234);
+    ControlVector<control_dim> u;
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        u << std::sin(i * dt);
+
+        // reference Kalman filter
+        x_kf = A * x_kf + B * u;
+        P_kf = A * P_kf * A.transpose() + Q;
+
+        ukf.predict(u, dt, i * dt);
+        srukf.predict(u, dt, i * dt);
+
+        ASSERT_LT((ukf.getEstimate() - x_kf).norm(), 1e-2);
+        ASSERT_LT((srukf.getEstimate() - x_kf).norm(), 1e-9);
+        ASSERT_LT((srukf.getCovariance() - P_kf).norm(), 1e-9);
+
+        OutputVector<output_dim> z = C * x_kf + noise.gen<output_dim>();
+
+        Eigen::Matrix<double, state_dim, output_dim> K =
+            P_kf * C.transpose() * (C * P_kf * C.transpose() + R).inverse();
+        x_kf += K * (z - C * x_kf);
+        P_kf -= K * C * P_kf;
+
+        ukf.update(z, dt, i * dt);
+        srukf.update(z, dt, i * dt);
+
+        // the UKF re-uses the propagated sigma points for the update, which do not capture the process noise
+        ASSERT_LT((ukf.getEstimate() - x_kf).norm(), 1e-2);
+        ASSERT_LT((srukf.getEstimate() - x_kf).norm(), 1e-9);
+        ASSERT_LT((srukf.getCovariance() - P_kf).norm(), 1e-9);
+    }
+}
+
+
+/*!
+ * Parallel batch propagation with CTSystemModel needs to match serial propagation
+ */
+TEST(UnscentedKalmanFilterTest, ParallelSigmaPointPropagation)
+{
+    typedef CTSystemModel<2, 1> SystemModel_t;
+
+    std::shared_ptr<SecondOrderSystem> system(new SecondOrderSystem(5.0, 0.2));
+    SystemModel_t serial(system, nullptr, StateMatrix<2>::Identity(), IntegrationType::RK4);
+
+    std::shared_ptr<SecondOrderSystem> system2(new SecondOrderSystem(5.0, 0.2));
+    SystemModel_t parallel(system2, nullptr, StateMatrix<2>::Identity(), IntegrationType::RK4);
+    parallel.setNumThreads(3);
+
+    Eigen::Matrix<double, 2, Eigen::Dynamic> x_serial = Eigen::Matrix<double, 2, Eigen::Dynamic>::Random(2, 17);
+    Eigen::Matrix<double, 2, Eigen::Dynamic> x_parallel = x_serial;
+    ControlVector<1> u;
+    u << 0.3;
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        serial.computeDynamicsBatch(x_serial, u, 0.01, i * 0.01);
+        parallel.computeDynamicsBatch(x_parallel, u, 0.01, i * 0.01);
+    }
+
+    ASSERT_EQ(x_serial, x_parallel);
+}
+
+
+/*!
+ * Batch propagation with one control per group of states needs to match propagating the states one by one
+ */
+TEST(UnscentedKalmanFilterTest, ParallelPropagationPerControl)
+{
+    typedef CTSystemModel<2, 1> SystemModel_t;
+
+    std::shared_ptr<SecondOrderSystem> system(new SecondOrderSystem(5.0, 0.2));
+    SystemModel_t serial(system, nullptr, StateMatrix<2>::Identity(), IntegrationType::RK4);
+
+    std::shared_ptr<SecondOrderSystem> system2(new SecondOrderSystem(5.0, 0.2));
+    SystemModel_t parallel(system2, nullptr, StateMatrix<2>::Identity(), IntegrationType::RK4);
+    parallel.setNumThreads(3);
+
+    const size_t nGroups = 6, groupSize = 3;
+    Eigen::Matrix<double, 2, Eigen::Dynamic> x_single = Eigen::Matrix<double, 2, Eigen::Dynamic>::Random(2, 18);
+    Eigen::Matrix<double, 2, Eigen::Dynamic> x_serial = x_single;
+    Eigen::Matrix<double, 2, Eigen::Dynamic> x_parallel = x_single;
+    Eigen::Matrix<double, 1, Eigen::Dynamic> u = Eigen::Matrix<double, 1, Eigen::Dynamic>::Random(1, nGroups);
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        for (size_t k = 0; k < nGroups * groupSize; k++)
+            x_single.col(k) = serial.computeDynamics(x_single.col(k), u.col(k / groupSize), 0.01, i * 0.01);
+
+        serial.computeDynamicsBatchPerControl(x_serial, u, 0.01, i * 0.01);
+        parallel.computeDynamicsBatchPerControl(x_parallel, u, 0.01, i * 0.01);
+    }
+
+    ASSERT_EQ(x_single, x_serial);
+    ASSERT_EQ(x_single, x_parallel);
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
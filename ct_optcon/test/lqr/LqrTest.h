@@ -49,6 +49,173 @@ TEST(LQRTest, DARETest)
 }
 
 
+TEST(LQRTest, DAREDirectTest)
+{
+    const size_t stateDim = 4;
+    const size_t controlDim = 1;
+
+    typedef ct::optcon::DARE<stateDim, controlDim> DARE_t;
+
+    // two lightly damped oscillators, discretized with a small time step
+    const double dt = 0.01;
+    DARE_t::state_matrix_t A = DARE_t::state_matrix_t::Identity();
+    A(0, 1) = dt;
+    A(1, 0) = -4.0 * dt;
+    A(1, 1) = 1.0 - 0.001 * dt;
+    A(2, 3) = dt;
+    A(3, 2) = -25.0 * dt;
+    A(3, 3) = 1.0 - 0.001 * dt;
+    DARE_t::control_gain_matrix_t B;
+    B << 0.0, dt, 0.0, dt;
+    DARE_t::state_matrix_t Q = DARE_t::state_matrix_t::Identity();
+    DARE_t::control_matrix_t R = DARE_t::control_matrix_t::Identity();
+
+    DARE_t dare;
+    DARE_t::control_feedback_t K_iterative, K_direct;
+    DARE_t::state_matrix_t P_iterative =
+        dare.computeSteadyStateRiccatiMatrix(Q, R, A, B, K_iterative, false, 1e-12, 1000000);
+    DARE_t::state_matrix_t P_direct = dare.computeSteadyStateRiccatiMatrixDirect(Q, R, A, B, K_direct);
+
+    // the robust iteration regularizes R + B^T P B slightly, hence only approximate agreement
+    const double scale = P_iterative.norm();
+    ASSERT_LT((P_direct - P_iterative).norm() / scale, 1e-4);
+    ASSERT_LT((K_direct - K_iterative).norm() / K_iterative.norm(), 1e-4);
+
+    // the riccati equation residual
+    auto residual = [&](const DARE_t::state_matrix_t& P) {
+        const DARE_t::control_matrix_t H = R + B.transpose() * P * B;
+        DARE_t::state_matrix_t res =
+            A.transpose() * P * A - P + Q - A.transpose() * P * B * H.inverse() * B.transpose() * P * A;
+        return res.norm() / scale;
+    };
+
+    ASSERT_LT(residual(P_direct), 1e-9);
+
+    DARE_t::state_matrix_t P_doubling;
+    ASSERT_TRUE(dare.solveDoubling(Q, R, A, B, P_doubling));
+    ASSERT_LT(residual(P_doubling), 1e-9);
+
+#ifdef CT_USE_LAPACK
+    DARE_t::state_matrix_t P_schur;
+    ASSERT_TRUE(dare.solveSchurDirect(Q, R, A, B, P_schur));
+    ASSERT_LT(residual(P_schur), 1e-9);
+    ASSERT_LT((P_schur - P_doubling).norm() / scale, 1e-9);
+#endif
+}
+
+
+//! pendulum linearized about an arbitrary angle
+class LinearizedPendulum : public ct::core::LinearSystem<2, 1>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    LinearizedPendulum* clone() const override { return new LinearizedPendulum(*this); }
+    const state_matrix_t& getDerivativeState(const state_vector_t& x,
+        const control_vector_t& u,
+        const double t) override
+    {
+        A_ << 0.0, 1.0, -9.81 * std::cos(x(0)), -0.1;
+        return A_;
+    }
+
+    const state_control_matrix_t& getDerivativeControl(const state_vector_t& x,
+        const control_vector_t& u,
+        const double t) override
+    {
+        B_ << 0.0, 1.0;
+        return B_;
+    }
+
+private:
+    state_matrix_t A_;
+    state_control_matrix_t B_;
+};
+
+
+TEST(LQRTest, GainScheduledLQRTest)
+{
+    typedef ct::optcon::GainScheduledLQR<2, 1> GainScheduledLQR_t;
+
+    GainScheduledLQR_t::Axes axes;
+    for (size_t i = 0; i < 31; i++)
+        axes[0].push_back(-M_PI + i * M_PI / 15.0);
+
+    // operating points along the pendulum angle
+    auto operatingPoint = [](const GainScheduledLQR_t::schedule_vector_t& s, ct::core::StateVector<2>& x,
+        ct::core::ControlVector<1>& u) {
+        x << s(0), 0.0;
+        u << 9.81 * std::sin(s(0));
+    };
+
+    Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+    Eigen::Matrix<double, 1, 1> R = Eigen::Matrix<double, 1, 1>::Identity();
+
+    LinearizedPendulum system;
+
+    // lookups in a table without gains must not read out of bounds
+    Eigen::Matrix<double, 1, 2> K_empty;
+    GainScheduledLQR_t empty;
+    ASSERT_FALSE(empty.hasGains());
+    ASSERT_THROW(empty.getGain(GainScheduledLQR_t::schedule_vector_t::Zero(), K_empty), std::runtime_error);
+    ASSERT_THROW(empty.getGridGain(0), std::runtime_error);
+    ASSERT_THROW(empty.save("GainScheduledLQRTestEmpty.bin"), std::runtime_error);
+
+    GainScheduledLQR_t serial(axes);
+    GainScheduledLQR_t parallel(axes);
+    ASSERT_THROW(serial.getGain(GainScheduledLQR_t::schedule_vector_t::Zero(), K_empty), std::runtime_error);
+    ASSERT_TRUE(serial.compute(system, operatingPoint, Q, R, 1));
+    ASSERT_TRUE(parallel.compute(system, operatingPoint, Q, R, 4));
+
+    ct::optcon::LQR<2, 1> lqr;
+    for (size_t i = 0; i < serial.getNumGridPoints(); i++)
+    {
+        ASSERT_EQ(serial.getGridGain(i), parallel.getGridGain(i));
+
+        // gains at the grid points equal the ones of a direct LQR design
+        GainScheduledLQR_t::schedule_vector_t s;
+        s << axes[0][i];
+        ct::core::StateVector<2> x;
+        ct::core::ControlVector<1> u;
+        operatingPoint(s, x, u);
+
+        Eigen::Matrix<double, 1, 2> K_lqr, K_table;
+        lqr.compute(Q, R, system.getDerivativeState(x, u, 0.0), system.getDerivativeControl(x, u, 0.0), K_lqr);
+        serial.getGain(s, K_table);
+        ASSERT_LT((K_lqr - K_table).norm(), 1e-12);
+
+        // linear interpolation in between
+        if (i + 1 < serial.getNumGridPoints())
+        {
+            s << 0.25 * axes[0][i] + 0.75 * axes[0][i + 1];
+            serial.getGain(s, K_table);
+            ASSERT_LT((K_table - 0.25 * serial.getGridGain(i) - 0.75 * serial.getGridGain(i + 1)).norm(), 1e-12);
+        }
+    }
+
+    // clamping outside of the grid
+    Eigen::Matrix<double, 1, 2> K_table;
+    serial.getGain(GainScheduledLQR_t::schedule_vector_t::Constant(10.0), K_table);
+    ASSERT_EQ(K_table, serial.getGridGain(serial.getNumGridPoints() - 1));
+
+    // round trip through a file
+    const std::string filename = "GainScheduledLQRTest.bin";
+    serial.save(filename);
+    GainScheduledLQR_t loaded;
+    loaded.load(filename);
+    ASSERT_TRUE(loaded.hasGains());
+    ASSERT_EQ(loaded.getNumGridPoints(), serial.getNumGridPoints());
+    for (size_t i = 0; i < serial.getNumGridPoints(); i++)
+        ASSERT_EQ(serial.getGridGain(i), loaded.getGridGain(i));
+    ASSERT_THROW(loaded.getGridGain(loaded.getNumGridPoints()), std::runtime_error);
+    std::remove(filename.c_str());
+
+    // a new grid invalidates the gains
+    loaded.setAxes(axes);
+    ASSERT_FALSE(loaded.hasGains());
+}
+
+
 TEST(LQRTest, quadTest)
 {
     //	std::cout << "QUADROTOR TEST"<<std::endl;
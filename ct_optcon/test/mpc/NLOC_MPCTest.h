@@ -9,6 +9,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #pragma once
 
 #include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 
 #include "mpcTestSettings.h"
@@ -350,6 +351,115 @@ TEST(MPCTestB, NLOC_MPC_DoublePrecision)
 }
 
 
+/**
+ * Runs an MpcRunner for a few policies, with the solver thread restricted to solverCores
+ */
+void runMpcRunner(const std::vector<int>& solverCores)
+{
+    typedef tpl::LinearOscillator<double> LinearOscillator;
+    typedef tpl::LinearOscillatorLinear<double> LinearOscillatorLinear;
+    typedef NLOptConSolver<state_dim, control_dim> Solver_t;
+
+    Eigen::Vector2d x_final;
+    x_final << 20, 0;
+    StateVector<state_dim> x0;
+    x0.setZero();
+    ct::core::Time timeHorizon = 3.0;
+
+    shared_ptr<ControlledSystem<state_dim, control_dim>> system(new LinearOscillator);
+    shared_ptr<LinearSystem<state_dim, control_dim>> analyticLinearSystem(new LinearOscillatorLinear);
+    shared_ptr<CostFunctionQuadratic<state_dim, control_dim>> costFunction =
+        tpl::createCostFunctionLinearOscillator<double>(x_final);
+
+    ContinuousOptConProblem<state_dim, control_dim> optConProblem(system, costFunction, analyticLinearSystem);
+    optConProblem.setTimeHorizon(timeHorizon);
+    optConProblem.setInitialState(x0);
+
+    NLOptConSettings nloc_settings;
+    nloc_settings.dt = 0.01;
+    nloc_settings.max_iterations = 1;
+    nloc_settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+    nloc_settings.lqocp_solver = NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER;
+    nloc_settings.integrator = ct::core::IntegrationType::EULER;
+    nloc_settings.printSummary = false;
+
+    size_t K = nloc_settings.computeK(timeHorizon);
+    FeedbackArray<state_dim, control_dim> u0_fb(K, FeedbackMatrix<state_dim, control_dim>::Zero());
+    ControlVectorArray<control_dim> u0_ff(K, ControlVector<control_dim>::Zero());
+    StateVectorArray<state_dim> x_ref(K + 1, x0);
+    ct::core::StateFeedbackController<state_dim, control_dim> initController(x_ref, u0_ff, u0_fb, nloc_settings.dt);
+
+    ct::optcon::mpc_settings settings;
+    settings.stateForwardIntegration_ = false;
+    settings.postTruncation_ = false;
+    settings.useExternalTiming_ = true;
+    settings.mpc_mode = ct::optcon::MPC_MODE::FIXED_FINAL_TIME;
+
+    std::shared_ptr<MPC<Solver_t>> mpc(new MPC<Solver_t>(optConProblem, nloc_settings, settings));
+    mpc->setInitialGuess(initController);
+
+    MpcRunner<Solver_t> runner(mpc);
+    if (!solverCores.empty())
+        runner.setSolverThreadAffinity(solverCores);
+
+    ControlVector<control_dim> u;
+    ASSERT_FALSE(runner.computeControl(x0, 0.0, u));
+
+    runner.start();
+
+    // emulate a control loop, which runs with fake time until enough policies were received
+    size_t nPolicies = 0;
+    double t = 0.0;
+    for (size_t i = 0; i < 20000 && nPolicies < 5 && runner.isRunning(); i++)
+    {
+        runner.setState(x0, t);
+        if (runner.updatePolicy())
+        {
+            nPolicies++;
+            ASSERT_LE(runner.getPolicyTimestamp(), t);
+        }
+        if (runner.hasPolicy())
+            ASSERT_TRUE(runner.computeControl(x0, t, u));
+
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        t += 1e-3;
+    }
+
+    runner.stop();
+
+    ASSERT_FALSE(runner.isRunning());
+    ASSERT_GT(nPolicies, 0u);
+    ASSERT_GE(runner.getNumIterations(), nPolicies);
+    ASSERT_TRUE(runner.hasPolicy());
+}
+
+/**
+ * Test the wait-free policy exchange between a solver thread and a control thread
+ */
+TEST(MPCTestC, MpcRunnerTest)
+{
+    runMpcRunner(std::vector<int>());
+}
+
+/**
+ * Pinning the solver thread must neither break the policy exchange nor touch the affinity of the control thread
+ */
+TEST(MPCTestC, MpcRunnerAffinityTest)
+{
+#ifdef __linux__
+    cpu_set_t before, after;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &before), 0);
+#endif
+
+    runMpcRunner(std::vector<int>(1, 0));
+
+#ifdef __linux__
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &after), 0);
+    ASSERT_TRUE(CPU_EQUAL(&before, &after));
+#endif
+}
+
+
 }  // namespace example
 }  // namespace optcon
 }  // namespace ct
@@ -0,0 +1,51 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+ **********************************************************************************************************************/
+
+#include <thread>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include <ct/optcon/mpc/TripleBuffer.h>
+
+using namespace ct::optcon;
+
+/**
+ * The triple buffer needs to deliver the latest published value, in order and without tearing
+ */
+TEST(TripleBufferTest, ProducerConsumerTest)
+{
+    TripleBuffer<std::pair<int, int>> buffer;
+    ASSERT_FALSE(buffer.update());
+
+    const int nPublished = 100000;
+    std::thread producer([&]() {
+        for (int i = 1; i <= nPublished; i++)
+        {
+            buffer.back() = std::make_pair(i, -i);
+            buffer.publish();
+        }
+    });
+
+    int lastReceived = 0;
+    while (lastReceived < nPublished)
+    {
+        if (buffer.update())
+        {
+            ASSERT_GT(buffer.front().first, lastReceived);
+            ASSERT_EQ(buffer.front().first, -buffer.front().second);
+            ASSERT_EQ(static_cast<int>(buffer.frontSequence()), buffer.front().first);
+            lastReceived = buffer.front().first;
+        }
+    }
+    producer.join();
+    ASSERT_FALSE(buffer.update());
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
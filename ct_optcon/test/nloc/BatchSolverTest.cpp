@@ -0,0 +1,154 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ct/optcon/optcon.h>
+
+#include "../testSystems/LinearOscillator.h"
+
+using namespace ct::core;
+using namespace ct::optcon;
+using namespace ct::optcon::example;
+
+typedef NLOptConSolver<state_dim, control_dim> NLOptConSolver_t;
+typedef BatchNLOptConSolver<state_dim, control_dim> BatchSolver_t;
+
+TEST(BatchSolverTest, BatchSolverTest)
+{
+    const size_t nProblems = 10;
+
+    NLOptConSettings settings;
+    settings.dt = 0.01;
+    settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+    settings.lqocp_solver = NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER;
+    settings.nlocp_algorithm = NLOptConSettings::NLOCP_ALGORITHM::GNMS;
+    settings.recordSmallestEigenvalue = false;
+    settings.printSummary = false;
+    settings.max_iterations = 5;
+
+    // every problem has its own initial state, the odd ones also have a different final state
+    StateVectorArray<state_dim> initialStates(nProblems);
+    for (size_t i = 0; i < nProblems; i++)
+        initialStates[i] << 0.1 * i, 1.0 - 0.2 * i;
+
+    Eigen::Vector2d x_final_0(20.0, 0.0), x_final_1(-5.0, 1.0);
+    std::vector<std::shared_ptr<CostFunctionQuadratic<state_dim, control_dim>>> costFunctions(2);
+    costFunctions[0] = example::tpl::createCostFunctionLinearOscillator<double>(x_final_0);
+    costFunctions[1] = example::tpl::createCostFunctionLinearOscillator<double>(x_final_1);
+
+    std::shared_ptr<ControlledSystem<state_dim, control_dim>> system(new LinearOscillator());
+    std::shared_ptr<LinearSystem<state_dim, control_dim>> linearSystem(new LinearOscillatorLinear());
+
+    const double tf = 1.0;
+    const size_t K = settings.computeK(tf);
+    ContinuousOptConProblem<state_dim, control_dim> optConProblem(
+        tf, initialStates[0], system, costFunctions[0], linearSystem);
+
+    NLOptConSolver_t::Policy_t initialGuess(StateVectorArray<state_dim>(K + 1, initialStates[0]),
+        ControlVectorArray<control_dim>(K, ControlVector<control_dim>::Zero()),
+        FeedbackArray<state_dim, control_dim>(K, FeedbackMatrix<state_dim, control_dim>::Zero()), settings.dt);
+
+    auto setup = [&](size_t problemId, NLOptConSolver_t& solver) {
+        solver.changeCostFunction(costFunctions[problemId % 2]);
+    };
+
+    // reference: every problem solved by its own solver
+    std::vector<StateVectorArray<state_dim>> x_ref(nProblems);
+    std::vector<double> costs_ref(nProblems);
+    for (size_t i = 0; i < nProblems; i++)
+    {
+        NLOptConSolver_t solver(optConProblem, settings);
+        setup(i, solver);
+        solver.setInitialGuess(initialGuess);
+        solver.changeInitialState(initialStates[i]);
+        solver.solve();
+        x_ref[i] = solver.getSolution().x_ref();
+        costs_ref[i] = solver.getCost();
+    }
+
+    // the result must not depend on the number of threads, nor on which thread solved which problem before
+    for (size_t nThreads = 1; nThreads < 5; nThreads += 3)
+    {
+        BatchSolver_t batchSolver(optConProblem, settings, nThreads);
+        ASSERT_EQ(batchSolver.getNumThreads(), nThreads);
+
+        for (size_t run = 0; run < 2; run++)
+        {
+            batchSolver.solve(initialStates, initialGuess, setup);
+
+            ASSERT_EQ(batchSolver.getSolutions().size(), nProblems);
+            ASSERT_EQ(batchSolver.getCosts().size(), nProblems);
+            for (size_t i = 0; i < nProblems; i++)
+            {
+                const StateVectorArray<state_dim>& x = batchSolver.getSolutions()[i].x_ref();
+                ASSERT_EQ(x.size(), x_ref[i].size());
+                ASSERT_TRUE(x.front().isApprox(initialStates[i]));
+                for (size_t k = 0; k < x.size(); k++)
+                    ASSERT_TRUE(x[k].isApprox(x_ref[i][k], 1e-8));
+                ASSERT_NEAR(batchSolver.getCosts()[i], costs_ref[i], 1e-8 * std::abs(costs_ref[i]));
+            }
+        }
+
+        // the same problems, defined by their initial guesses
+        BatchSolver_t::PolicyArray_t initialGuesses(nProblems, initialGuess);
+        for (size_t i = 0; i < nProblems; i++)
+            initialGuesses[i].getReferenceStateTrajectory()[0] = initialStates[i];
+        batchSolver.solve(initialGuesses, setup);
+        for (size_t i = 0; i < nProblems; i++)
+            ASSERT_NEAR(batchSolver.getCosts()[i], costs_ref[i], 1e-8 * std::abs(costs_ref[i]));
+    }
+
+    // pinning the pool must not change the affinity of the calling thread, which solves problems as well
+    settings.workerCores = std::vector<int>(1, 0);
+    BatchSolver_t pinnedSolver(optConProblem, settings, 4);
+#ifdef __linux__
+    cpu_set_t before, after;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &before), 0);
+#endif
+    pinnedSolver.solve(initialStates, initialGuess, setup);
+#ifdef __linux__
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &after), 0);
+    ASSERT_TRUE(CPU_EQUAL(&before, &after));
+#endif
+    for (size_t i = 0; i < nProblems; i++)
+        ASSERT_NEAR(pinnedSolver.getCosts()[i], costs_ref[i], 1e-8 * std::abs(costs_ref[i]));
+
+    // a failing problem is recorded, the other problems of the batch are solved regardless
+    const size_t failingId = 3;
+    auto failingSetup = [&](size_t problemId, NLOptConSolver_t& solver) {
+        if (problemId == failingId)
+            throw std::runtime_error("setup failed");
+        setup(problemId, solver);
+    };
+    BatchSolver_t failingSolver(optConProblem, settings, 2);
+    failingSolver.solve(initialStates, initialGuess, setup);
+    failingSolver.solve(initialStates, initialGuess, failingSetup);
+    ASSERT_EQ(failingSolver.getStatus().size(), nProblems);
+    ASSERT_EQ(failingSolver.getErrors().size(), nProblems);
+    for (size_t i = 0; i < nProblems; i++)
+    {
+        if (i == failingId)
+        {
+            ASSERT_EQ(failingSolver.getStatus()[i], BatchSolver_t::FAILED);
+            ASSERT_EQ(failingSolver.getErrors()[i], "setup failed");
+            ASSERT_TRUE(std::isnan(failingSolver.getCosts()[i]));
+            ASSERT_EQ(failingSolver.getSolutions()[i].x_ref().size(), 0);
+        }
+        else
+        {
+            ASSERT_NE(failingSolver.getStatus()[i], BatchSolver_t::FAILED);
+            ASSERT_TRUE(failingSolver.getErrors()[i].empty());
+            ASSERT_NEAR(failingSolver.getCosts()[i], costs_ref[i], 1e-8 * std::abs(costs_ref[i]));
+        }
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
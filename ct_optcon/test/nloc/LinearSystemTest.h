@@ -171,6 +171,77 @@ TEST(LinearSystemsTest, NLOCSolverTest)
 }  // end TEST
 
 
+/*!
+ * Pinned workers with worker-local instances have to give the same result as the default placement. After the system
+ * got changed, every worker re-creates its own instance before its next task.
+ */
+TEST(LinearSystemsTest, NLOCWorkerLocalInstancesTest)
+{
+    typedef NLOptConSolver<state_dim, control_dim, state_dim / 2, state_dim / 2> NLOptConSolver;
+
+    Eigen::Vector2d x_final;
+    x_final << 20, 0;
+    StateVector<state_dim> initState;
+    initState.setZero();
+    initState(1) = 1.0;
+
+    NLOptConSettings nloc_settings;
+    nloc_settings.nlocp_algorithm = NLOptConSettings::NLOCP_ALGORITHM::GNMS;
+    nloc_settings.dt = 0.01;
+    nloc_settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+    nloc_settings.lqocp_solver = NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER;
+    nloc_settings.integrator = ct::core::IntegrationType::EULERCT;
+    nloc_settings.printSummary = false;
+    nloc_settings.nThreads = 3;
+
+    ct::core::Time tf = 1.0;
+    size_t nSteps = nloc_settings.computeK(tf);
+    StateVectorArray<state_dim> x0(nSteps + 1, initState);
+    ControlVector<control_dim> uff;
+    uff << kStiffness * initState(0);
+    ControlVectorArray<control_dim> u0(nSteps, uff);
+    FeedbackArray<state_dim, control_dim> u0_fb(nSteps, FeedbackMatrix<state_dim, control_dim>::Zero());
+    NLOptConSolver::Policy_t initController(x0, u0, u0_fb, nloc_settings.dt);
+
+    ContinuousOptConProblem<state_dim, control_dim> optConProblem(tf, x0[0],
+        shared_ptr<ControlledSystem<state_dim, control_dim>>(new LinearOscillator()),
+        tpl::createCostFunctionLinearOscillator<double>(x_final),
+        shared_ptr<LinearSystem<state_dim, control_dim>>(new LinearOscillatorLinear()));
+
+    NLOptConSolver reference(optConProblem, nloc_settings);
+    reference.setInitialGuess(initController);
+    reference.runIteration();
+
+    // all workers are pinned to core 0, which always exists
+    nloc_settings.workerCores = std::vector<int>(1, 0);
+    nloc_settings.workerLocalInstances = true;
+    NLOptConSolver solver(optConProblem, nloc_settings);
+    solver.setInitialGuess(initController);
+    solver.runIteration();
+
+    for (size_t k = 0; k < nSteps + 1; k++)
+        ASSERT_LT((solver.getSolution().x_ref()[k] - reference.getSolution().x_ref()[k]).norm(), 1e-12);
+
+    // the new system is cloned by the calling thread first, the workers replace their clones in the next iteration
+    solver.changeNonlinearSystem(shared_ptr<ControlledSystem<state_dim, control_dim>>(new LinearOscillator()));
+    const std::vector<shared_ptr<ControlledSystem<state_dim, control_dim>>> changed =
+        solver.getNonlinearSystemsInstances();
+
+    solver.runIteration();
+    reference.runIteration();
+
+    const std::vector<shared_ptr<ControlledSystem<state_dim, control_dim>>>& instances =
+        solver.getNonlinearSystemsInstances();
+    ASSERT_EQ(instances.size(), changed.size());
+    for (int i = 0; i < nloc_settings.nThreads; i++)
+        ASSERT_NE(instances[i], changed[i]);
+    ASSERT_EQ(instances.back(), changed.back());
+
+    for (size_t k = 0; k < nSteps + 1; k++)
+        ASSERT_LT((solver.getSolution().x_ref()[k] - reference.getSolution().x_ref()[k]).norm(), 1e-12);
+}
+
+
 }  // namespace example
 }  // namespace optcon
 }  // namespace ct
@@ -0,0 +1,185 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ct/optcon/optcon.h>
+
+#include "../testSystems/LinearOscillator.h"
+
+using namespace ct::core;
+using namespace ct::optcon;
+using namespace ct::optcon::example;
+
+/*!
+ * Solves the linear oscillator problem with the NLOC solver in SCALAR precision and returns the state trajectory
+ */
+template <typename SCALAR>
+StateVectorArray<state_dim, SCALAR> solveLinearOscillator(NLOptConSettings settings,
+    const SCALAR finalWeight = SCALAR(1000),
+    const SCALAR controlWeight = SCALAR(100))
+{
+    typedef NLOptConSolver<state_dim, control_dim, state_dim / 2, state_dim / 2, SCALAR> NLOptConSolver_t;
+
+    settings.dt = 0.01;
+    settings.discretization = NLOptConSettings::APPROXIMATION::FORWARD_EULER;
+    settings.lqocp_solver = NLOptConSettings::LQOCP_SOLVER::GNRICCATI_SOLVER;
+    settings.recordSmallestEigenvalue = false;
+    settings.printSummary = false;
+
+    Eigen::Matrix<SCALAR, state_dim, 1> x_final;
+    x_final << 20, 0;
+    StateVector<state_dim, SCALAR> initState;
+    initState << 0, 1;
+
+    std::shared_ptr<ControlledSystem<state_dim, control_dim, SCALAR>> system(
+        new example::tpl::LinearOscillator<SCALAR>());
+    std::shared_ptr<LinearSystem<state_dim, control_dim, SCALAR>> linearSystem(
+        new example::tpl::LinearOscillatorLinear<SCALAR>());
+    auto costFunction = example::tpl::createCostFunctionLinearOscillator<SCALAR>(x_final, finalWeight, controlWeight);
+
+    const SCALAR tf = 1.0;
+    const size_t K = settings.computeK(tf);
+    StateVectorArray<state_dim, SCALAR> x0(K + 1, initState);
+    ControlVectorArray<control_dim, SCALAR> u0(K, ControlVector<control_dim, SCALAR>::Zero());
+    FeedbackArray<state_dim, control_dim, SCALAR> u0_fb(K, FeedbackMatrix<state_dim, control_dim, SCALAR>::Zero());
+    typename NLOptConSolver_t::Policy_t initController(x0, u0, u0_fb, SCALAR(settings.dt));
+
+    ContinuousOptConProblem<state_dim, control_dim, SCALAR> optConProblem(
+        tf, initState, system, costFunction, linearSystem);
+    NLOptConSolver_t solver(optConProblem, settings);
+    solver.setInitialGuess(initController);
+
+    // the problem is linear-quadratic, two iterations are sufficient
+    solver.runIteration();
+    solver.runIteration();
+
+    return solver.getSolution().x_ref();
+}
+
+/*!
+ * Compares the single and mixed precision solutions to the double precision solution for the given cost weights
+ */
+void compareToDoublePrecision(const double finalWeight,
+    const double controlWeight,
+    const double floatTolerance,
+    const double mixedTolerance)
+{
+    NLOptConSettings settings;
+    for (int algClass = 0; algClass < NLOptConSettings::NLOCP_ALGORITHM::NUM_TYPES; algClass++)
+    {
+        settings.nlocp_algorithm = static_cast<NLOptConSettings::NLOCP_ALGORITHM>(algClass);
+
+        // single-threaded backend, solving the LQ problem at once, and multi-threaded backend, solving stage-wise
+        for (size_t nThreads = 1; nThreads < 5; nThreads += 3)
+        {
+            settings.nThreads = nThreads;
+
+            settings.doublePrecisionRiccati = false;
+            const StateVectorArray<state_dim> x_double =
+                solveLinearOscillator<double>(settings, finalWeight, controlWeight);
+            const StateVectorArray<state_dim, float> x_float =
+                solveLinearOscillator<float>(settings, finalWeight, controlWeight);
+            settings.doublePrecisionRiccati = true;
+            const StateVectorArray<state_dim, float> x_mixed =
+                solveLinearOscillator<float>(settings, finalWeight, controlWeight);
+
+            ASSERT_EQ(x_double.size(), x_float.size());
+            ASSERT_EQ(x_double.size(), x_mixed.size());
+            for (size_t k = 0; k < x_double.size(); k++)
+            {
+                ASSERT_TRUE(x_float[k].cast<double>().isApprox(x_double[k], floatTolerance));
+                ASSERT_TRUE(x_mixed[k].cast<double>().isApprox(x_double[k], mixedTolerance));
+            }
+        }
+    }
+}
+
+TEST(MixedPrecisionTest, SinglePrecisionNLOC)
+{
+    // the mixed precision solution only carries the rounding of the single precision inputs and outputs
+    compareToDoublePrecision(1000.0, 100.0, 1e-3, 1e-5);
+}
+
+TEST(MixedPrecisionTest, IllConditionedSinglePrecisionNLOC)
+{
+    // a stiff final cost and a cheap control make the Riccati recursion ill-conditioned, the single precision
+    // recursion then loses several digits while the mixed precision error stems from the single precision rollout
+    compareToDoublePrecision(1e6, 1e-2, 5e-2, 1e-4);
+}
+
+TEST(MixedPrecisionTest, MixedPrecisionRiccatiSolver)
+{
+    const size_t N = 50;
+    const double dt = 0.01;
+
+    // the same LQ problem in double and single precision
+    std::shared_ptr<LinearSystem<state_dim, control_dim>> system(new LinearOscillatorLinear());
+    SensitivityApproximation<state_dim, control_dim> discreteSystem(
+        dt, system, SensitivityApproximationSettings::APPROXIMATION::MATRIX_EXPONENTIAL);
+    Eigen::Vector2d x_final;
+    x_final << 20, 0;
+    auto costFunction = example::tpl::createCostFunctionLinearOscillator<double>(x_final);
+    StateVector<state_dim> b = StateVector<state_dim>::Constant(0.1);
+
+    std::shared_ptr<LQOCProblem<state_dim, control_dim>> problemDouble(new LQOCProblem<state_dim, control_dim>(N));
+    problemDouble->setFromTimeInvariantLinearQuadraticProblem(discreteSystem, *costFunction, b, dt);
+
+    std::shared_ptr<LQOCProblem<state_dim, control_dim, float>> problemFloat(
+        new LQOCProblem<state_dim, control_dim, float>(N));
+    for (size_t k = 0; k < N; k++)
+    {
+        problemFloat->A_[k] = problemDouble->A_[k].cast<float>();
+        problemFloat->B_[k] = problemDouble->B_[k].cast<float>();
+        problemFloat->b_[k] = problemDouble->b_[k].cast<float>();
+        problemFloat->qv_[k] = problemDouble->qv_[k].cast<float>();
+        problemFloat->Q_[k] = problemDouble->Q_[k].cast<float>();
+        problemFloat->P_[k] = problemDouble->P_[k].cast<float>();
+        problemFloat->rv_[k] = problemDouble->rv_[k].cast<float>();
+        problemFloat->R_[k] = problemDouble->R_[k].cast<float>();
+        problemFloat->q_[k] = static_cast<float>(problemDouble->q_[k]);
+    }
+    problemFloat->qv_[N] = problemDouble->qv_[N].cast<float>();
+    problemFloat->Q_[N] = problemDouble->Q_[N].cast<float>();
+    problemFloat->q_[N] = static_cast<float>(problemDouble->q_[N]);
+
+    GNRiccatiSolver<state_dim, control_dim> riccatiDouble;
+    MixedPrecisionRiccatiSolver<state_dim, control_dim, float> riccatiMixed;
+    riccatiDouble.setProblem(problemDouble);
+    riccatiMixed.setProblem(problemFloat);
+
+    riccatiMixed.initializeAndAllocate();
+    riccatiMixed.solve();
+    riccatiMixed.computeStatesAndControls();
+    riccatiMixed.computeFeedbackMatrices();
+    riccatiMixed.compute_lv();
+    riccatiDouble.initializeAndAllocate();
+    riccatiDouble.solve();
+    riccatiDouble.computeStatesAndControls();
+    riccatiDouble.computeFeedbackMatrices();
+    riccatiDouble.compute_lv();
+
+    // the recursion runs in double precision, only the conversion of the inputs and outputs is rounded
+    for (size_t k = 0; k < N; k++)
+    {
+        ASSERT_TRUE(riccatiMixed.getSolutionState()[k].cast<double>().isApprox(
+            riccatiDouble.getSolutionState()[k], 1e-5));
+        ASSERT_TRUE(riccatiMixed.getSolutionControl()[k].cast<double>().isApprox(
+            riccatiDouble.getSolutionControl()[k], 1e-5));
+        ASSERT_TRUE(riccatiMixed.getSolutionFeedback()[k].cast<double>().isApprox(
+            riccatiDouble.getSolutionFeedback()[k], 1e-5));
+    }
+
+    // constrained problems are not supported
+    problemFloat->nbu_[0] = 1;
+    ASSERT_ANY_THROW(riccatiMixed.setProblem(problemFloat));
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
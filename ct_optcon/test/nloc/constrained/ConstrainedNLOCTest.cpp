@@ -131,6 +131,45 @@ public:
 };
 
 
+//! bounds the control input, repeated a number of times which may be changed after the constraint was set up
+class RepeatedInputGenConstraint : public ct::optcon::ConstraintBase<state_dim, control_dim>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    typedef ct::optcon::ConstraintBase<state_dim, control_dim> Base;
+    typedef ct::core::StateVector<state_dim> state_vector_t;
+    typedef ct::core::ControlVector<control_dim> control_vector_t;
+
+    //! constructor, the number of repetitions is shared with all clones
+    RepeatedInputGenConstraint(const std::shared_ptr<size_t>& repetitions) : repetitions_(repetitions)
+    {
+        Base::lb_.setConstant(*repetitions_, -0.5);
+        Base::ub_.setConstant(*repetitions_, 0.5);
+    }
+
+    virtual ~RepeatedInputGenConstraint() {}
+    virtual RepeatedInputGenConstraint* clone() const override { return new RepeatedInputGenConstraint(repetitions_); }
+    virtual size_t getConstraintSize() const override { return *repetitions_; }
+    virtual Eigen::VectorXd evaluate(const state_vector_t& x, const control_vector_t& u, const double t) override
+    {
+        return Eigen::VectorXd::Constant(*repetitions_, u(0));
+    }
+
+    virtual Eigen::MatrixXd jacobianState(const state_vector_t& x, const control_vector_t& u, const double t) override
+    {
+        return Eigen::MatrixXd::Zero(*repetitions_, state_dim);
+    }
+
+    virtual Eigen::MatrixXd jacobianInput(const state_vector_t& x, const control_vector_t& u, const double t) override
+    {
+        return Eigen::MatrixXd::Ones(*repetitions_, control_dim);
+    }
+
+private:
+    std::shared_ptr<size_t> repetitions_;
+};
+
+
 // convenience function for generating an NLOC solver
 NLOptConSolver<state_dim, control_dim> generateSolver(ContinuousOptConProblem<state_dim, control_dim> ocp)
 {
@@ -296,6 +335,30 @@ TEST(Constrained_NLOC_Test, comparePureStateConstraints)
 }
 
 
+/*
+ * The constraint containers of the LQ problem are reserved when the general constraints are set. A larger number of
+ * constraints during the solve is reported instead of growing the containers, which are shared between the threads.
+ */
+TEST(Constrained_NLOC_Test, throwsIfGeneralConstraintsExceedCapacity)
+{
+    std::shared_ptr<size_t> repetitions(new size_t(1));
+    std::shared_ptr<RepeatedInputGenConstraint> pathConstraintTerm(new RepeatedInputGenConstraint(repetitions));
+
+    std::shared_ptr<ConstraintContainerAnalytical<state_dim, control_dim>> generalConstraints(
+        new ct::optcon::ConstraintContainerAnalytical<state_dim, control_dim>());
+    generalConstraints->addIntermediateConstraint(pathConstraintTerm, verbose);
+    generalConstraints->initialize();
+
+    auto optConProblem = generateUnconstrainedOCP();
+    optConProblem.setGeneralConstraints(generalConstraints);
+
+    auto nloc = generateSolver(optConProblem);
+    *repetitions = 2;
+
+    ASSERT_THROW(nloc.solve(), std::runtime_error);
+}
+
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
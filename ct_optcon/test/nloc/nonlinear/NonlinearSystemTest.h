@@ -4,6 +4,8 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
  **********************************************************************************************************************/
 
 #include <chrono>
+#include <cstdio>
+#include <map>
 #include <fenv.h>
 
 #include <gtest/gtest.h>
@@ -116,6 +118,165 @@ TEST(NLOCTest, NonlinearSystemAlgorithmComparison)
         ASSERT_NEAR(uRollout_gnms[i](0), uRollout_ilqr[i](0), 1e-4);
     }
 }
+
+TEST(NLOCTest, TimeBudget)
+{
+    typedef NLOptConSolver<state_dim, control_dim, 1, 0> NLOptConSolver;
+
+    std::string configFile = std::string(NLOC_TEST_DIR) + "/nonlinear/solver.info";
+    std::string costFunctionFile = std::string(NLOC_TEST_DIR) + "/nonlinear/cost.info";
+
+    Eigen::Matrix<double, 1, 1> x_0;
+    ct::core::loadMatrix(costFunctionFile, "x_0", x_0);
+
+    NLOptConSettings settings;
+    settings.load(configFile, true, "gnms");
+    settings.printSummary = false;
+
+    std::shared_ptr<ControlledSystem<state_dim, control_dim>> nonlinearSystem(new Dynamics);
+    std::shared_ptr<LinearSystem<state_dim, control_dim>> analyticLinearSystem(new LinearizedSystem);
+    std::shared_ptr<CostFunctionQuadratic<state_dim, control_dim>> costFunction(
+        new CostFunctionAnalytical<state_dim, control_dim>(costFunctionFile));
+
+    ct::core::Time tf = 3.0;
+    ct::core::loadScalar(configFile, "timeHorizon", tf);
+    size_t nSteps = settings.computeK(tf);
+
+    ControlVector<control_dim> uff_init_guess;
+    uff_init_guess << -(x_0(0) + 1) * x_0(0);
+    ControlVectorArray<control_dim> u0(nSteps, uff_init_guess);
+    StateVectorArray<state_dim> x0(nSteps + 1, x_0);
+    FeedbackArray<state_dim, control_dim> u0_fb(nSteps, FeedbackMatrix<state_dim, control_dim>::Zero());
+    NLOptConSolver::Policy_t initController(x0, u0, u0_fb, settings.dt);
+
+    ContinuousOptConProblem<state_dim, control_dim> optConProblem(
+        tf, x0[0], nonlinearSystem, costFunction, analyticLinearSystem);
+
+    // reference solution without deadline
+    NLOptConSolver reference(optConProblem, settings);
+    reference.setInitialGuess(initController);
+    reference.solve();
+    ControlTrajectory<control_dim> u_reference = reference.getControlTrajectory();
+
+    // a deadline in the past must not alter the initial guess
+    NLOptConSolver expired(optConProblem, settings);
+    expired.setInitialGuess(initController);
+    expired.setDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    expired.solve();
+    ControlTrajectory<control_dim> u_expired = expired.getControlTrajectory();
+    for (size_t i = 0; i < u_expired.size(); i++)
+        ASSERT_NEAR(u_expired[i](0), uff_init_guess(0), 1e-12);
+
+    // a generous deadline must yield the reference solution
+    NLOptConSolver generous(optConProblem, settings);
+    generous.setInitialGuess(initController);
+    generous.setDeadline(std::chrono::steady_clock::now() + std::chrono::seconds(100));
+    generous.solve();
+    ControlTrajectory<control_dim> u_generous = generous.getControlTrajectory();
+    for (size_t i = 0; i < u_generous.size(); i++)
+        ASSERT_NEAR(u_generous[i](0), u_reference[i](0), 1e-8);
+
+    // the budget needs to report affordable phases consistently
+    NLOCTimeBudget budget(1.0, 1.0);
+    ASSERT_EQ(budget.affordable(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, 2, 1.0, 10), 10u);
+    budget.record(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, 1.0);
+    budget.setBudget(3.5);
+    ASSERT_EQ(budget.affordable(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, 2, 1.0, 10), 6u);
+    ASSERT_FALSE(budget.hasTimeFor(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, 4));
+    budget.clearDeadline();
+    ASSERT_TRUE(budget.hasTimeFor(NLOCTimeBudget::LINE_SEARCH_CANDIDATE, 4));
+
+    // the MPC path splits an iteration into prepare and finish, which update the iteration estimate as well
+    NLOptConSolver mpcSolver(optConProblem, settings);
+    mpcSolver.setInitialGuess(initController);
+    ASSERT_FALSE(mpcSolver.getBackend()->getTimeBudget().hasEstimate(NLOCTimeBudget::ITERATION));
+    mpcSolver.prepareMPCIteration();
+    mpcSolver.finishMPCIteration();
+    ASSERT_TRUE(mpcSolver.getBackend()->getTimeBudget().hasEstimate(NLOCTimeBudget::ITERATION));
+}
+
+//! the number of records of every name in a trace file
+std::map<std::string, size_t> traceRecordCounts(const std::string& fileName)
+{
+    std::map<std::string, size_t> counts;
+    ct::core::TraceReader reader(fileName);
+    ct::core::TraceRecord record;
+    while (reader.next(record))
+        counts[record.name]++;
+    return counts;
+}
+
+TEST(NLOCTest, TraceLogging)
+{
+    typedef NLOptConSolver<state_dim, control_dim, 1, 0> NLOptConSolver;
+
+    std::string configFile = std::string(NLOC_TEST_DIR) + "/nonlinear/solver.info";
+    std::string costFunctionFile = std::string(NLOC_TEST_DIR) + "/nonlinear/cost.info";
+
+    Eigen::Matrix<double, 1, 1> x_0;
+    ct::core::loadMatrix(costFunctionFile, "x_0", x_0);
+
+    NLOptConSettings settings;
+    settings.load(configFile, true, "gnms");
+    settings.printSummary = false;
+    settings.loggingPrefix = "NLOCTraceTest";
+    settings.logToTrace = true;
+    settings.traceDecimation = 2;
+
+    std::shared_ptr<ControlledSystem<state_dim, control_dim>> nonlinearSystem(new Dynamics);
+    std::shared_ptr<LinearSystem<state_dim, control_dim>> analyticLinearSystem(new LinearizedSystem);
+    std::shared_ptr<CostFunctionQuadratic<state_dim, control_dim>> costFunction(
+        new CostFunctionAnalytical<state_dim, control_dim>(costFunctionFile));
+
+    ct::core::Time tf = 3.0;
+    ct::core::loadScalar(configFile, "timeHorizon", tf);
+    size_t nSteps = settings.computeK(tf);
+
+    ControlVectorArray<control_dim> u0(nSteps, ControlVector<control_dim>::Zero());
+    StateVectorArray<state_dim> x0(nSteps + 1, x_0);
+    FeedbackArray<state_dim, control_dim> u0_fb(nSteps, FeedbackMatrix<state_dim, control_dim>::Zero());
+    NLOptConSolver::Policy_t initController(x0, u0, u0_fb, settings.dt);
+
+    ContinuousOptConProblem<state_dim, control_dim> optConProblem(
+        tf, x0[0], nonlinearSystem, costFunction, analyticLinearSystem);
+
+    const std::string fileName = settings.loggingPrefix + ".cttrace";
+    for (bool logLQ : {false, true})
+    {
+        settings.logLQToTrace = logLQ;
+        size_t nIterations;
+        {
+            // the trace is complete once the solver is destroyed
+            NLOptConSolver solver(optConProblem, settings);
+            solver.setInitialGuess(initController);
+
+            // a fixed number of iterations, solve() converges after the first one
+            for (size_t i = 0; i < 5; i++)
+                solver.runIteration();
+            nIterations = solver.getBackend()->getSummary().iterations.size();
+
+            solver.logSummaryToTrace("NLOCTraceTestSummary");
+        }
+
+        // the LQ problem and the Riccati internals are opt-in, trajectories are logged every second iteration
+        std::map<std::string, size_t> counts = traceRecordCounts(fileName);
+        ASSERT_EQ(counts["cost"], 5u);
+        ASSERT_EQ(counts["x"], 3u);
+        ASSERT_EQ(counts["time_lqSolve"], counts["cost"]);
+        ASSERT_EQ(counts["A"], logLQ ? counts["x"] : 0u);
+        ASSERT_EQ(counts["riccati_S"], logLQ ? counts["x"] : 0u);
+
+        ct::core::TraceReader summary("NLOCTraceTestSummary.cttrace");
+        ct::core::TraceRecord record;
+        ASSERT_TRUE(summary.next(record));
+        ASSERT_EQ(record.name, "iterations");
+        ASSERT_EQ(record.count, nIterations);
+    }
+
+    std::remove(fileName.c_str());
+    std::remove("NLOCTraceTestSummary.cttrace");
+}
+
 }  // namespace example
 }  // namespace optcon
 }  // namespace ct
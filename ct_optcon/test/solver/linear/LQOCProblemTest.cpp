@@ -0,0 +1,122 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include <ct/optcon/optcon.h>
+
+using namespace ct::optcon;
+
+const size_t state_dim = 3;
+const size_t control_dim = 2;
+typedef LQOCProblem<state_dim, control_dim> LQOCProblem_t;
+
+TEST(LQOCProblemTest, GeneralConstraintCapacity)
+{
+    const int N = 5;
+    const int capacity = 4;
+    LQOCProblem_t problem(N);
+    problem.reserveGeneralConstraints(capacity);
+    ASSERT_EQ(problem.getGeneralConstraintCapacity(), capacity);
+    ASSERT_FALSE(problem.isGeneralConstrained());
+
+    // the stages are laid out contiguously, in slots of capacity rows
+    std::vector<const double*> C_data, D_data, d_lb_data, d_ub_data;
+    for (int k = 0; k < N + 1; k++)
+    {
+        problem.setGeneralConstraintCount(k, capacity);
+        ASSERT_EQ(problem.C_[k].data(), problem.C_.data() + k * capacity * state_dim);
+        ASSERT_EQ(problem.D_[k].data(), problem.D_.data() + k * capacity * control_dim);
+        ASSERT_EQ(problem.d_lb_[k].data(), problem.d_lb_.data() + k * capacity);
+        C_data.push_back(problem.C_[k].data());
+        D_data.push_back(problem.D_[k].data());
+        d_lb_data.push_back(problem.d_lb_[k].data());
+        d_ub_data.push_back(problem.d_ub_[k].data());
+    }
+
+    // changing the number of constraints within the capacity neither allocates nor moves data
+    for (int nConstr : {1, 3, 0, 2})
+    {
+        for (int k = 0; k < N + 1; k++)
+        {
+            problem.setGeneralConstraintCount(k, (nConstr + k) % (capacity + 1));
+            const int ng = problem.ng_[k];
+            ASSERT_EQ(problem.C_[k].rows(), ng);
+            ASSERT_EQ(problem.C_[k].cols(), (int)state_dim);
+            ASSERT_EQ(problem.D_[k].rows(), ng);
+            ASSERT_EQ(problem.D_[k].cols(), (int)control_dim);
+            ASSERT_EQ(problem.d_lb_[k].size(), ng);
+            ASSERT_EQ(problem.d_ub_[k].size(), ng);
+            ASSERT_EQ(problem.C_[k].data(), C_data[k]);
+            ASSERT_EQ(problem.D_[k].data(), D_data[k]);
+            ASSERT_EQ(problem.d_lb_[k].data(), d_lb_data[k]);
+            ASSERT_EQ(problem.d_ub_[k].data(), d_ub_data[k]);
+
+            problem.C_[k].setConstant(k);
+            problem.d_ub_[k].setConstant(k);
+        }
+        for (int k = 0; k < N + 1; k++)
+        {
+            ASSERT_TRUE(problem.C_[k].isConstant(k));
+            ASSERT_TRUE(problem.d_ub_[k].isConstant(k));
+        }
+    }
+    ASSERT_EQ(problem.getGeneralConstraintCapacity(), capacity);
+
+    // exceeding the capacity grows the storage and keeps the constraints of all stages
+    std::vector<Eigen::MatrixXd> C_before;
+    for (int k = 0; k < N + 1; k++)
+        C_before.push_back(problem.C_[k]);
+    problem.setGeneralConstraintCount(N, capacity + 2);
+    ASSERT_EQ(problem.getGeneralConstraintCapacity(), capacity + 2);
+    for (int k = 0; k < N; k++)
+        ASSERT_EQ(problem.C_[k], C_before[k]);
+    ASSERT_EQ(problem.C_[N].rows(), capacity + 2);
+
+    // changing the number of stages keeps the capacity and the remaining stages
+    problem.changeNumStages(N - 2);
+    ASSERT_EQ(problem.getGeneralConstraintCapacity(), capacity + 2);
+    for (int k = 0; k < N - 1; k++)
+        ASSERT_EQ(problem.C_[k], C_before[k]);
+}
+
+TEST(LQOCProblemTest, GeneralConstraintCopy)
+{
+    const int N = 3;
+    Eigen::MatrixXd d_lb = -Eigen::MatrixXd::Ones(2, 1);
+    Eigen::MatrixXd d_ub = Eigen::MatrixXd::Ones(2, 1);
+    Eigen::MatrixXd C = Eigen::MatrixXd::Random(2, state_dim);
+    Eigen::MatrixXd D = Eigen::MatrixXd::Random(2, control_dim);
+
+    LQOCProblem_t problem(N);
+    problem.setZero();
+    problem.setGeneralConstraints(d_lb, d_ub, C, D);
+    ASSERT_TRUE(problem.isGeneralConstrained());
+
+    // a copy owns its constraint storage
+    LQOCProblem_t copy(problem);
+    for (int k = 0; k < N + 1; k++)
+    {
+        ASSERT_EQ(copy.ng_[k], 2);
+        ASSERT_NE(copy.C_[k].data(), problem.C_[k].data());
+        ASSERT_EQ(copy.C_[k], C);
+        ASSERT_EQ(copy.D_[k], D);
+        ASSERT_EQ(copy.d_lb_[k], d_lb);
+        ASSERT_EQ(copy.d_ub_[k], d_ub);
+    }
+    problem.C_[0].setZero();
+    ASSERT_EQ(copy.C_[0], C);
+
+    // resetting removes the constraints but keeps the capacity
+    problem.setZero();
+    ASSERT_FALSE(problem.isGeneralConstrained());
+    ASSERT_EQ(problem.getGeneralConstraintCapacity(), 2);
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
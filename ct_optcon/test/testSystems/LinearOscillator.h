@@ -73,27 +73,29 @@ public:
 
 template <typename SCALAR = double>
 std::shared_ptr<CostFunctionQuadratic<state_dim, control_dim, SCALAR>> createCostFunctionLinearOscillator(
-    Eigen::Matrix<SCALAR, 2, 1>& x_final)
+    Eigen::Matrix<SCALAR, 2, 1>& x_final,
+    const SCALAR finalWeight = SCALAR(1000),
+    const SCALAR controlWeight = SCALAR(100))
 {
     Eigen::Matrix<SCALAR, 2, 2> Q;
     Q << 0, 0, 0, 1;
 
     Eigen::Matrix<SCALAR, 1, 1> R;
-    R << 100;
+    R << controlWeight;
 
-    ct::core::StateVector<2> x_nominal = ct::core::StateVector<2>::Zero();
-    ct::core::ControlVector<1> u_nominal = ct::core::ControlVector<1>::Zero();
+    ct::core::StateVector<2, SCALAR> x_nominal = ct::core::StateVector<2, SCALAR>::Zero();
+    ct::core::ControlVector<1, SCALAR> u_nominal = ct::core::ControlVector<1, SCALAR>::Zero();
 
     Eigen::Matrix<SCALAR, 2, 2> Q_final;
-    Q_final << 1000, 0, 0, 1000;
+    Q_final << finalWeight, 0, 0, finalWeight;
 
-    std::shared_ptr<TermQuadratic<state_dim, control_dim>> termIntermediate(
-        new TermQuadratic<state_dim, control_dim>(Q, R, x_nominal, u_nominal));
-    std::shared_ptr<TermQuadratic<state_dim, control_dim>> termFinal(
-        new TermQuadratic<state_dim, control_dim>(Q_final, R, x_final, u_nominal));
+    std::shared_ptr<TermQuadratic<state_dim, control_dim, SCALAR, SCALAR>> termIntermediate(
+        new TermQuadratic<state_dim, control_dim, SCALAR, SCALAR>(Q, R, x_nominal, u_nominal));
+    std::shared_ptr<TermQuadratic<state_dim, control_dim, SCALAR, SCALAR>> termFinal(
+        new TermQuadratic<state_dim, control_dim, SCALAR, SCALAR>(Q_final, R, x_final, u_nominal));
 
-    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim>> quadraticCostFunction(
-        new CostFunctionAnalytical<state_dim, control_dim>);
+    std::shared_ptr<CostFunctionAnalytical<state_dim, control_dim, SCALAR>> quadraticCostFunction(
+        new CostFunctionAnalytical<state_dim, control_dim, SCALAR>);
     quadraticCostFunction->addIntermediateTerm(termIntermediate);
     quadraticCostFunction->addFinalTerm(termFinal);
 
@@ -7,6 +7,10 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #include <ct/rbd/state/RBDState.h>
 
+#include "terrain/Terrain.h"
+#include "terrain/HeightMapTerrain.h"
+#include "terrain/MeshTerrain.h"
+
 #pragma GCC diagnostic push  // include IIT headers and disable warnings
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #pragma GCC diagnostic ignored "-Wunused-value"
@@ -27,14 +31,16 @@ namespace rbd {
  *
  * \f[ {}_W \lambda = f(q, \dot{q}) \f]
  *
- * The contact model assumes a plane with fixed orientation located at the origin (0, 0, 0). The contact dynamics
+ * By default the contact model assumes a plane with fixed orientation located at the origin (0, 0, 0). Other
+ * terrains, e.g. a HeightMapTerrain or a MeshTerrain, can be set via setTerrain(). The contact dynamics
  * are a combination of a spring-damper perpendicular and a damper in parallel to the surface. The force expressed
  * in world coordinates without velocity smoothing or normal force smoothing is defined as
  *
- * \f[ {}_W \lambda = f(q, \dot{q}) = - k ({}_W x_z - z_{offset}) - d {}_W \dot{x}  \f]
+ * \f[ {}_W \lambda = f(q, \dot{q}) = - k ({}_W x_z - z_{offset}) {}_W n - d {}_W \dot{x}  \f]
  *
- * where \f$ {}_W x_z \f$ is the ground penetration with respect to an offset \f$ z_{offset} \f$ expressed in world
- * coordinates and \f$ \dot{x} \f$ is the velocity of the endeffector.
+ * where \f$ {}_W x_z \f$ is the ground penetration with respect to an offset \f$ z_{offset} \f$ measured along the
+ * terrain normal \f$ {}_W n \f$ and \f$ \dot{x} \f$ is the velocity of the endeffector. For a terrain of height
+ * \f$ h \f$ below the endeffector, the penetration is the distance to the tangent plane \f$ ({}_W x_z - h) n_z \f$.
  *
  * In case normal force smoothing is activated, the first term becomes
  *
@@ -75,6 +81,7 @@ public:
     typedef Eigen::Matrix<SCALAR, 3, 1> Vector3s;
     typedef kindr::Position<SCALAR, 3> Position3S;
     typedef kindr::Velocity<SCALAR, 3> Velocity3S;
+    typedef Terrain<SCALAR> Terrain_t;
 
 
     /*!
@@ -111,7 +118,8 @@ public:
           d_(d),
           alpha_(alpha),
           alpha_n_(alpha_n),
-          zOffset_(zOffset)
+          zOffset_(zOffset),
+          terrain_(new FlatTerrain<SCALAR>())
     {
         for (size_t i = 0; i < NUM_EE; i++)
             EEactive_[i] = true;
@@ -129,6 +137,7 @@ public:
           alpha_(other.alpha_),
           alpha_n_(other.alpha_n_),
           zOffset_(other.zOffset_),
+          terrain_(other.terrain_),
           EEactive_(other.EEactive_)
     {
     }
@@ -139,6 +148,12 @@ public:
 	 * @param activeMap flags of active end-effectors
 	 */
     void setActiveEE(const ActiveMap& activeMap) { EEactive_ = activeMap; }
+    /**
+	 * \brief Sets the terrain. The terrain is not copied and is shared with all clones of this contact model.
+	 * @param terrain the terrain
+	 */
+    void setTerrain(const std::shared_ptr<const Terrain_t>& terrain) { terrain_ = terrain; }
+    const std::shared_ptr<const Terrain_t>& terrain() const { return terrain_; }
     /**
 	 * \brief Computes the contact forces given a state of the robot. Returns forces expressed in the world frame
 	 * @param state The state of the robot
@@ -148,16 +163,21 @@ public:
     {
         EEForcesLinear eeForces;
 
+        // evaluate the kinematics of all end-effectors at once
+        kinematics_->updateKinematics(state);
+
         for (size_t i = 0; i < NUM_EE; i++)
         {
             if (EEactive_[i])
             {
-                Vector3s eePenetration = computePenetration(i, state.basePose(), state.jointPositions());
+                SCALAR eePenetration;
+                Vector3s normal;
 
-                if (eeInContact(eePenetration))
+                if (computePenetration(kinematics_->getCachedEEPositionInWorld(i), eePenetration, normal) &&
+                    eeInContact(eePenetration))
                 {
-                    Velocity3S eeVelocity = kinematics_->getEEVelocityInWorld(i, state);
-                    eeForces[i] = computeEEForce(eePenetration, eeVelocity);
+                    const Velocity3S& eeVelocity = kinematics_->getCachedEEVelocityInWorld(i);
+                    eeForces[i] = computeEEForce(eePenetration, normal, eeVelocity);
                 }
                 else
                 {
@@ -178,13 +198,13 @@ public:
 
 private:
     /**
-	 * \brief Checks if end-effector is in contact. Currently assumes this is the case for negative z
+	 * \brief Checks if end-effector is in contact. Currently assumes this is the case for negative penetration
 	 * @param eePenetration The surface penetration of the end-effector
 	 * @return flag if the end-effector is in contact
 	 */
-    bool eeInContact(const Vector3s& eePenetration)
+    bool eeInContact(const SCALAR& eePenetration)
     {
-        if (smoothing_ == NONE && eePenetration(2) > 0.0)
+        if (smoothing_ == NONE && eePenetration > 0.0)
             return false;
         else
             return true;
@@ -192,32 +212,30 @@ private:
 
 
     /**
-	 * \brief Computes the surface penetration. Currently assumes the surface is at height z = 0.
-	 * @param eeId ID of the end-effector
-	 * @param basePose Position of the robot base
-	 * @param jointPosition Joint position of the robot
-	 * @return Penetration in world coordinates
+	 * \brief Computes the surface penetration along the terrain normal
+	 * @param pos Position of the end-effector in world coordinates
+	 * @param penetration signed distance to the tangent plane of the terrain, negative below the surface
+	 * @param normal terrain normal in world coordinates
+	 * @return false if there is no terrain below the end-effector
 	 */
-    Vector3s computePenetration(const size_t& eeId,
-        const tpl::RigidBodyPose<SCALAR>& basePose,
-        const typename JointState<NJOINTS, SCALAR>::Position& jointPosition)
+    bool computePenetration(const Position3S& pos, SCALAR& penetration, Vector3s& normal)
     {
-        Position3S pos = kinematics_->getEEPositionInWorld(eeId, basePose, jointPosition);
-
-        // we currently assume flat ground at height zero penetration is only z height
-        Vector3s penetration;
-        penetration << SCALAR(0.0), SCALAR(0.0), pos.z();
+        SCALAR height;
+        if (!terrain_->evaluate(pos.x(), pos.y(), height, normal))
+            return false;
 
-        return penetration;
+        penetration = (pos.z() - height) * normal(2);
+        return true;
     }
 
     /*!
 	 * \brief Compute the endeffector force based on penetration and velocity
 	 * @param eePenetration end-effector penetration
+	 * @param normal terrain normal
 	 * @param eeVelocity end-effector velocity
 	 * @return resulting force vecttor
 	 */
-    EEForceLinear computeEEForce(const Vector3s& eePenetration, const Velocity3S& eeVelocity)
+    EEForceLinear computeEEForce(const SCALAR& eePenetration, const Vector3s& normal, const Velocity3S& eeVelocity)
     {
         EEForceLinear eeForce;
 
@@ -225,7 +243,7 @@ private:
 
         smoothEEForce(eeForce, eePenetration);
 
-        computeNormalSpring(eeForce, eePenetration(2) - zOffset_, eeVelocity.toImplementation()(2));
+        computeNormalSpring(eeForce, normal, eePenetration - zOffset_, normal.dot(eeVelocity.toImplementation()));
 
         return eeForce;
     }
@@ -235,21 +253,21 @@ private:
 	 * @param eeForce endeffector force to modify
 	 * @param eePenetration penetration of the surface
 	 */
-    void smoothEEForce(EEForceLinear& eeForce, const Vector3s& eePenetration)
+    void smoothEEForce(EEForceLinear& eeForce, const SCALAR& eePenetration)
     {
         switch (smoothing_)
         {
             case NONE:
                 return;
             case SIGMOID:
-                eeForce *= 1. / (1. + TRAIT::exp(eePenetration(2) * alpha_));
+                eeForce *= 1. / (1. + TRAIT::exp(eePenetration * alpha_));
                 return;
             case TANH:
                 // same as sigmoid, maybe cheaper / more expensive to compute?
-                eeForce *= 0.5 * TRAIT::tanh(-0.5 * eePenetration(2) * alpha_) + 0.5;
+                eeForce *= 0.5 * TRAIT::tanh(-0.5 * eePenetration * alpha_) + 0.5;
                 return;
             case ABS:
-                eeForce *= 0.5 * -eePenetration(2) * alpha_ / (1. + TRAIT::fabs(-eePenetration(2) * alpha_)) + 0.5;
+                eeForce *= 0.5 * -eePenetration * alpha_ / (1. + TRAIT::fabs(-eePenetration * alpha_)) + 0.5;
                 return;
             default:
                 throw std::runtime_error("undefined smoothing function");
@@ -262,20 +280,20 @@ private:
 	 * @param eePenetration endeffector penetration of the surface
 	 * @param eeVelocity endeffector velocity
 	 */
-    void computeDamperForce(EEForceLinear& force, const Vector3s& eePenetration, const Velocity3S& eeVelocity)
+    void computeDamperForce(EEForceLinear& force, const SCALAR& eePenetration, const Velocity3S& eeVelocity)
     {
         force = -d_ * eeVelocity.toImplementation();
     }
 
-    void computeNormalSpring(EEForceLinear& force, const SCALAR& p_N, const SCALAR& p_dot_N)
+    void computeNormalSpring(EEForceLinear& force, const Vector3s& normal, const SCALAR& p_N, const SCALAR& p_dot_N)
     {
         if (alpha_n_ > SCALAR(0))
         {
-            force(2) += k_ * TRAIT::exp(-alpha_n_ * p_N);
+            force += k_ * TRAIT::exp(-alpha_n_ * p_N) * normal;
         }
         else if (p_N <= SCALAR(0))
         {
-            force(2) -= k_ * p_N;
+            force -= k_ * p_N * normal;
         }
     }
 
@@ -292,6 +310,8 @@ private:
     SCALAR alpha_n_;  //!< normal force smoothing coefficient
     SCALAR zOffset_;  //!< vertical offset of the contact pane
 
+    std::shared_ptr<const Terrain_t> terrain_;  //!< terrain, shared between clones
+
     ActiveMap EEactive_;  //!< stores which endeffectors are active, i.e. can make contact
 };
 }  // namespace rbd
@@ -0,0 +1,150 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Terrain.h"
+#include "TerrainAtomic.h"
+
+namespace ct {
+namespace rbd {
+
+/*!
+ * \brief A terrain given by heights on a regular grid with bilinear interpolation
+ *
+ * Sample (i, j) of the height map is located at \f$ (x_0 + i \Delta, y_0 + j \Delta) \f$. Within a cell the height is
+ *
+ * \f[ h(s, t) = (1-s)(1-t) h_{00} + s(1-t) h_{10} + (1-s) t h_{01} + s t h_{11} \f]
+ *
+ * with the local coordinates \f$ s, t \in [0, 1] \f$. The normal follows analytically from the gradient of h.
+ * The cell lookup is a constant time index computation. Outside the grid the height of the closest boundary
+ * point is used.
+ *
+ * Auto-Diff queries are evaluated by a TerrainAtomic, which performs the same lookup whenever the tape or the
+ * generated code is evaluated. Its size hence does not depend on the size of the height map.
+ */
+template <typename SCALAR>
+class HeightMapTerrain : public Terrain<SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef typename Terrain<SCALAR>::Vector3s Vector3s;
+
+    /*!
+     * \brief Constructor
+     * @param heights grid of heights, rows correspond to x and columns to y, at least 2x2
+     * @param resolution grid spacing
+     * @param x0 x coordinate of sample (0, 0)
+     * @param y0 y coordinate of sample (0, 0)
+     */
+    HeightMapTerrain(const Eigen::MatrixXd& heights,
+        const double resolution,
+        const double x0 = 0.0,
+        const double y0 = 0.0)
+        : heights_(heights), resolution_(resolution), x0_(x0), y0_(y0)
+    {
+        if (heights_.rows() < 2 || heights_.cols() < 2)
+            throw std::runtime_error("HeightMapTerrain: height map needs at least 2x2 samples.");
+        if (resolution_ <= 0.0)
+            throw std::runtime_error("HeightMapTerrain: resolution needs to be positive.");
+
+        atomic_ = createAtomic(internal::isAutoDiff<SCALAR>());
+    }
+
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal) const override
+    {
+        return evaluate(x, y, height, normal, internal::isAutoDiff<SCALAR>());
+    }
+
+    //! looks up the bilinear patch of the cell below (x, y)
+    void lookup(const double x, const double y, TerrainPatch& patch) const
+    {
+        int i, j;
+        double s, t;
+        bool xInside, yInside;
+        localCoordinate(x, x0_, heights_.rows(), i, s, xInside);
+        localCoordinate(y, y0_, heights_.cols(), j, t, yInside);
+
+        const double h00 = heights_(i, j);
+        const double h10 = heights_(i + 1, j);
+        const double h01 = heights_(i, j + 1);
+        const double h11 = heights_(i + 1, j + 1);
+
+        patch.x = x;
+        patch.y = y;
+        patch.height = (1.0 - s) * (1.0 - t) * h00 + s * (1.0 - t) * h10 + (1.0 - s) * t * h01 + s * t * h11;
+
+        // outside the grid the height is constant along the clamped axis
+        patch.dhdx = xInside ? ((1.0 - t) * (h10 - h00) + t * (h11 - h01)) / resolution_ : 0.0;
+        patch.dhdy = yInside ? ((1.0 - s) * (h01 - h00) + s * (h11 - h10)) / resolution_ : 0.0;
+        patch.d2hdxdy = xInside && yInside ? (h11 - h10 - h01 + h00) / (resolution_ * resolution_) : 0.0;
+    }
+
+    const Eigen::MatrixXd& heights() const { return heights_; }
+    double resolution() const { return resolution_; }
+private:
+    //! evaluates the cell below (x, y)
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal, std::false_type) const
+    {
+        TerrainPatch patch;
+        lookup(static_cast<double>(x), static_cast<double>(y), patch);
+
+        height = SCALAR(patch.height);
+        this->normalFromGradient(SCALAR(patch.dhdx), SCALAR(patch.dhdy), normal);
+        return true;
+    }
+
+    //! evaluates the cell below (x, y) through the atomic function
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal, std::true_type) const
+    {
+        SCALAR dhdx, dhdy;
+        atomic_->evaluate(x, y, height, dhdx, dhdy);
+        this->normalFromGradient(dhdx, dhdy, normal);
+        return true;
+    }
+
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> createAtomic(std::false_type) const { return nullptr; }
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> createAtomic(std::true_type) const
+    {
+        // compiled code may call the atomic function after this terrain is destroyed, hence it owns a copy
+        const std::shared_ptr<const HeightMapTerrain<double>> terrain(
+            new HeightMapTerrain<double>(heights_, resolution_, x0_, y0_));
+        return std::make_shared<TerrainAtomicEvaluator<SCALAR>>(
+            [terrain](const double x, const double y, TerrainPatch& patch) { terrain->lookup(x, y, patch); });
+    }
+
+    /*!
+     * \brief computes the cell index and the local coordinate within the cell along one axis
+     *
+     * Outside the grid the coordinate is clamped to the boundary, which makes the local coordinate constant.
+     */
+    void localCoordinate(const double x, const double origin, const int samples, int& index, double& s, bool& inside)
+        const
+    {
+        const double gridValue = (x - origin) / resolution_;
+        inside = gridValue >= 0.0 && gridValue <= double(samples - 1);
+
+        const double clamped = std::min(std::max(gridValue, 0.0), double(samples - 1));
+        index = std::min(static_cast<int>(std::floor(clamped)), samples - 2);
+        s = clamped - index;
+    }
+
+    Eigen::MatrixXd heights_;  //!< grid of terrain heights
+    double resolution_;        //!< grid spacing
+    double x0_;                //!< x coordinate of the first sample
+    double y0_;                //!< y coordinate of the first sample
+
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> atomic_;  //!< evaluation of Auto-Diff queries
+};
+
+}  // namespace rbd
+}  // namespace ct
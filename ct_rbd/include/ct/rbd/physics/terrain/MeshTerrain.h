@@ -0,0 +1,269 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "Terrain.h"
+#include "TerrainAtomic.h"
+
+namespace ct {
+namespace rbd {
+
+/*!
+ * \brief A terrain given by a triangle mesh
+ *
+ * The height at (x, y) is the highest triangle whose projection onto the x-y plane contains (x, y). Within a
+ * triangle the height is \f$ h = a x + b y + c \f$, precomputed at construction, and the normal is the constant
+ * triangle normal. Vertical triangles are ignored.
+ *
+ * Triangles are stored in a uniform grid over the x-y bounding box of the mesh, each cell holding the triangles
+ * whose bounding box overlaps it. A query therefore only tests the triangles of a single cell.
+ *
+ * Auto-Diff queries are evaluated by a TerrainAtomic, which performs the same lookup whenever the tape or the
+ * generated code is evaluated. Its size hence does not depend on the number of triangles. Since the result of
+ * evaluate() cannot depend on the query point for Auto-Diff scalars, points without terrain below get the height
+ * noTerrainHeight(), far below the mesh, and evaluate() returns true.
+ */
+template <typename SCALAR>
+class MeshTerrain : public Terrain<SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef typename Terrain<SCALAR>::Vector3s Vector3s;
+
+    /*!
+     * \brief Constructor
+     * @param vertices vertex positions in world frame, one vertex per row
+     * @param triangles vertex indices of the triangles, one triangle per row
+     * @param cellSize edge length of the cells of the spatial index
+     */
+    MeshTerrain(const Eigen::Matrix<double, Eigen::Dynamic, 3>& vertices,
+        const Eigen::Matrix<int, Eigen::Dynamic, 3>& triangles,
+        const double cellSize)
+        : cellSize_(cellSize)
+    {
+        if (cellSize_ <= 0.0)
+            throw std::runtime_error("MeshTerrain: cell size needs to be positive.");
+
+        buildTriangles(vertices, triangles);
+        buildIndex();
+
+        atomic_ = createAtomic(vertices, triangles, internal::isAutoDiff<SCALAR>());
+    }
+
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal) const override
+    {
+        return evaluate(x, y, height, normal, internal::isAutoDiff<SCALAR>());
+    }
+
+    //! looks up the highest triangle below (x, y), returns false if there is none
+    bool lookup(const double x, const double y, TerrainPatch& patch) const
+    {
+        const int ix = static_cast<int>(std::floor((x - xMin_) / cellSize_));
+        const int iy = static_cast<int>(std::floor((y - yMin_) / cellSize_));
+        if (ix < 0 || iy < 0 || ix >= nx_ || iy >= ny_)
+            return false;
+
+        const Triangle* top = nullptr;
+        double topHeight = 0.0;
+        const size_t cell = static_cast<size_t>(ix * ny_ + iy);
+        for (size_t k = cellStart_[cell]; k < cellStart_[cell + 1]; k++)
+        {
+            const Triangle& tri = triangles_[cellTriangles_[k]];
+            if (!tri.contains(x, y))
+                continue;
+
+            const double h = tri.plane(0) * x + tri.plane(1) * y + tri.plane(2);
+            if (top == nullptr || h > topHeight)
+            {
+                top = &tri;
+                topHeight = h;
+            }
+        }
+
+        if (top == nullptr)
+            return false;
+
+        patch = TerrainPatch{x, y, topHeight, top->plane(0), top->plane(1), 0.0};
+        return true;
+    }
+
+    size_t numTriangles() const { return triangles_.size(); }
+    //! height of points without terrain below for Auto-Diff queries, 1000 below the lowest vertex of the mesh
+    double noTerrainHeight() const { return noTerrainHeight_; }
+private:
+    //! evaluates the highest triangle of the cell containing (x, y)
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal, std::false_type) const
+    {
+        TerrainPatch patch;
+        if (!lookup(static_cast<double>(x), static_cast<double>(y), patch))
+            return false;
+
+        height = SCALAR(patch.height);
+        this->normalFromGradient(SCALAR(patch.dhdx), SCALAR(patch.dhdy), normal);
+        return true;
+    }
+
+    //! evaluates the highest triangle containing (x, y) through the atomic function
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal, std::true_type) const
+    {
+        SCALAR dhdx, dhdy;
+        atomic_->evaluate(x, y, height, dhdx, dhdy);
+        this->normalFromGradient(dhdx, dhdy, normal);
+        return true;
+    }
+
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> createAtomic(const Eigen::Matrix<double, Eigen::Dynamic, 3>&,
+        const Eigen::Matrix<int, Eigen::Dynamic, 3>&,
+        std::false_type) const
+    {
+        return nullptr;
+    }
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> createAtomic(
+        const Eigen::Matrix<double, Eigen::Dynamic, 3>& vertices,
+        const Eigen::Matrix<int, Eigen::Dynamic, 3>& triangles,
+        std::true_type) const
+    {
+        // compiled code may call the atomic function after this terrain is destroyed, hence it owns a copy
+        const std::shared_ptr<const MeshTerrain<double>> terrain(
+            new MeshTerrain<double>(vertices, triangles, cellSize_));
+        const double noTerrain = noTerrainHeight_;
+        return std::make_shared<TerrainAtomicEvaluator<SCALAR>>(
+            [terrain, noTerrain](const double x, const double y, TerrainPatch& patch) {
+                if (!terrain->lookup(x, y, patch))
+                    patch = TerrainPatch::constant(x, y, noTerrain);
+            });
+    }
+
+    //! a non-vertical triangle with precomputed plane and projected edge functions
+    struct Triangle
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        //! checks if (x, y) lies within the projection of the triangle onto the x-y plane
+        bool contains(const double x, const double y) const
+        {
+            return (edges.col(0).dot(Eigen::Vector3d(x, y, 1.0)) >= eps &&
+                    edges.col(1).dot(Eigen::Vector3d(x, y, 1.0)) >= eps &&
+                    edges.col(2).dot(Eigen::Vector3d(x, y, 1.0)) >= eps);
+        }
+
+        static constexpr double eps = -1e-12;  //!< tolerance of the barycentric coordinates
+
+        Eigen::Vector3d plane;  //!< height h = plane(0) * x + plane(1) * y + plane(2)
+        Eigen::Matrix3d edges;  //!< barycentric coordinate i = edges.col(i).dot([x, y, 1])
+        Eigen::Vector2d min;    //!< lower corner of the x-y bounding box
+        Eigen::Vector2d max;    //!< upper corner of the x-y bounding box
+    };
+
+    void buildTriangles(const Eigen::Matrix<double, Eigen::Dynamic, 3>& vertices,
+        const Eigen::Matrix<int, Eigen::Dynamic, 3>& triangles)
+    {
+        triangles_.reserve(triangles.rows());
+        noTerrainHeight_ = std::numeric_limits<double>::max();
+
+        for (int t = 0; t < triangles.rows(); t++)
+        {
+            const Eigen::Vector3d p0 = vertices.row(triangles(t, 0)).transpose();
+            const Eigen::Vector3d p1 = vertices.row(triangles(t, 1)).transpose();
+            const Eigen::Vector3d p2 = vertices.row(triangles(t, 2)).transpose();
+
+            Eigen::Vector3d n = (p1 - p0).cross(p2 - p0);
+            if (std::abs(n(2)) < 1e-12 * n.squaredNorm())
+                continue;
+            if (n(2) < 0.0)
+                n = -n;
+
+            Triangle tri;
+            tri.plane << -n(0) / n(2), -n(1) / n(2), n.dot(p0) / n(2);
+
+            // barycentric coordinates from the inverse of the projected vertex matrix
+            Eigen::Matrix3d P;
+            P << p0(0), p1(0), p2(0), p0(1), p1(1), p2(1), 1.0, 1.0, 1.0;
+            tri.edges = P.inverse().transpose();
+
+            tri.min << std::min({p0(0), p1(0), p2(0)}), std::min({p0(1), p1(1), p2(1)});
+            tri.max << std::max({p0(0), p1(0), p2(0)}), std::max({p0(1), p1(1), p2(1)});
+
+            triangles_.push_back(tri);
+            noTerrainHeight_ = std::min({noTerrainHeight_, p0(2) - 1000.0, p1(2) - 1000.0, p2(2) - 1000.0});
+        }
+
+        if (triangles_.empty())
+            throw std::runtime_error("MeshTerrain: mesh does not contain any non-vertical triangle.");
+    }
+
+    void buildIndex()
+    {
+        Eigen::Vector2d min = triangles_[0].min;
+        Eigen::Vector2d max = triangles_[0].max;
+        for (const Triangle& tri : triangles_)
+        {
+            min = min.cwiseMin(tri.min);
+            max = max.cwiseMax(tri.max);
+        }
+
+        xMin_ = min(0);
+        yMin_ = min(1);
+        nx_ = static_cast<int>(std::floor((max(0) - xMin_) / cellSize_)) + 1;
+        ny_ = static_cast<int>(std::floor((max(1) - yMin_) / cellSize_)) + 1;
+
+        // count the triangles per cell, then fill a compressed cell list
+        std::vector<size_t> count(nx_ * ny_, 0);
+        forEachCell([&count](size_t cell, size_t) { count[cell]++; });
+
+        cellStart_.assign(nx_ * ny_ + 1, 0);
+        for (size_t c = 0; c < count.size(); c++)
+            cellStart_[c + 1] = cellStart_[c] + count[c];
+
+        cellTriangles_.resize(cellStart_.back());
+        std::vector<size_t> fill(cellStart_.begin(), cellStart_.end() - 1);
+        forEachCell([this, &fill](size_t cell, size_t t) { cellTriangles_[fill[cell]++] = t; });
+    }
+
+    //! calls f(cell, triangle) for every cell overlapped by the bounding box of a triangle
+    template <typename F>
+    void forEachCell(F f) const
+    {
+        for (size_t t = 0; t < triangles_.size(); t++)
+        {
+            const int ix0 = std::max(0, static_cast<int>(std::floor((triangles_[t].min(0) - xMin_) / cellSize_)));
+            const int iy0 = std::max(0, static_cast<int>(std::floor((triangles_[t].min(1) - yMin_) / cellSize_)));
+            const int ix1 = std::min(nx_ - 1, static_cast<int>(std::floor((triangles_[t].max(0) - xMin_) / cellSize_)));
+            const int iy1 = std::min(ny_ - 1, static_cast<int>(std::floor((triangles_[t].max(1) - yMin_) / cellSize_)));
+
+            for (int ix = ix0; ix <= ix1; ix++)
+                for (int iy = iy0; iy <= iy1; iy++)
+                    f(static_cast<size_t>(ix * ny_ + iy), t);
+        }
+    }
+
+    std::vector<Triangle, Eigen::aligned_allocator<Triangle>> triangles_;  //!< all non-vertical triangles
+
+    double cellSize_;  //!< edge length of a grid cell
+    double xMin_;      //!< x coordinate of the grid origin
+    double yMin_;      //!< y coordinate of the grid origin
+    int nx_;           //!< number of cells along x
+    int ny_;           //!< number of cells along y
+
+    double noTerrainHeight_;  //!< height of Auto-Diff queries without terrain below
+
+    std::vector<size_t> cellStart_;      //!< triangles of cell c are cellTriangles_[cellStart_[c] ... cellStart_[c+1]]
+    std::vector<size_t> cellTriangles_;  //!< triangle indices sorted by cell
+
+    std::shared_ptr<TerrainAtomicEvaluator<SCALAR>> atomic_;  //!< evaluation of Auto-Diff queries
+};
+
+}  // namespace rbd
+}  // namespace ct
@@ -0,0 +1,136 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+#ifdef CPPADCG
+#include <cppad/cg.hpp>
+#endif
+
+#ifdef CPPAD
+#include <cppad/cppad.hpp>
+#endif
+
+#pragma GCC diagnostic push  // include IIT headers and disable warnings
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-value"
+#include <iit/rbd/traits/TraitSelector.h>
+#pragma GCC diagnostic pop
+
+namespace ct {
+namespace rbd {
+
+namespace internal {
+
+/*!
+ * \brief true for Auto-Diff scalars, for which terrains must not branch on the value of the query point
+ *
+ * A branch on the value would be recorded for the taping point only, hence terrains evaluate Auto-Diff queries
+ * through a TerrainAtomic, which looks up the cell or triangle whenever the tape or the generated code is evaluated.
+ */
+template <typename SCALAR>
+using isAutoDiff = std::integral_constant<bool, !std::is_arithmetic<SCALAR>::value>;
+
+}  // namespace internal
+
+
+/*!
+ * \brief The terrain in the neighbourhood of a query point \f$ (x_r, y_r) \f$
+ *
+ * Within the cell or triangle containing the query point, the height is the bilinear polynomial
+ *
+ * \f[ h(x, y) = h_r + h_x (x - x_r) + h_y (y - y_r) + h_{xy} (x - x_r) (y - y_r) \f]
+ *
+ * which is all a TerrainAtomic needs to evaluate the height and its derivatives of any order.
+ */
+struct TerrainPatch
+{
+    //! a patch of constant height
+    static TerrainPatch constant(const double x, const double y, const double height)
+    {
+        return TerrainPatch{x, y, height, 0.0, 0.0, 0.0};
+    }
+
+    double x;        //!< x coordinate of the query point
+    double y;        //!< y coordinate of the query point
+    double height;   //!< height at the query point
+    double dhdx;     //!< derivative of the height w.r.t. x at the query point
+    double dhdy;     //!< derivative of the height w.r.t. y at the query point
+    double d2hdxdy;  //!< mixed second derivative of the height, constant within the patch
+};
+
+
+/*!
+ * \brief Interface for the terrain used by contact models
+ *
+ * The terrain is described as a height above the x-y plane of the world frame. Queries take the horizontal
+ * position of a contact point and return the terrain height below it together with the surface normal.
+ * Terrains are read-only after construction and may be shared between clones of a contact model.
+ *
+ * Terrains must be differentiable with Auto-Diff and Auto-Diff-Codegen scalars at every query point, not only within
+ * the region containing the taping point, see internal::isAutoDiff.
+ *
+ * \tparam SCALAR the scalar type of the queries, e.g. double or an Auto-Diff type
+ */
+template <typename SCALAR>
+class Terrain
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef Eigen::Matrix<SCALAR, 3, 1> Vector3s;
+
+    virtual ~Terrain() {}
+    /*!
+     * \brief Evaluates the terrain below a point
+     * @param x x coordinate in world frame
+     * @param y y coordinate in world frame
+     * @param height terrain height at (x, y)
+     * @param normal unit surface normal at (x, y) in world frame
+     * @return false if there is no terrain below (x, y), height and normal are undefined in that case
+     */
+    virtual bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal) const = 0;
+
+protected:
+    //! computes the unit normal of a surface from the gradient of its height
+    static void normalFromGradient(const SCALAR& dhdx, const SCALAR& dhdy, Vector3s& normal)
+    {
+        const SCALAR one(1.0);
+        normal << -dhdx, -dhdy, one;
+        normal /= iit::rbd::tpl::TraitSelector<SCALAR>::Trait::sqrt(dhdx * dhdx + dhdy * dhdy + one);
+    }
+};
+
+
+/*!
+ * \brief A horizontal plane at fixed height
+ */
+template <typename SCALAR>
+class FlatTerrain : public Terrain<SCALAR>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef typename Terrain<SCALAR>::Vector3s Vector3s;
+
+    FlatTerrain(const double height = 0.0) : height_(height) {}
+    bool evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, Vector3s& normal) const override
+    {
+        height = SCALAR(height_);
+        normal << SCALAR(0.0), SCALAR(0.0), SCALAR(1.0);
+        return true;
+    }
+
+private:
+    double height_;  //!< height of the plane
+};
+
+}  // namespace rbd
+}  // namespace ct
@@ -0,0 +1,307 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+
+#include "Terrain.h"
+
+#ifdef CPPADCG
+#include <ct/core/internal/autodiff/CGAtomicRegistry.h>
+#endif
+
+namespace ct {
+namespace rbd {
+
+/*!
+ * \brief Evaluates a terrain for Auto-Diff scalars through a TerrainAtomic
+ *
+ * Specialized for CppAD::AD<double> and CppAD::AD<CppAD::cg::CG<double>>, other scalars are not supported.
+ */
+template <typename SCALAR>
+class TerrainAtomicEvaluator
+{
+    static_assert(!std::is_same<SCALAR, SCALAR>::value, "TerrainAtomicEvaluator: Auto-Diff scalar not supported.");
+};
+
+#ifdef CPPAD
+
+/*!
+ * \brief CppAD atomic function evaluating a terrain through double precision lookups
+ *
+ * Maps the horizontal position (x, y) to the height and its gradient (h, dh/dx, dh/dy). Every evaluation looks up
+ * the TerrainPatch below the current point with the spatial index of the terrain. The tape and the generated code
+ * hence contain a single operation regardless of the size of the terrain, and are valid at all query points.
+ *
+ * Since the patch is a bilinear polynomial, Taylor coefficients of all orders are exact. The derivatives w.r.t. the
+ * selection of the patch, which only changes on cell or triangle borders, are zero.
+ */
+class TerrainAtomic : public CppAD::atomic_base<double>
+{
+public:
+    //! looks up the patch below (x, y)
+    typedef std::function<void(double, double, TerrainPatch&)> Lookup;
+
+    TerrainAtomic(const Lookup& lookup) : CppAD::atomic_base<double>(uniqueName(), bool_sparsity_enum), lookup_(lookup)
+    {
+    }
+
+    bool forward(size_t p,
+        size_t q,
+        const CppAD::vector<bool>& vx,
+        CppAD::vector<bool>& vy,
+        const CppAD::vector<double>& tx,
+        CppAD::vector<double>& ty) override
+    {
+        // all outputs depend on the patch, which is selected by both inputs
+        if (vx.size() > 0)
+            vy[0] = vy[1] = vy[2] = vx[0] || vx[1];
+
+        const size_t n = q + 1;
+        TerrainPatch patch;
+        lookup_(tx[0], tx[n], patch);
+
+        for (size_t k = p; k <= q; k++)
+        {
+            double dxdy = 0.0;
+            for (size_t i = 0; i <= k; i++)
+                dxdy += offset(tx, 0, i, n) * offset(tx, 1, k - i, n);
+
+            const bool zeroOrder = k == 0;
+            ty[k] = (zeroOrder ? patch.height : 0.0) + patch.dhdx * offset(tx, 0, k, n) +
+                    patch.dhdy * offset(tx, 1, k, n) + patch.d2hdxdy * dxdy;
+            ty[n + k] = (zeroOrder ? patch.dhdx : 0.0) + patch.d2hdxdy * offset(tx, 1, k, n);
+            ty[2 * n + k] = (zeroOrder ? patch.dhdy : 0.0) + patch.d2hdxdy * offset(tx, 0, k, n);
+        }
+        return true;
+    }
+
+    bool reverse(size_t q,
+        const CppAD::vector<double>& tx,
+        const CppAD::vector<double>& ty,
+        CppAD::vector<double>& px,
+        const CppAD::vector<double>& py) override
+    {
+        const size_t n = q + 1;
+        TerrainPatch patch;
+        lookup_(tx[0], tx[n], patch);
+
+        for (size_t k = 0; k < 2 * n; k++)
+            px[k] = 0.0;
+
+        for (size_t k = 0; k <= q; k++)
+        {
+            const double ph = py[k];
+            px[k] += ph * patch.dhdx + py[2 * n + k] * patch.d2hdxdy;
+            px[n + k] += ph * patch.dhdy + py[n + k] * patch.d2hdxdy;
+            for (size_t i = 0; i <= k; i++)
+            {
+                px[i] += ph * patch.d2hdxdy * offset(tx, 1, k - i, n);
+                px[n + k - i] += ph * patch.d2hdxdy * offset(tx, 0, i, n);
+            }
+        }
+        return true;
+    }
+
+    bool for_sparse_jac(size_t q,
+        const CppAD::vector<bool>& r,
+        CppAD::vector<bool>& s,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t i = 0; i < 3; i++)
+            for (size_t l = 0; l < q; l++)
+                s[i * q + l] = (depends(i, 0) && r[l]) || (depends(i, 1) && r[q + l]);
+        return true;
+    }
+
+    bool for_sparse_jac(size_t q,
+        const CppAD::vector<std::set<size_t>>& r,
+        CppAD::vector<std::set<size_t>>& s,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t i = 0; i < 3; i++)
+        {
+            s[i].clear();
+            for (size_t j = 0; j < 2; j++)
+                if (depends(i, j))
+                    s[i].insert(r[j].begin(), r[j].end());
+        }
+        return true;
+    }
+
+    bool rev_sparse_jac(size_t q,
+        const CppAD::vector<bool>& rt,
+        CppAD::vector<bool>& st,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t j = 0; j < 2; j++)
+            for (size_t l = 0; l < q; l++)
+                st[j * q + l] = (depends(0, j) && rt[l]) || (depends(1, j) && rt[q + l]) ||
+                                (depends(2, j) && rt[2 * q + l]);
+        return true;
+    }
+
+    bool rev_sparse_jac(size_t q,
+        const CppAD::vector<std::set<size_t>>& rt,
+        CppAD::vector<std::set<size_t>>& st,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            st[j].clear();
+            for (size_t i = 0; i < 3; i++)
+                if (depends(i, j))
+                    st[j].insert(rt[i].begin(), rt[i].end());
+        }
+        return true;
+    }
+
+    bool rev_sparse_hes(const CppAD::vector<bool>& vx,
+        const CppAD::vector<bool>& s,
+        CppAD::vector<bool>& t,
+        size_t q,
+        const CppAD::vector<bool>& r,
+        const CppAD::vector<bool>& u,
+        CppAD::vector<bool>& v,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            t[j] = (s[0] && depends(0, j)) || (s[1] && depends(1, j)) || (s[2] && depends(2, j));
+
+            // only the height has a non-zero second derivative, which is the mixed one
+            for (size_t l = 0; l < q; l++)
+                v[j * q + l] = (depends(0, j) && u[l]) || (depends(1, j) && u[q + l]) ||
+                               (depends(2, j) && u[2 * q + l]) || (s[0] && r[(1 - j) * q + l]);
+        }
+        return true;
+    }
+
+    bool rev_sparse_hes(const CppAD::vector<bool>& vx,
+        const CppAD::vector<bool>& s,
+        CppAD::vector<bool>& t,
+        size_t q,
+        const CppAD::vector<std::set<size_t>>& r,
+        const CppAD::vector<std::set<size_t>>& u,
+        CppAD::vector<std::set<size_t>>& v,
+        const CppAD::vector<double>& x) override
+    {
+        for (size_t j = 0; j < 2; j++)
+        {
+            t[j] = (s[0] && depends(0, j)) || (s[1] && depends(1, j)) || (s[2] && depends(2, j));
+
+            v[j].clear();
+            for (size_t i = 0; i < 3; i++)
+                if (depends(i, j))
+                    v[j].insert(u[i].begin(), u[i].end());
+            if (s[0])
+                v[j].insert(r[1 - j].begin(), r[1 - j].end());
+        }
+        return true;
+    }
+
+private:
+    //! every terrain has its own atomic function, which generated code refers to by name
+    static std::string uniqueName()
+    {
+        static std::atomic<size_t> count(0);
+        return "ct_rbd_TerrainAtomic_" + std::to_string(count++);
+    }
+
+    //! Taylor coefficient k of the offset of input j from the query point, whose zero order coefficient vanishes
+    static double offset(const CppAD::vector<double>& tx, const size_t j, const size_t k, const size_t n)
+    {
+        return k == 0 ? 0.0 : tx[j * n + k];
+    }
+
+    //! structural dependency of output i on input j: the height on both, dh/dx on y and dh/dy on x
+    static bool depends(const size_t i, const size_t j) { return i == 0 || i == 2 - j; }
+    Lookup lookup_;  //!< patch lookup of the terrain
+};
+
+
+template <>
+class TerrainAtomicEvaluator<CppAD::AD<double>>
+{
+public:
+    typedef CppAD::AD<double> SCALAR;
+
+    TerrainAtomicEvaluator(const TerrainAtomic::Lookup& lookup) : atomic_(lookup) {}
+    //! evaluates the height and its gradient at (x, y)
+    void evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, SCALAR& dhdx, SCALAR& dhdy) const
+    {
+        CppAD::vector<SCALAR> ax(2), ay(3);
+        ax[0] = x;
+        ax[1] = y;
+        atomic_(ax, ay);
+
+        height = ay[0];
+        dhdx = ay[1];
+        dhdy = ay[2];
+    }
+
+private:
+    mutable TerrainAtomic atomic_;  //!< the atomic function, taped by every evaluation
+};
+
+#endif
+
+#ifdef CPPADCG
+
+/*!
+ * \brief Evaluates a terrain for Auto-Diff-Codegen scalars
+ *
+ * The generated code calls the double precision TerrainAtomic by name. It is registered in the
+ * ct::core::internal::CGAtomicRegistry, from which just-in-time compiled models (DerivativesCppadJIT,
+ * ADCodegenLinearizer) retrieve it after loading. Source code generated for static compilation cannot call it.
+ */
+template <>
+class TerrainAtomicEvaluator<CppAD::AD<CppAD::cg::CG<double>>>
+{
+public:
+    typedef CppAD::AD<CppAD::cg::CG<double>> SCALAR;
+
+    TerrainAtomicEvaluator(const TerrainAtomic::Lookup& lookup)
+        : atomic_(std::make_shared<TerrainAtomic>(lookup)), cgAtomic_(*atomic_, sparsityPoint())
+    {
+        ct::core::internal::CGAtomicRegistry<double>::getInstance().add(atomic_);
+    }
+
+    //! evaluates the height and its gradient at (x, y)
+    void evaluate(const SCALAR& x, const SCALAR& y, SCALAR& height, SCALAR& dhdx, SCALAR& dhdy) const
+    {
+        CppAD::vector<SCALAR> ax(2), ay(3);
+        ax[0] = x;
+        ax[1] = y;
+        cgAtomic_(ax, ay);
+
+        height = ay[0];
+        dhdx = ay[1];
+        dhdy = ay[2];
+    }
+
+private:
+    //! the sparsity pattern of the terrain does not depend on the point
+    static CppAD::vector<double> sparsityPoint()
+    {
+        CppAD::vector<double> x(2);
+        x[0] = x[1] = 0.0;
+        return x;
+    }
+
+    std::shared_ptr<TerrainAtomic> atomic_;          //!< the atomic function called by the generated code
+    mutable CppAD::cg::CGAtomicFun<double> cgAtomic_;  //!< wrapper recording calls to atomic_ in the tape
+};
+
+#endif
+
+}  // namespace rbd
+}  // namespace ct
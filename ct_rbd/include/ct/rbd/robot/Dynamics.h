@@ -234,6 +234,8 @@ public:
     const typename Kinematics_t::Ptr_t& kinematicsPtr() const { return kinematics_; }
     SelectionMatrix_t& S() { return S_; }
     const SelectionMatrix_t& S() const { return S_; }
+    ProjectedDynamics<RBD, NEE>& projectedDynamics() { return p_dynamics_; }
+    const ProjectedDynamics<RBD, NEE>& projectedDynamics() const { return p_dynamics_; }
 private:
     SelectionMatrix_t S_;
 
@@ -0,0 +1,254 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include <ct/rbd/state/JointState.h>
+#include <ct/rbd/state/RBDState.h>
+
+#include "Kinematics.h"
+
+namespace ct {
+namespace rbd {
+
+/**
+ * @brief Forward dynamics derivatives obtained by differencing the RobCoGen inverse dynamics (RNEA)
+ *
+ * The forward dynamics derivatives follow from the inverse dynamics \f$ \tau = ID(q, \dot{q}, \ddot{q}) \f$ as
+ * \f[
+ *   \frac{\partial \ddot{q}}{\partial z} = - M^{-1} \frac{\partial ID}{\partial z},
+ *   \quad \frac{\partial \ddot{q}}{\partial \tau} = M^{-1} S^T
+ * \f]
+ * where ID is evaluated at the accelerations \f$ \ddot{q} = FD(q, \dot{q}, \tau) \f$.
+ *
+ * This is not an analytical RNEA derivative: \f$ \partial ID / \partial z \f$ is obtained from repeated RNEA
+ * evaluations, since the generated RobCoGen classes do not expose the kinematic tree required for the derivative
+ * recursions. The structure of the inverse dynamics only determines how accurate the differences are:
+ * - ID is quadratic in the generalized velocities, hence a central difference in the velocities has no truncation
+ *   error, independent of the step size.
+ * - ID is linear in the gravity vector, hence the derivative w.r.t. the base orientation is exact when evaluating
+ *   the gravity terms with the derivative of the gravity vector.
+ * - the derivative w.r.t. joint positions is a central difference with the usual truncation error.
+ *
+ * All derivatives share one factorization of M. External forces are assumed to be zero.
+ *
+ * @tparam RBD  The rbd container class
+ * @tparam NEE  The number of endeffectors
+ */
+template <class RBD, size_t NEE>
+class InverseDynamicsDerivatives
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef typename RBD::SCALAR SCALAR;
+
+    static const bool FB = RBD::TRAIT::floating_base;
+    static const size_t NJOINTS = RBD::NJOINTS;
+    static const size_t NDOF = NJOINTS + FB * 6;  //!< number of generalized velocities
+
+    typedef RBDState<NJOINTS, SCALAR> RBDState_t;
+    typedef JointState<NJOINTS, SCALAR> JointState_t;
+    typedef Eigen::Matrix<SCALAR, NJOINTS, 1> control_vector_t;
+    typedef Eigen::Matrix<SCALAR, 6, 1> Vector6_t;
+    typedef Eigen::Matrix<SCALAR, 3, 3> Matrix3_t;
+    typedef Eigen::Matrix<SCALAR, NDOF, 1> g_coordinate_vector_t;
+    typedef Eigen::Matrix<SCALAR, NDOF, NDOF> inertia_matrix_t;
+    typedef Eigen::Matrix<SCALAR, NDOF, 6> base_pose_derivative_t;
+    typedef Eigen::Matrix<SCALAR, NDOF, NJOINTS> joint_derivative_t;
+    typedef Eigen::Matrix<SCALAR, NDOF, NDOF> velocity_derivative_t;
+
+    InverseDynamicsDerivatives(const std::shared_ptr<Kinematics<RBD, NEE>>& kinematics) : kinematics_(kinematics) {}
+
+    /**
+     * @brief Derivatives of the fixed-base forward dynamics
+     * @param[in]   x           the joint state
+     * @param[in]   u           the joint torques
+     * @param[out]  dqdd_dq     derivative of the joint accelerations w.r.t. joint positions
+     * @param[out]  dqdd_dqd    derivative of the joint accelerations w.r.t. joint velocities
+     * @param[out]  dqdd_du     derivative of the joint accelerations w.r.t. joint torques
+     */
+    void computeForwardDynamicsDerivatives(const JointState_t& x,
+        const control_vector_t& u,
+        joint_derivative_t& dqdd_dq,
+        velocity_derivative_t& dqdd_dqd,
+        joint_derivative_t& dqdd_du)
+    {
+        static_assert(!FB, "use the RBDState overload for floating base systems");
+
+        RBD& robcogen = kinematics_->robcogen();
+
+        llt_.compute(robcogen.jSim().update(x.getPositions()));
+
+        // acceleration at the linearization point
+        control_vector_t qdd;
+        robcogen.forwardDynamics().fd(qdd, x.getPositions(), x.getVelocities(), u);
+
+        typename JointState_t::Position q = x.getPositions();
+        typename JointState_t::Velocity qd = x.getVelocities();
+        control_vector_t tauPlus, tauMinus;
+
+        // quadratic in qd, the central difference is exact
+        for (size_t i = 0; i < NJOINTS; i++)
+        {
+            qd(i) += SCALAR(1.0);
+            robcogen.inverseDynamics().id(tauPlus, q, qd, qdd);
+            qd(i) -= SCALAR(2.0);
+            robcogen.inverseDynamics().id(tauMinus, q, qd, qdd);
+            qd(i) = x.getVelocities()(i);
+            dqdd_dqd.col(i) = SCALAR(0.5) * (tauPlus - tauMinus);
+        }
+
+        for (size_t i = 0; i < NJOINTS; i++)
+        {
+            const SCALAR h = stepSize(q(i));
+            q(i) += h;
+            robcogen.inverseDynamics().id(tauPlus, q, qd, qdd);
+            q(i) -= SCALAR(2.0) * h;
+            robcogen.inverseDynamics().id(tauMinus, q, qd, qdd);
+            q(i) = x.getPositions()(i);
+            dqdd_dq.col(i) = (tauPlus - tauMinus) / (SCALAR(2.0) * h);
+        }
+
+        dqdd_dq = -llt_.solve(dqdd_dq);
+        dqdd_dqd = -llt_.solve(dqdd_dqd);
+        dqdd_du = llt_.solve(joint_derivative_t::Identity());
+    }
+
+    /**
+     * @brief Derivatives of the floating-base forward dynamics
+     *
+     * The generalized velocities are ordered as [base local angular velocity, base local linear velocity, joint
+     * velocities] and the base pose as [Euler angles xyz, position], i.e. as in RBDState::toStateVectorEulerXyz().
+     *
+     * @param[in]   x           the rbd state (Euler angle representation)
+     * @param[in]   u           the joint torques
+     * @param[out]  dvd_dpose   derivative of the generalized accelerations w.r.t. the base pose
+     * @param[out]  dvd_dq      derivative of the generalized accelerations w.r.t. joint positions
+     * @param[out]  dvd_dv      derivative of the generalized accelerations w.r.t. generalized velocities
+     * @param[out]  dvd_du      derivative of the generalized accelerations w.r.t. joint torques
+     */
+    void computeForwardDynamicsDerivatives(const RBDState_t& x,
+        const control_vector_t& u,
+        base_pose_derivative_t& dvd_dpose,
+        joint_derivative_t& dvd_dq,
+        velocity_derivative_t& dvd_dv,
+        joint_derivative_t& dvd_du)
+    {
+        static_assert(FB, "use the JointState overload for fixed base systems");
+
+        RBD& robcogen = kinematics_->robcogen();
+
+        const Vector6_t gravity = x.basePose().computeGravityB6D();
+        const typename JointState_t::Position q = x.joints().getPositions();
+
+        llt_.compute(robcogen.jSim().update(q));
+
+        // accelerations at the linearization point
+        control_vector_t qdd;
+        Vector6_t baseAcc;
+        robcogen.forwardDynamics().fd(
+            qdd, baseAcc, x.baseVelocities().getVector(), gravity, q, x.joints().getVelocities(), u);
+
+        Vector6_t baseV = x.baseVelocities().getVector();
+        typename JointState_t::Velocity qd = x.joints().getVelocities();
+        typename JointState_t::Position qPerturbed = q;
+        g_coordinate_vector_t tauPlus, tauMinus;
+
+        // quadratic in the generalized velocities, the central difference is exact
+        for (size_t i = 0; i < NDOF; i++)
+        {
+            perturbVelocity(baseV, qd, i, SCALAR(1.0));
+            inverseDynamics(tauPlus, gravity, baseV, baseAcc, q, qd, qdd);
+            perturbVelocity(baseV, qd, i, SCALAR(-2.0));
+            inverseDynamics(tauMinus, gravity, baseV, baseAcc, q, qd, qdd);
+            perturbVelocity(baseV, qd, i, SCALAR(1.0));
+            dvd_dv.col(i) = SCALAR(0.5) * (tauPlus - tauMinus);
+        }
+        baseV = x.baseVelocities().getVector();
+        qd = x.joints().getVelocities();
+
+        for (size_t i = 0; i < NJOINTS; i++)
+        {
+            const SCALAR h = stepSize(q(i));
+            qPerturbed(i) += h;
+            inverseDynamics(tauPlus, gravity, baseV, baseAcc, qPerturbed, qd, qdd);
+            qPerturbed(i) -= SCALAR(2.0) * h;
+            inverseDynamics(tauMinus, gravity, baseV, baseAcc, qPerturbed, qd, qdd);
+            qPerturbed(i) = q(i);
+            dvd_dq.col(i) = (tauPlus - tauMinus) / (SCALAR(2.0) * h);
+        }
+
+        // the base orientation only enters through gravity g_B = R_WB^T g_W, with d(g_B) = g_B x omega_B
+        // and omega_B = H^-1 d(eulerXyz), where H maps local angular velocities to Euler angle rates
+        kindr::EulerAnglesXyz<SCALAR> eulerXyz(x.basePose().getEulerAnglesXyz());
+        const Matrix3_t H = eulerXyz.getMappingFromLocalAngularVelocityToDiff();
+        Matrix3_t gravitySkew;
+        gravitySkew << SCALAR(0.0), -gravity(5), gravity(4), gravity(5), SCALAR(0.0), -gravity(3), -gravity(4),
+            gravity(3), SCALAR(0.0);
+        const Matrix3_t dgdEuler = gravitySkew * H.inverse();
+
+        Vector6_t dGravity(Vector6_t::Zero()), baseWrench;
+        control_vector_t jForces;
+        dvd_dpose.setZero();
+        for (size_t i = 0; i < 3; i++)
+        {
+            dGravity.template tail<3>() = dgdEuler.col(i);
+            robcogen.inverseDynamics().G_terms_fully_actuated(baseWrench, jForces, dGravity, q);
+            dvd_dpose.col(i) << baseWrench, jForces;
+        }
+
+        dvd_dpose = -llt_.solve(dvd_dpose);
+        dvd_dq = -llt_.solve(dvd_dq);
+        dvd_dv = -llt_.solve(dvd_dv);
+        joint_derivative_t St = joint_derivative_t::Zero();
+        St.template bottomRows<NJOINTS>().setIdentity();
+        dvd_du = llt_.solve(St);
+    }
+
+private:
+    //! fully actuated floating-base inverse dynamics without external forces
+    void inverseDynamics(g_coordinate_vector_t& tau,
+        const Vector6_t& gravity,
+        const Vector6_t& baseV,
+        const Vector6_t& baseAcc,
+        const typename JointState_t::Position& q,
+        const typename JointState_t::Velocity& qd,
+        const control_vector_t& qdd)
+    {
+        Vector6_t baseWrench;
+        control_vector_t jForces;
+        kinematics_->robcogen().inverseDynamics().id_fully_actuated(
+            baseWrench, jForces, gravity, baseV, baseAcc, q, qd, qdd);
+        tau << baseWrench, jForces;
+    }
+
+    //! add delta to the i-th generalized velocity
+    static void perturbVelocity(Vector6_t& baseV, typename JointState_t::Velocity& qd, size_t i, const SCALAR& delta)
+    {
+        if (i < 6)
+            baseV(i) += delta;
+        else
+            qd(i - 6) += delta;
+    }
+
+    //! step size for central differences
+    static SCALAR stepSize(const SCALAR& value)
+    {
+        using std::cbrt;
+        using std::max;
+        using std::abs;
+        return cbrt(Eigen::NumTraits<SCALAR>::epsilon()) * max(abs(value), SCALAR(1.0));
+    }
+
+    std::shared_ptr<Kinematics<RBD, NEE>> kinematics_;
+
+    Eigen::LLT<inertia_matrix_t> llt_;
+};
+
+}  // namespace rbd
+}  // namespace ct
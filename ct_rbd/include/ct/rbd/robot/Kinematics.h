@@ -221,6 +221,59 @@ public:
         return basePose.template rotateBaseToInertiaMat(B_R_EE);
     }
 
+    /*!
+     * \brief Computes the transforms and Jacobians of all end-effectors in one pass and caches the resulting
+     * end-effector positions, rotations and velocities. Use the getCached* methods to read them.
+     *
+     * The transforms and Jacobians only depend on the joint positions. They are only re-evaluated if the joint
+     * positions changed since the last call (not for auto-diff scalars, which always need to be recorded).
+     * The base pose and velocity dependent quantities are cheap and are updated on every call.
+     * @param rbdState current robot state
+     */
+    void updateKinematics(const RBDState<NJOINTS, SCALAR>& rbdState)
+    {
+        if (!jointPositionsCached(rbdState.jointPositions()))
+        {
+            for (size_t i = 0; i < NUM_EE; i++)
+            {
+                eeTransformsBase_[i] = robcogen().getHomogeneousTransformBaseEEById(i, rbdState.jointPositions());
+                eeJacobiansBase_[i] = robcogen().getJacobianBaseEEbyId(i, rbdState.jointPositions());
+            }
+            cachedJointPositions_ = rbdState.jointPositions();
+            kinematicsCacheValid_ = true;
+        }
+
+        const RigidBodyPoseTpl& basePose = rbdState.basePose();
+        for (size_t i = 0; i < NUM_EE; i++)
+        {
+            eePositionsBase_[i] = Position3Tpl(eeTransformsBase_[i].template topRightCorner<3, 1>());
+            eePositionsWorld_[i] = basePose.position() + basePose.template rotateBaseToInertia(eePositionsBase_[i]);
+
+            // joint motion, linear base motion and velocity induced by angular base motion
+            eeVelocitiesBase_[i].toImplementation() =
+                (eeJacobiansBase_[i] * rbdState.jointVelocities()).template bottomRows<3>();
+            eeVelocitiesBase_[i] += rbdState.base().velocities().getTranslationalVelocity();
+            eeVelocitiesBase_[i] += rbdState.base().velocities().getRotationalVelocity().cross(eePositionsBase_[i]);
+            eeVelocitiesWorld_[i] = basePose.rotateBaseToInertia(eeVelocitiesBase_[i]);
+        }
+    }
+
+    //! end-effector position in base coordinates from the last updateKinematics() call
+    const Position3Tpl& getCachedEEPositionInBase(size_t eeId) const { return eePositionsBase_[eeId]; }
+    //! end-effector position in world coordinates from the last updateKinematics() call
+    const Position3Tpl& getCachedEEPositionInWorld(size_t eeId) const { return eePositionsWorld_[eeId]; }
+    //! end-effector rotation w.r.t. the base frame from the last updateKinematics() call
+    Matrix3Tpl getCachedEERotInBase(size_t eeId) const
+    {
+        return eeTransformsBase_[eeId].template topLeftCorner<3, 3>();
+    }
+    //! end-effector Jacobian expressed in the base frame from the last updateKinematics() call
+    const Jacobian& getCachedJacobianBaseEE(size_t eeId) const { return eeJacobiansBase_[eeId]; }
+    //! end-effector velocity in base coordinates from the last updateKinematics() call
+    const Velocity3Tpl& getCachedEEVelocityInBase(size_t eeId) const { return eeVelocitiesBase_[eeId]; }
+    //! end-effector velocity in world coordinates from the last updateKinematics() call
+    const Velocity3Tpl& getCachedEEVelocityInWorld(size_t eeId) const { return eeVelocitiesWorld_[eeId]; }
+
     void addIKSolver(const std::shared_ptr<InverseKinematicsBase<NJOINTS, SCALAR>>& solver,
         size_t eeID,
         size_t solverID = 0)
@@ -359,11 +412,31 @@ public:
 
     RBD& robcogen() { return *rbdContainer_; }
 private:
+    //! check if the cached transforms and Jacobians were computed for the joint positions q
+    bool jointPositionsCached(const typename JointState_t::Position& q)
+    {
+        return jointPositionsCached(q, std::is_floating_point<SCALAR>());
+    }
+    bool jointPositionsCached(const typename JointState_t::Position& q, std::true_type)
+    {
+        return kinematicsCacheValid_ && q == cachedJointPositions_;
+    }
+    bool jointPositionsCached(const typename JointState_t::Position& q, std::false_type) { return false; }
     std::shared_ptr<RBD> rbdContainer_;
     std::array<EndEffector<NJOINTS, SCALAR>, N_EE> endEffectors_;
     FloatingBaseTransforms<RBD> floatingBaseTransforms_;
 
     std::unordered_map<size_t, std::shared_ptr<InverseKinematicsBase<NJOINTS, SCALAR>>> ikSolvers_;
+
+    // end-effector kinematics cache, see updateKinematics()
+    bool kinematicsCacheValid_ = false;
+    typename JointState_t::Position cachedJointPositions_;
+    std::array<HomogeneousTransform, N_EE> eeTransformsBase_;
+    std::array<Jacobian, N_EE> eeJacobiansBase_;
+    std::array<Position3Tpl, N_EE> eePositionsBase_;
+    std::array<Position3Tpl, N_EE> eePositionsWorld_;
+    std::array<Velocity3Tpl, N_EE> eeVelocitiesBase_;
+    std::array<Velocity3Tpl, N_EE> eeVelocitiesWorld_;
 };
 
 } /* namespace rbd */
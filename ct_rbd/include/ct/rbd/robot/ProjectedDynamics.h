@@ -50,6 +50,13 @@ public:
     typedef Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> MatrixXs;
     typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorXs;
 
+    //! Method used to solve the constrained forward dynamics
+    enum FORWARD_DYNAMICS_METHOD
+    {
+        KKT = 0,         //!< LDLT-solve of the full saddle-point system [M -Jc^T; -Jc 0]
+        RANGE_SPACE = 1  //!< factorize M once and solve the small contact-space system Jc M^-1 Jc^T
+    };
+
     /**
 	 * @brief The Constructor
 	 * @param[in]	kyn     Robot Kinematics
@@ -66,6 +73,14 @@ public:
 	 */
     void setContactConfiguration(const EE_in_contact_t& eeinc)
     {
+        bool changed = false;
+        for (size_t i = 0; i < NEE; i++)
+            changed = changed || (ee_in_contact_[i] != eeinc[i]);
+
+        // the factorizations only need to be rebuilt if the contact configuration changes
+        if (!changed)
+            return;
+
         ee_in_contact_ = eeinc;
         ResetJacobianStructure();
         setSizes();
@@ -76,6 +91,12 @@ public:
 	 * @param[out]	eeinc	The EE Boolean Data Map of the contact configuration
 	 */
     void getContactConfiguration(EE_in_contact_t& eeinc) { eeinc = ee_in_contact_; }
+
+    //! select the method used to solve the constrained forward dynamics
+    void setForwardDynamicsMethod(FORWARD_DYNAMICS_METHOD method) { fdMethod_ = method; }
+    //! get the method used to solve the constrained forward dynamics
+    FORWARD_DYNAMICS_METHOD getForwardDynamicsMethod() const { return fdMethod_; }
+
     /**
 	 * @brief Computes the forward dynamics in the constraint consistent subspace
 	 * of the current contact configuration
@@ -135,6 +156,33 @@ public:
     }
 
 private:
+    /**
+     * @brief Update all terms which only depend on the joint positions and the contact configuration,
+     * i.e. M and the reduced contact Jacobian. If the joint positions did not change since the last
+     * call, the cached terms and their factorizations are kept.
+     */
+    void updateConfigurationDependentTerms(const RBDState_t& x);
+
+    //! check if the configuration dependent terms were computed for the joint positions q
+    bool configurationCached(const typename JointState_t::Position& q)
+    {
+        return configurationCached(q, std::is_floating_point<Scalar>());
+    }
+    bool configurationCached(const typename JointState_t::Position& q, std::true_type)
+    {
+        return configurationCacheValid_ && q == cachedJointPositions_;
+    }
+    //! auto-diff scalars always need to be recorded, hence nothing is cached
+    bool configurationCached(const typename JointState_t::Position& q, std::false_type) { return false; }
+    /**
+     * @brief Factorize M and the contact-space inertia Jc M^-1 Jc^T for the range-space forward dynamics.
+     * Uses the non-pivoting LDLT from ct::core such that it can be used with auto-diff scalars.
+     */
+    void factorizeRangeSpace();
+
+    //! QR-decompose Jc^T and set up the complete orthogonal decomposition of the projected selection matrix
+    void factorizeNullSpace();
+
     /// @brief Update M h & f terms of the dynamics equation
     void updateDynamicsTerms(const RBDState_t& x, const control_vector_t& u);
 
@@ -146,6 +194,9 @@ private:
      *      P (M*qdd + h) = P*St*tau
      *      with P Jc^T = 0
      *      The user is responsible for providing a constraint consistent acceleration
+     *
+     *      With Jc^T = [Q1 Q2] R, the projector is P = Q2 Q2^T and the minimum-norm solution is
+     *      tau = (Q2^T St)^+ Q2^T (M*qdd + h)
      */
     void ProjectedInverseDynamicsCommon(const RBDState_t& x, const RBDAcceleration_t& qdd, control_vector_t& u);
 
@@ -153,6 +204,7 @@ private:
      * @brief Simultaniously solves the equations
      *      M*qdd + h = St*tau + Jct*lambda
      *      Jc*qdd + dJcdt*qd + omega x v = 0  (No acceleration of the feet)
+     *      either as one saddle-point system (KKT) or by eliminating qdd (RANGE_SPACE)
      */
     void ProjectedForwardDynamicsCommon(const RBDState_t& x, const control_vector_t& u);
 
@@ -180,8 +232,21 @@ private:
     tpl::ConstraintJacobian<Kinematics<RBD, NEE>, MAX_JAC_SIZE, NJOINTS, Scalar>
         Jc_; /*!< The Jacobian of the constraint */
 
-    inertia_matrix_t P_; /*!< The Projector */
-    Eigen::JacobiSVD<MatrixXs> svd_;
+    FORWARD_DYNAMICS_METHOD fdMethod_ = RANGE_SPACE;
+
+    typename JointState_t::Position cachedJointPositions_; /*!< joint positions of the cached terms */
+    bool configurationCacheValid_ = false;                 /*!< M and Jc_reduced_ are up to date */
+    bool rangeSpaceFactorized_ = false;                    /*!< range-space factorization is up to date */
+    bool nullSpaceFactorized_ = false;                     /*!< null-space factorization is up to date */
+
+    // range-space forward dynamics
+    MatrixXs ML_, MinvJcT_, lambdaL_, lambdaMatrix_, rhs_, sol_;
+    VectorXs Md_, lambdad_;
+
+    // null-space inverse dynamics
+    Eigen::ColPivHouseholderQR<MatrixXs> JcTqr_;               /*!< QR decomposition of Jc^T */
+    MatrixXs Q2_;                                              /*!< orthonormal basis of the null space of Jc */
+    Eigen::CompleteOrthogonalDecomposition<MatrixXs> PStcod_;  /*!< decomposition of Q2^T * S^T */
 };
 
 template <class RBD, size_t NEE>
@@ -189,7 +254,77 @@ ProjectedDynamics<RBD, NEE>::ProjectedDynamics(const std::shared_ptr<Kinematics<
     const EE_in_contact_t ee_inc /*= EE_in_Contact_t(false)*/)
     : kinematics_(kyn), ee_in_contact_(ee_inc)
 {
-    setContactConfiguration(ee_inc);
+    ResetJacobianStructure();
+    setSizes();
+}
+
+template <class RBD, size_t NEE>
+void ProjectedDynamics<RBD, NEE>::updateConfigurationDependentTerms(const RBDState_t& x)
+{
+    Jc_.updateState(x);
+
+    if (configurationCached(x.joints().getPositions()))
+        return;
+
+    M_ = kinematics_->robcogen().jSim().update(x.joints().getPositions());
+
+    int rowCount = 0;
+    for (size_t eeinc_i = 0; eeinc_i < NEE; eeinc_i++)
+    {
+        if (ee_in_contact_[eeinc_i])
+        {
+            Jc_reduced_.template block<3, NDOF>(rowCount, 0) = Jc_.J().template block<3, NDOF>(3 * eeinc_i, 0);
+            rowCount += 3;
+        }
+    }
+
+    cachedJointPositions_ = x.joints().getPositions();
+    configurationCacheValid_ = true;
+    rangeSpaceFactorized_ = false;
+    nullSpaceFactorized_ = false;
+}
+
+template <class RBD, size_t NEE>
+void ProjectedDynamics<RBD, NEE>::factorizeRangeSpace()
+{
+    if (rangeSpaceFactorized_)
+        return;
+
+    const MatrixXs M = M_;
+    core::inverseHelperfunctions::ldlt<Scalar>(M, ML_, Md_);
+
+    if (neec_ > 0)
+    {
+        const MatrixXs JcT = Jc_reduced_.transpose();
+        core::inverseHelperfunctions::solveLDLT<Scalar>(ML_, Md_, JcT, MinvJcT_);
+        lambdaMatrix_ = Jc_reduced_ * MinvJcT_;
+        core::inverseHelperfunctions::ldlt<Scalar>(lambdaMatrix_, lambdaL_, lambdad_);
+    }
+
+    rangeSpaceFactorized_ = true;
+}
+
+template <class RBD, size_t NEE>
+void ProjectedDynamics<RBD, NEE>::factorizeNullSpace()
+{
+    if (nullSpaceFactorized_)
+        return;
+
+    if (neec_ > 0)
+    {
+        JcTqr_.compute(Jc_reduced_.transpose());
+        const MatrixXs Q = JcTqr_.householderQ();
+        Q2_ = Q.rightCols(NDOF - JcTqr_.rank());
+    }
+    else
+    {
+        Q2_.setIdentity(NDOF, NDOF);
+    }
+
+    // Q2^T * S^T, where S selects the joint rows
+    PStcod_.compute(Q2_.template bottomRows<NJOINTS>().transpose());
+
+    nullSpaceFactorized_ = true;
 }
 
 template <class RBD, size_t NEE>
@@ -201,7 +336,7 @@ void ProjectedDynamics<RBD, NEE>::updateDynamicsTermsNoGravity(const RBDState_t&
     kinematics_->robcogen().inverseDynamics().C_terms_fully_actuated(
         base_w, jForces, x.baseVelocities().getVector(), x.joints().getPositions(), x.joints().getVelocities());
 
-    M_ = kinematics_->robcogen().jSim().update(x.joints().getPositions());
+    updateConfigurationDependentTerms(x);
 
     h_ << base_w, jForces;
     f_ << Eigen::Matrix<Scalar, 6, 1>::Zero(), u;
@@ -226,53 +361,66 @@ void ProjectedDynamics<RBD, NEE>::ProjectedInverseDynamicsCommon(const RBDState_
     const RBDAcceleration_t& qdd,
     control_vector_t& u)
 {
-    Jc_.updateState(x);
-    P_ = Jc_.P();
-
-    Eigen::Matrix<Scalar, NDOF, CONTROL_DIM> PSt = P_ * S_.transpose();
-
-    svd_.compute(PSt, Eigen::ComputeThinU | Eigen::ComputeThinV);
-
-    VectorXs sing_values(svd_.matrixV().cols(), 1);  // size of E has same size as columns of V
-    sing_values = (svd_.singularValues().array() > 1e-9).select(svd_.singularValues().array().inverse(), 0);
-    selection_matrix_t Pstinv = svd_.matrixV() * sing_values.asDiagonal() * svd_.matrixU().transpose();
-
-    selection_matrix_t PStP = Pstinv * P_;
+    factorizeNullSpace();
 
     g_coordinate_vector_t Mqdd = M_ * qdd.toCoordinateAcceleration();
 
-    u = PStP * (Mqdd + h_);
+    u = PStcod_.solve(Q2_.transpose() * (Mqdd + h_));
 }
 
 template <class RBD, size_t NEE>
 void ProjectedDynamics<RBD, NEE>::ProjectedForwardDynamicsCommon(const RBDState_t& x, const control_vector_t& u)
 {
+    // Set Dynamics, this also updates M and Jc if the joint positions changed
+    updateDynamicsTerms(x, u);
+
     // Set Kinematics
-    Jc_.updateState(x);
+    kinematics_->updateKinematics(x);
     int rowCount = 0;
     for (size_t eeinc_i = 0; eeinc_i < NEE; eeinc_i++)
     {
         if (ee_in_contact_[eeinc_i])
         {
-            Jc_reduced_.template block<3, NDOF>(rowCount, 0) = Jc_.J().template block<3, NDOF>(3 * eeinc_i, 0);
             dJcdt_reduced_.template block<3, NDOF>(rowCount, 0) = Jc_.dJdt().template block<3, NDOF>(3 * eeinc_i, 0);
             feet_crossproduct_.template segment<3>(rowCount) =
                 x.baseLocalAngularVelocity().toImplementation().template cross(
-                    kinematics_->getEEVelocityInBase(eeinc_i, x).toImplementation());
+                    kinematics_->getCachedEEVelocityInBase(eeinc_i).toImplementation());
             rowCount += 3;
         }
     }
 
-    // Set Dynamics
-    updateDynamicsTerms(x, u);
-    MJTJ0_.template block<NDOF, NDOF>(0, 0) = M_;
-    MJTJ0_.template block(NDOF, 0, 3 * neec_, NDOF) = -Jc_reduced_;
-    MJTJ0_.template block(0, NDOF, NDOF, 3 * neec_) = -Jc_reduced_.transpose();
-
     b_.template segment<NDOF>(0) = f_ - h_;
     b_.template segment(NDOF, 3 * neec_) = dJcdt_reduced_ * x.toCoordinateVelocity() + feet_crossproduct_;
 
-    qddlambda_ = core::LDLTsolve<Scalar>(MJTJ0_, b_);
+    if (fdMethod_ == KKT)
+    {
+        MJTJ0_.template block<NDOF, NDOF>(0, 0) = M_;
+        MJTJ0_.template block(NDOF, 0, 3 * neec_, NDOF) = -Jc_reduced_;
+        MJTJ0_.template block(0, NDOF, NDOF, 3 * neec_) = -Jc_reduced_.transpose();
+
+        qddlambda_ = core::LDLTsolve<Scalar>(MJTJ0_, b_);
+        return;
+    }
+
+    factorizeRangeSpace();
+
+    // unconstrained acceleration qdd0 = M^-1 (f - h)
+    rhs_ = b_.template segment<NDOF>(0);
+    sol_.resize(NDOF, 1);
+    core::inverseHelperfunctions::solveLDLT<Scalar>(ML_, Md_, rhs_, sol_);
+    qddlambda_.template segment<NDOF>(0) = sol_;
+
+    if (neec_ == 0)
+        return;
+
+    // contact forces from (Jc M^-1 Jc^T) lambda = -(dJcdt*qd + omega x v) - Jc*qdd0
+    rhs_ = -b_.segment(NDOF, 3 * neec_) - Jc_reduced_ * sol_;
+    sol_.resize(3 * neec_, 1);
+    core::inverseHelperfunctions::solveLDLT<Scalar>(lambdaL_, lambdad_, rhs_, sol_);
+    qddlambda_.segment(NDOF, 3 * neec_) = sol_;
+
+    // qdd = qdd0 + M^-1 Jc^T lambda
+    qddlambda_.template segment<NDOF>(0) += MinvJcT_ * sol_;
 }
 
 template <class RBD, size_t NEE>
@@ -309,6 +457,18 @@ void ProjectedDynamics<RBD, NEE>::setSizes()
 
     S_.template block<CONTROL_DIM, 6>(0, 0).setZero();
     S_.template block<CONTROL_DIM, NJOINTS>(0, 6).setIdentity();
+
+    ML_.resize(NDOF, NDOF);
+    Md_.resize(NDOF);
+    MinvJcT_.resize(NDOF, 3 * neec_);
+    lambdaMatrix_.resize(3 * neec_, 3 * neec_);
+    lambdaL_.resize(3 * neec_, 3 * neec_);
+    lambdad_.resize(3 * neec_);
+
+    // the reduced Jacobian changed its layout
+    configurationCacheValid_ = false;
+    rangeSpaceFactorized_ = false;
+    nullSpaceFactorized_ = false;
 }
 
 } /* namespace rbd */
@@ -5,6 +5,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 
 #pragma once
 
+#include <ct/core/common/ThreadPool.h>
 #include <ct/rbd/state/JointState.h>
 #include <ct/rbd/state/RigidBodyPose.h>
 
@@ -14,10 +15,13 @@ namespace rbd {
 
 struct InverseKinematicsSettings
 {
-    InverseKinematicsSettings() : maxNumTrials_(1), randomizeInitialGuess_(true), validationTol_(1e-4) {}
+    InverseKinematicsSettings() : maxNumTrials_(1), randomizeInitialGuess_(true), validationTol_(1e-4), nThreads_(1)
+    {
+    }
     size_t maxNumTrials_;
     bool randomizeInitialGuess_;
     double validationTol_;
+    size_t nThreads_;  //!< number of threads for batched solves, only used by solvers that support parallel solves
 };
 
 
@@ -30,6 +34,7 @@ public:
     using JointPosition_t = typename JointState<NJOINTS, SCALAR>::Position;
     using JointPositionsVector_t = std::vector<JointPosition_t, Eigen::aligned_allocator<JointPosition_t>>;
     using RigidBodyPoseTpl = tpl::RigidBodyPose<SCALAR>;
+    using RigidBodyPoseVector_t = std::vector<RigidBodyPoseTpl, Eigen::aligned_allocator<RigidBodyPoseTpl>>;
 
     //! default constructor
     InverseKinematicsBase() = default;
@@ -119,10 +124,86 @@ public:
             ikSolution, eeBasePose, identityWorldPose, queryJointPositions, freeJoints);
     }
 
+    /*!
+     * @brief compute inverse kinematics for a sequence of end-effector poses, e.g. a Cartesian path
+     *
+     * For every pose the solution closest to the solution of the previous pose is selected, starting with the
+     * solution closest to 'queryJointPositions'. If no solution is found for a pose, the previous solution is
+     * repeated. Solvers which support parallel solves compute the solution candidates of all poses on
+     * InverseKinematicsSettings::nThreads_ threads.
+     *
+     * @param ikSolutions one solution per pose
+     * @param eeBasePoses end-effector poses in base coordinates
+     * @param queryJointPositions joint positions the solution of the first pose should be close to
+     * @param freeJoints vector of indices of the free joints
+     * @return true if a solution was found for all poses, false otherwise
+     */
+    virtual bool computeInverseKinematicsBatch(JointPositionsVector_t& ikSolutions,
+        const RigidBodyPoseVector_t& eeBasePoses,
+        const JointPosition_t& queryJointPositions,
+        const std::vector<size_t>& freeJoints = std::vector<size_t>())
+    {
+        const size_t nPoses = eeBasePoses.size();
+
+        std::vector<JointPositionsVector_t> candidates(nPoses);
+        std::vector<char> hasSolution(nPoses, false);
+
+        auto solvePose = [&](size_t threadId, size_t i) {
+            hasSolution[i] = computeInverseKinematics(candidates[i], eeBasePoses[i], freeJoints);
+        };
+
+        if (supportsParallelSolves() && settings_.nThreads_ > 1)
+        {
+            if (!threadPool_ || threadPool_->getNumThreads() != settings_.nThreads_)
+                threadPool_.reset(new ct::core::ThreadPool(settings_.nThreads_));
+            threadPool_->parallelFor(nPoses, solvePose);
+        }
+        else
+        {
+            for (size_t i = 0; i < nPoses; i++)
+                solvePose(0, i);
+        }
+
+        // select the candidate closest to the previous solution
+        ikSolutions.resize(nPoses);
+        bool allSolved = true;
+        JointPosition_t previous = queryJointPositions;
+
+        for (size_t i = 0; i < nPoses; i++)
+        {
+            if (hasSolution[i] && !candidates[i].empty())
+            {
+                size_t closest = 0;
+                for (size_t j = 1; j < candidates[i].size(); j++)
+                {
+                    if ((candidates[i][j] - previous).norm() < (candidates[i][closest] - previous).norm())
+                        closest = j;
+                }
+                previous = candidates[i][closest];
+            }
+            else
+            {
+                allSolved = false;
+            }
+
+            ikSolutions[i] = previous;
+        }
+
+        return allSolved;
+    }
+
     const InverseKinematicsSettings& getSettings() const { return settings_; }
     void updateSettings(const InverseKinematicsSettings& settings) { settings_ = settings; }
 protected:
+    /*!
+     * @brief whether computeInverseKinematics() may be called concurrently on the same instance
+     *
+     * Solvers without internal state, e.g. analytical solvers, should return true.
+     */
+    virtual bool supportsParallelSolves() const { return false; }
     InverseKinematicsSettings settings_;
+
+    std::shared_ptr<ct::core::ThreadPool> threadPool_;  //!< worker threads for batched solves
 };
 
 } /* namespace rbd */
@@ -36,6 +36,7 @@ public:
     using JointPosition_t = typename InverseKinematicsBase::JointPosition_t;
     using JointPositionsVector_t = typename InverseKinematicsBase::JointPositionsVector_t;
     using RigidBodyPoseTpl = typename InverseKinematicsBase::RigidBodyPoseTpl;
+    using RigidBodyPoseVector_t = typename InverseKinematicsBase::RigidBodyPoseVector_t;
 
     IKNLPSolverIpopt() = delete;
 
@@ -72,6 +73,55 @@ public:
     bool computeInverseKinematics(JointPositionsVector_t& ikSolutions,
         const RigidBodyPoseTpl& ee_W_base,
         const std::vector<size_t>& freeJoints = std::vector<size_t>()) override
+    {
+        return solvePose(ikSolutions, ee_W_base, false);
+    }
+
+    bool computeInverseKinematics(JointPositionsVector_t& ikSolutions,
+        const RigidBodyPoseTpl& eeWorldPose,
+        const RigidBodyPoseTpl& baseWorldPose,
+        const std::vector<size_t>& freeJoints) override
+    {
+        return computeInverseKinematics(ikSolutions, eeWorldPose.inReferenceFrame(baseWorldPose), freeJoints);
+    }
+
+    /*!
+     * @brief solves the poses one after another, each solve is warm-started from the solution of the previous pose
+     *
+     * The IPOPT application and the problem structure are reused between the solves.
+     */
+    bool computeInverseKinematicsBatch(JointPositionsVector_t& ikSolutions,
+        const RigidBodyPoseVector_t& eeBasePoses,
+        const JointPosition_t& queryJointPositions,
+        const std::vector<size_t>& freeJoints = std::vector<size_t>()) override
+    {
+        ikSolutions.resize(eeBasePoses.size());
+
+        bool allSolved = true;
+        JointPosition_t previous = queryJointPositions;
+        JointPositionsVector_t solution;
+
+        for (size_t i = 0; i < eeBasePoses.size(); i++)
+        {
+            setInitialGuess(previous);
+
+            if (solvePose(solution, eeBasePoses[i], true))
+                previous = solution.front();
+            else
+                allSolved = false;
+
+            ikSolutions[i] = previous;
+        }
+
+        return allSolved;
+    }
+
+private:
+    /*!
+     * @brief solves for a single pose, starting from the current initial guess
+     * @param reuseStructure reuse the IPOPT problem structure of the previous solve
+     */
+    bool solvePose(JointPositionsVector_t& ikSolutions, const RigidBodyPoseTpl& ee_W_base, bool reuseStructure)
     {
         ikSolutions.clear();
 
@@ -101,7 +151,10 @@ public:
             }
 
             // call underlying NLP solver
-            solve();
+            if (reuseStructure)
+                reoptimize();
+            else
+                solve();
 
             JointPosition_t sol = iknlp_->getSolution();
 
@@ -121,15 +174,6 @@ public:
         return solutionFound;
     }
 
-    bool computeInverseKinematics(JointPositionsVector_t& ikSolutions,
-        const RigidBodyPoseTpl& eeWorldPose,
-        const RigidBodyPoseTpl& baseWorldPose,
-        const std::vector<size_t>& freeJoints) override
-    {
-        return computeInverseKinematics(ikSolutions, eeWorldPose.inReferenceFrame(baseWorldPose), freeJoints);
-    }
-
-private:
     std::shared_ptr<IKNLP> iknlp_;
 
     VALIDATION_KIN kinematics_;  // for validation (todo: need different way to include double-based kinematics
@@ -0,0 +1,134 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#pragma once
+
+#include <ct/rbd/robot/InverseDynamicsDerivatives.h>
+
+#include "RbdLinearizer.h"
+
+namespace ct {
+namespace rbd {
+
+/*!
+ *  \brief System Linearizer for Articulated Rigid Body Models based on InverseDynamicsDerivatives
+ *
+ *  Computes the state derivative by differencing the RobCoGen inverse dynamics instead of numerically
+ *  differentiating the forward dynamics of the full system, see InverseDynamicsDerivatives. The control derivative
+ *  \f$ M^{-1} S^T \f$ is a by-product of the state derivative and is reused by getDerivativeControl() if it is called
+ *  for the same joint positions, otherwise it is computed as in RbdLinearizer.
+ *
+ *  Works for FixBaseFDSystem and FloatingBaseFDSystem (Euler angle integration) without actuator dynamics
+ *  and without end-effector forces as control inputs.
+ *
+ *  \warning Contact models set on a FloatingBaseFDSystem are not taken into account.
+ */
+template <class SYSTEM>
+class RbdInverseDynamicsLinearizer : public RbdLinearizer<SYSTEM>
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    typedef RbdLinearizer<SYSTEM> Base;
+
+    typedef typename Base::SCALAR SCALAR;
+    typedef typename Base::state_vector_t state_vector_t;
+    typedef typename Base::control_vector_t control_vector_t;
+    typedef typename Base::state_matrix_t state_matrix_t;
+    typedef typename Base::state_control_matrix_t state_control_matrix_t;
+
+    typedef InverseDynamicsDerivatives<typename SYSTEM::Dynamics::ROBCOGEN, SYSTEM::Dynamics::N_EE>
+        InverseDynamicsDerivatives_t;
+
+    static const size_t STATE_DIM = Base::STATE_DIM;
+    static const size_t CONTROL_DIM = Base::CONTROL_DIM;
+    static const size_t NJOINTS = Base::NJOINTS;
+
+    RbdInverseDynamicsLinearizer(std::shared_ptr<SYSTEM> RBDSystem)
+        : Base(RBDSystem), derivatives_(RBDSystem->dynamics().kinematicsPtr()), dFduValid_(false)
+    {
+    }
+
+    RbdInverseDynamicsLinearizer(const RbdInverseDynamicsLinearizer& arg)
+        : Base(arg), derivatives_(this->RBDSystem_->dynamics().kinematicsPtr()), dFduValid_(false)
+    {
+    }
+
+    virtual ~RbdInverseDynamicsLinearizer() override {}
+    RbdInverseDynamicsLinearizer<SYSTEM>* clone() const override
+    {
+        return new RbdInverseDynamicsLinearizer<SYSTEM>(*this);
+    }
+
+    const state_matrix_t& getDerivativeState(const state_vector_t& x,
+        const control_vector_t& u,
+        const SCALAR t = 0.0) override
+    {
+        computeDerivativeState<Base::FLOATING_BASE>(x, u);
+        dFduPositions_ = x.template segment<NJOINTS>(Base::FLOATING_BASE * 6);
+        dFduValid_ = true;
+        return this->dFdx_;
+    }
+
+    const state_control_matrix_t& getDerivativeControl(const state_vector_t& x,
+        const control_vector_t& u,
+        const SCALAR t = 0.0) override
+    {
+        // M^-1 S^T only depends on the joint positions
+        if (dFduValid_ && dFduPositions_ == x.template segment<NJOINTS>(Base::FLOATING_BASE * 6))
+            return this->dFdu_;
+
+        dFduValid_ = false;
+        return Base::getDerivativeControl(x, u, t);
+    }
+
+private:
+    template <bool FB>
+    void computeDerivativeState(const state_vector_t& x,
+        const control_vector_t& u,
+        typename std::enable_if<!FB, bool>::type = true)
+    {
+        typename InverseDynamicsDerivatives_t::JointState_t jointState(x);
+        typename InverseDynamicsDerivatives_t::joint_derivative_t dqdd_dq, dqdd_du;
+        typename InverseDynamicsDerivatives_t::velocity_derivative_t dqdd_dqd;
+
+        derivatives_.computeForwardDynamicsDerivatives(jointState, u, dqdd_dq, dqdd_dqd, dqdd_du);
+
+        this->dFdx_.template bottomLeftCorner<NJOINTS, NJOINTS>() = dqdd_dq;
+        this->dFdx_.template bottomRightCorner<NJOINTS, NJOINTS>() = dqdd_dqd;
+        this->dFdu_.template bottomRows<NJOINTS>() = dqdd_du;
+    }
+
+    template <bool FB>
+    void computeDerivativeState(const state_vector_t& x,
+        const control_vector_t& u,
+        typename std::enable_if<FB, bool>::type = true)
+    {
+        typename InverseDynamicsDerivatives_t::RBDState_t rbdState(tpl::RigidBodyPose<SCALAR>::EULER);
+        rbdState.fromStateVectorEulerXyz(x);
+
+        typename InverseDynamicsDerivatives_t::base_pose_derivative_t dvd_dpose;
+        typename InverseDynamicsDerivatives_t::joint_derivative_t dvd_dq, dvd_du;
+        typename InverseDynamicsDerivatives_t::velocity_derivative_t dvd_dv;
+
+        derivatives_.computeForwardDynamicsDerivatives(rbdState, u, dvd_dpose, dvd_dq, dvd_dv, dvd_du);
+
+        this->dFdx_.template block<STATE_DIM / 2, 6>(STATE_DIM / 2, 0) = dvd_dpose;
+        this->dFdx_.template block<STATE_DIM / 2, NJOINTS>(STATE_DIM / 2, 6) = dvd_dq;
+        this->dFdx_.template bottomRightCorner<STATE_DIM / 2, STATE_DIM / 2>() = dvd_dv;
+        this->dFdu_.template bottomRows<STATE_DIM / 2>() = dvd_du;
+
+        this->updateBaseKinematicsDerivative(x);
+    }
+
+    InverseDynamicsDerivatives_t derivatives_;
+
+    //! joint positions at which the bottom rows of dFdu_ were last set by getDerivativeState()
+    Eigen::Matrix<SCALAR, NJOINTS, 1> dFduPositions_;
+    bool dFduValid_;
+};
+
+}  // namespace rbd
+}  // namespace ct
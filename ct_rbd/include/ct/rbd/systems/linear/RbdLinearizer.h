@@ -98,31 +98,7 @@ public:
         {
             Base::getDerivativeState(x, u, t);
 
-            // since we express base pose in world but base twist in body coordinates, we have to modify the top part
-            kindr::EulerAnglesXyz<SCALAR> eulerXyz(x.template topRows<3>());
-            kindr::RotationMatrix<SCALAR> R_WB_kindr(eulerXyz);
-
-            Eigen::Matrix<SCALAR, 3, 6> jacAngVel =
-                jacobianOfAngularVelocityMapping(x.template topRows<3>(), x.template segment<3>(STATE_DIM / 2))
-                    .transpose();
-
-            //this->dFdx_.template block<3,3>(0,0) = -R_WB_kindr.toImplementation() * JacobianOfRotationMultiplyVector( x.template topRows<3>(), R_WB_kindr.toImplementation()*(x.template segment<3>(STATE_DIM/2) ));
-            this->dFdx_.template block<3, 3>(0, 0) = jacAngVel.template block<3, 3>(0, 0);
-
-            this->dFdx_.template block<3, 3>(3, 0) =
-                -R_WB_kindr.toImplementation() *
-                JacobianOfRotationMultiplyVector(x.template topRows<3>(),
-                    R_WB_kindr.toImplementation() * (x.template segment<3>(STATE_DIM / 2 + 3)));
-
-
-            // Derivative Top Row
-            // This is the derivative of the orientation with respect to local angular velocity. This is NOT the rotation matrix
-            this->dFdx_.template block<3, 3>(0, STATE_DIM / 2) = jacAngVel.template block<3, 3>(0, 3);
-            // we prefer to use a combined calculation. The following call would be equivalent but recomputes sines/cosines
-            //this->dFdx_.template block<3, 3>(0, STATE_DIM/2) = eulerXyz.getMappingFromLocalAngularVelocityToDiff();
-
-            // This is the derivative of the position with respect to linear velocity. This is simply the rotation matrix
-            this->dFdx_.template block<3, 3>(3, STATE_DIM / 2 + 3) = R_WB_kindr.toImplementation();
+            updateBaseKinematicsDerivative(x);
 
             return this->dFdx_;
         }
@@ -169,6 +145,38 @@ public:
 protected:
     typedef typename SYSTEM::Dynamics::ROBCOGEN::JSIM jsim_t;
 
+    /*!
+     * fills the rows of dFdx_ that belong to the floating base pose. These rows only depend on the base kinematics.
+     */
+    void updateBaseKinematicsDerivative(const state_vector_t& x)
+    {
+        // since we express base pose in world but base twist in body coordinates, we have to modify the top part
+        kindr::EulerAnglesXyz<SCALAR> eulerXyz(x.template topRows<3>());
+        kindr::RotationMatrix<SCALAR> R_WB_kindr(eulerXyz);
+
+        Eigen::Matrix<SCALAR, 3, 6> jacAngVel =
+            jacobianOfAngularVelocityMapping(x.template topRows<3>(), x.template segment<3>(STATE_DIM / 2))
+                .transpose();
+
+        //this->dFdx_.template block<3,3>(0,0) = -R_WB_kindr.toImplementation() * JacobianOfRotationMultiplyVector( x.template topRows<3>(), R_WB_kindr.toImplementation()*(x.template segment<3>(STATE_DIM/2) ));
+        this->dFdx_.template block<3, 3>(0, 0) = jacAngVel.template block<3, 3>(0, 0);
+
+        this->dFdx_.template block<3, 3>(3, 0) =
+            -R_WB_kindr.toImplementation() *
+            JacobianOfRotationMultiplyVector(x.template topRows<3>(),
+                R_WB_kindr.toImplementation() * (x.template segment<3>(STATE_DIM / 2 + 3)));
+
+
+        // Derivative Top Row
+        // This is the derivative of the orientation with respect to local angular velocity. This is NOT the rotation matrix
+        this->dFdx_.template block<3, 3>(0, STATE_DIM / 2) = jacAngVel.template block<3, 3>(0, 3);
+        // we prefer to use a combined calculation. The following call would be equivalent but recomputes sines/cosines
+        //this->dFdx_.template block<3, 3>(0, STATE_DIM/2) = eulerXyz.getMappingFromLocalAngularVelocityToDiff();
+
+        // This is the derivative of the position with respect to linear velocity. This is simply the rotation matrix
+        this->dFdx_.template block<3, 3>(3, STATE_DIM / 2 + 3) = R_WB_kindr.toImplementation();
+    }
+
     std::shared_ptr<SYSTEM> RBDSystem_;
 
     Eigen::LLT<typename jsim_t::MatrixType> llt_;
@@ -42,6 +42,63 @@ TEST(EEContactModelTest, basicTest)
     }
 }
 
+TEST(EEContactModelTest, terrainTest)
+{
+    typedef TestHyQ::Kinematics HyqKinematics;
+    typedef typename EEContactModel<HyqKinematics>::EEForcesLinear EEForcesLinear;
+
+    // an inclined plane z = a x + b y + c, represented as height map and as mesh
+    const double a = 0.2, b = -0.1, c = -0.5;
+    const double resolution = 0.25;
+    const int samples = 41;
+    const double origin = -5.0;
+
+    Eigen::MatrixXd heights(samples, samples);
+    for (int i = 0; i < samples; i++)
+        for (int j = 0; j < samples; j++)
+            heights(i, j) = a * (origin + i * resolution) + b * (origin + j * resolution) + c;
+
+    Eigen::Matrix<double, Eigen::Dynamic, 3> vertices(4, 3);
+    Eigen::Matrix<int, Eigen::Dynamic, 3> triangles(2, 3);
+    for (int k = 0; k < 4; k++)
+    {
+        const double x = (k % 2 == 0) ? origin : -origin;
+        const double y = (k < 2) ? origin : -origin;
+        vertices.row(k) << x, y, a * x + b * y + c;
+    }
+    triangles << 0, 1, 2, 1, 3, 2;
+
+    EEContactModel<HyqKinematics> flatModel, flatHeightMapModel, heightMapModel, meshModel;
+    flatHeightMapModel.setTerrain(std::shared_ptr<const Terrain<double>>(
+        new HeightMapTerrain<double>(Eigen::MatrixXd::Zero(samples, samples), resolution, origin, origin)));
+    heightMapModel.setTerrain(
+        std::shared_ptr<const Terrain<double>>(new HeightMapTerrain<double>(heights, resolution, origin, origin)));
+    meshModel.setTerrain(std::shared_ptr<const Terrain<double>>(new MeshTerrain<double>(vertices, triangles, 1.0)));
+
+    std::shared_ptr<EEContactModel<HyqKinematics>> clonedModel(meshModel.clone());
+    ASSERT_EQ(clonedModel->terrain(), meshModel.terrain());
+
+    RBDState<HyqKinematics::NJOINTS> state;
+
+    for (size_t n = 0; n < 100; n++)
+    {
+        state.setRandom();
+
+        EEForcesLinear flat = flatModel.computeContactForces(state);
+        EEForcesLinear flatHeightMap = flatHeightMapModel.computeContactForces(state);
+        EEForcesLinear heightMap = heightMapModel.computeContactForces(state);
+        EEForcesLinear mesh = meshModel.computeContactForces(state);
+        EEForcesLinear cloned = clonedModel->computeContactForces(state);
+
+        for (size_t i = 0; i < flat.size(); i++)
+        {
+            ASSERT_LT((flat[i] - flatHeightMap[i]).norm(), 1e-9);
+            ASSERT_LT((heightMap[i] - mesh[i]).norm(), 1e-6);
+            ASSERT_LT((mesh[i] - cloned[i]).norm(), 1e-9);
+        }
+    }
+}
+
 
 int main(int argc, char** argv)
 {
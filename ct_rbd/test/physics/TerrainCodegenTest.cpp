@@ -0,0 +1,203 @@
+/**********************************************************************************************************************
+This file is part of the Control Toolbox (https://github.com/ethz-adrl/control-toolbox), copyright by ETH Zurich.
+Licensed under the BSD-2 license (see LICENSE file in main directory)
+**********************************************************************************************************************/
+
+#include <ct/rbd/rbd.h>
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <ct/rbd/physics/terrain/HeightMapTerrain.h>
+#include <ct/rbd/physics/terrain/MeshTerrain.h>
+
+using namespace ct::core;
+using namespace ct::rbd;
+
+//! the terrain height and normal as function of the horizontal position
+typedef DerivativesCppadJIT<2, 4> TerrainDerivatives;
+
+template <typename SCALAR>
+Eigen::Matrix<SCALAR, 4, 1> evaluateTerrain(const Terrain<SCALAR>& terrain, const Eigen::Matrix<SCALAR, 2, 1>& xy)
+{
+    SCALAR height;
+    typename Terrain<SCALAR>::Vector3s normal;
+    terrain.evaluate(xy(0), xy(1), height, normal);
+
+    Eigen::Matrix<SCALAR, 4, 1> result;
+    result << height, normal;
+    return result;
+}
+
+/*!
+ * Compiles the terrain, taped at a single point, and compares it to the double terrain at points in all cells, on
+ * cell borders and outside the grid. The height gradient has to match the slope given by the normal.
+ */
+void compareCompiledTerrain(const Terrain<ADCGScalar>& terrainCG,
+    const Terrain<double>& terrain,
+    const Eigen::Vector2d& min,
+    const Eigen::Vector2d& max,
+    const double resolution,
+    const std::string& libName)
+{
+    typename TerrainDerivatives::FUN_TYPE_CG f = [&terrainCG](const Eigen::Matrix<ADCGScalar, 2, 1>& xy) {
+        return evaluateTerrain<ADCGScalar>(terrainCG, xy);
+    };
+    TerrainDerivatives derivatives(f);
+
+    DerivativesCppadSettings settings;
+    settings.createForwardZero_ = true;
+    settings.createJacobian_ = true;
+    derivatives.compileJIT(settings, libName);
+
+    size_t nTerrain = 0;
+    for (double x = min(0) - 1.0; x <= max(0) + 1.0; x += 0.5 * resolution)
+    {
+        for (double y = min(1) - 1.0; y <= max(1) + 1.0; y += 0.5 * resolution)
+        {
+            // alternate between points on cell borders and points within cells
+            const Eigen::Vector2d xy(x + 0.1 * resolution * std::sin(7.0 * x), y);
+
+            double height;
+            Eigen::Vector3d normal;
+            const bool hasTerrain = terrain.evaluate(xy(0), xy(1), height, normal);
+
+            const Eigen::Vector4d compiled = derivatives.forwardZero(xy);
+            const Eigen::Matrix<double, 4, 2> jacobian = derivatives.jacobian(xy);
+
+            if (!hasTerrain)
+            {
+                ASSERT_LT(compiled(0), -999.0);
+                ASSERT_LT(jacobian.row(0).norm(), 1e-12);
+                continue;
+            }
+            nTerrain++;
+
+            ASSERT_NEAR(compiled(0), height, 1e-10);
+            ASSERT_LT((compiled.tail<3>() - normal).norm(), 1e-10);
+            ASSERT_NEAR(jacobian(0, 0), -normal(0) / normal(2), 1e-10);
+            ASSERT_NEAR(jacobian(0, 1), -normal(1) / normal(2), 1e-10);
+        }
+    }
+    ASSERT_GT(nTerrain, 0u);
+}
+
+/*!
+ * Tapes the terrain with Auto-Diff at a single point and returns the number of variables in the tape. The tape is
+ * compared to the double terrain at a point in a different cell.
+ */
+size_t tapeTerrain(const Terrain<ADScalar>& terrain, const Terrain<double>& terrainDouble, const Eigen::Vector2d& xy)
+{
+    std::vector<ADScalar> ax(2, ADScalar(0.0));
+    CppAD::Independent(ax);
+
+    ADScalar height;
+    typename Terrain<ADScalar>::Vector3s normal;
+    terrain.evaluate(ax[0], ax[1], height, normal);
+    std::vector<ADScalar> ay = {height, normal(0), normal(1), normal(2)};
+    CppAD::ADFun<double> f(ax, ay);
+
+    double heightDouble;
+    Eigen::Vector3d normalDouble;
+    terrainDouble.evaluate(xy(0), xy(1), heightDouble, normalDouble);
+
+    const std::vector<double> y = f.Forward(0, std::vector<double>{xy(0), xy(1)});
+    EXPECT_NEAR(y[0], heightDouble, 1e-10);
+    EXPECT_LT((Eigen::Vector3d(y[1], y[2], y[3]) - normalDouble).norm(), 1e-10);
+
+    return f.size_var();
+}
+
+//! a bumpy grid of n x n vertices, triangulated
+void gridMesh(const int n,
+    Eigen::Matrix<double, Eigen::Dynamic, 3>& vertices,
+    Eigen::Matrix<int, Eigen::Dynamic, 3>& triangles)
+{
+    vertices.resize(n * n, 3);
+    triangles.resize(2 * (n - 1) * (n - 1), 3);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            vertices.row(n * i + j) << i, j, 0.3 * std::sin(i + 2.0 * j);
+
+    int t = 0;
+    for (int i = 0; i < n - 1; i++)
+    {
+        for (int j = 0; j < n - 1; j++)
+        {
+            const int v = n * i + j;
+            triangles.row(t++) << v, v + n, v + 1;
+            triangles.row(t++) << v + n, v + n + 1, v + 1;
+        }
+    }
+}
+
+TEST(TerrainCodegenTest, TapeSizeIndependentOfTerrainSize)
+{
+    const Eigen::MatrixXd smallMap = Eigen::MatrixXd::Random(3, 3);
+    const Eigen::MatrixXd largeMap = Eigen::MatrixXd::Random(300, 300);
+    const Eigen::Vector2d xy(0.7, 0.3);
+
+    const size_t smallMapTape =
+        tapeTerrain(HeightMapTerrain<ADScalar>(smallMap, 0.5), HeightMapTerrain<double>(smallMap, 0.5), xy);
+    const size_t largeMapTape =
+        tapeTerrain(HeightMapTerrain<ADScalar>(largeMap, 0.5), HeightMapTerrain<double>(largeMap, 0.5), xy);
+    ASSERT_EQ(smallMapTape, largeMapTape);
+
+    Eigen::Matrix<double, Eigen::Dynamic, 3> vertices;
+    Eigen::Matrix<int, Eigen::Dynamic, 3> triangles;
+    gridMesh(3, vertices, triangles);
+    const size_t smallMeshTape =
+        tapeTerrain(MeshTerrain<ADScalar>(vertices, triangles, 0.7), MeshTerrain<double>(vertices, triangles, 0.7), xy);
+    gridMesh(100, vertices, triangles);
+    const size_t largeMeshTape =
+        tapeTerrain(MeshTerrain<ADScalar>(vertices, triangles, 0.7), MeshTerrain<double>(vertices, triangles, 0.7), xy);
+    ASSERT_EQ(smallMeshTape, largeMeshTape);
+}
+
+TEST(TerrainCodegenTest, HeightMapTerrain)
+{
+    const double resolution = 0.5;
+    const Eigen::MatrixXd heights = Eigen::MatrixXd::Random(7, 6);
+
+    HeightMapTerrain<double> terrain(heights, resolution, -1.0, -1.0);
+    HeightMapTerrain<ADCGScalar> terrainCG(heights, resolution, -1.0, -1.0);
+
+    compareCompiledTerrain(terrainCG, terrain, Eigen::Vector2d(-1.0, -1.0), Eigen::Vector2d(2.0, 1.5), resolution,
+        "HeightMapTerrainCodegenTest");
+}
+
+TEST(TerrainCodegenTest, MeshTerrain)
+{
+    // a bumpy 4x4 grid of vertices, triangulated, and an overlapping elevated triangle
+    Eigen::Matrix<double, Eigen::Dynamic, 3> vertices(17, 3);
+    Eigen::Matrix<int, Eigen::Dynamic, 3> triangles(19, 3);
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            vertices.row(4 * i + j) << i, j, 0.3 * std::sin(i + 2.0 * j);
+    vertices.row(16) << 1.5, 1.5, 2.0;
+
+    int t = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            const int v = 4 * i + j;
+            triangles.row(t++) << v, v + 4, v + 1;
+            triangles.row(t++) << v + 4, v + 5, v + 1;
+        }
+    }
+    triangles.row(t++) << 0, 16, 15;
+
+    MeshTerrain<double> terrain(vertices, triangles, 0.7);
+    MeshTerrain<ADCGScalar> terrainCG(vertices, triangles, 0.7);
+
+    compareCompiledTerrain(
+        terrainCG, terrain, Eigen::Vector2d(0.0, 0.0), Eigen::Vector2d(3.0, 3.0), 0.5, "MeshTerrainCodegenTest");
+}
+
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
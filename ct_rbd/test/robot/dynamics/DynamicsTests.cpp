@@ -60,6 +60,53 @@ TEST(DynamicsTestHyQ, forward_dynamics_test)
     testdynamics.ProjectedInverseDynamics(ee_contact, hyq_state, hyq_xd, torque_u);
 }
 
+TEST(DynamicsTestHyQ, projected_dynamics_methods_test)
+{
+    typedef TestHyQ::Dynamics Dyn;
+    typedef ProjectedDynamics<TestHyQ::Dynamics::ROBCOGEN, TestHyQ::Dynamics::N_EE> ProjectedDyn;
+
+    using control_vector_t = typename Dyn::control_vector_t;
+    using RBDState_t = typename Dyn::RBDState_t;
+    using RBDAcceleration_t = typename Dyn::RBDAcceleration_t;
+    using EE_in_contact_t = typename Dyn::EE_in_contact_t;
+
+    std::shared_ptr<TestHyQ::Kinematics> kyn(new TestHyQ::Kinematics);
+    ProjectedDyn kkt(kyn), rangeSpace(kyn);
+    kkt.setForwardDynamicsMethod(ProjectedDyn::KKT);
+    rangeSpace.setForwardDynamicsMethod(ProjectedDyn::RANGE_SPACE);
+
+    RBDState_t x;
+    control_vector_t u, u_id;
+    RBDAcceleration_t qdd_kkt, qdd_rs;
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        x.setRandom();
+        u.setRandom();
+
+        // with up to two feet in contact the projected inverse dynamics can recover the control
+        EE_in_contact_t ee_contact = false;
+        ee_contact[i % 4] = true;
+        ee_contact[(i + 1) % 4] = (i % 2 == 0);
+
+        kkt.setContactConfiguration(ee_contact);
+        rangeSpace.setContactConfiguration(ee_contact);
+
+        kkt.ProjectedForwardDynamics(x, u, qdd_kkt);
+        rangeSpace.ProjectedForwardDynamics(x, u, qdd_rs);
+        ASSERT_TRUE(qdd_kkt.toCoordinateAcceleration().isApprox(qdd_rs.toCoordinateAcceleration(), 1e-6));
+
+        // second call at the same joint positions reuses the cached factorization
+        x.joints().getVelocities().setRandom();
+        kkt.ProjectedForwardDynamics(x, u, qdd_kkt);
+        rangeSpace.ProjectedForwardDynamics(x, u, qdd_rs);
+        ASSERT_TRUE(qdd_kkt.toCoordinateAcceleration().isApprox(qdd_rs.toCoordinateAcceleration(), 1e-6));
+
+        rangeSpace.ProjectedInverseDynamics(x, qdd_rs, u_id);
+        ASSERT_TRUE(u_id.isApprox(u, 1e-6));
+    }
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -336,6 +336,41 @@ TEST(EEKinematicsTest, torqueMappingTest)
 }
 
 
+// Test that the batched kinematics cache matches the per end-effector evaluation
+TEST(EEKinematicsTest, cachedKinematicsTest)
+{
+    RBDStateHyQ state;
+    TestHyQ::Kinematics kinematics;
+
+    for (size_t test = 0; test < 10; test++)
+    {
+        state.setRandom();
+        kinematics.updateKinematics(state);
+
+        // only change the velocities, the cached transforms are reused
+        if (test % 2 == 1)
+        {
+            state.jointVelocities().setRandom();
+            state.base().velocities().getRotationalVelocity().toImplementation().setRandom();
+            kinematics.updateKinematics(state);
+        }
+
+        for (size_t i = 0; i < nFeet; i++)
+        {
+            ASSERT_TRUE(kinematics.getCachedEEPositionInBase(i).toImplementation().isApprox(
+                kinematics.getEEPositionInBase(i, state.jointPositions()).toImplementation()));
+            ASSERT_TRUE(kinematics.getCachedEEPositionInWorld(i).toImplementation().isApprox(
+                kinematics.getEEPositionInWorld(i, state.basePose(), state.jointPositions()).toImplementation()));
+            ASSERT_TRUE(
+                kinematics.getCachedEERotInBase(i).isApprox(kinematics.getEERotInBase(i, state.jointPositions())));
+            ASSERT_TRUE(kinematics.getCachedEEVelocityInBase(i).toImplementation().isApprox(
+                kinematics.getEEVelocityInBase(i, state).toImplementation()));
+            ASSERT_TRUE(kinematics.getCachedEEVelocityInWorld(i).toImplementation().isApprox(
+                kinematics.getEEVelocityInWorld(i, state).toImplementation()));
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -18,6 +18,7 @@ Licensed under the BSD-2 license (see LICENSE file in main directory)
 #include <gtest/gtest.h>
 
 #include <ct/rbd/systems/linear/RbdLinearizer.h>
+#include <ct/rbd/systems/linear/RbdInverseDynamicsLinearizer.h>
 #include "ct/rbd/systems/FixBaseFDSystem.h"
 #include "ct/rbd/systems/FloatingBaseFDSystem.h"
 
@@ -112,6 +113,81 @@ TEST(RBDLinearizerTest, NumDiffComparisonFloatingBase)
     }
 }
 
+TEST(RBDLinearizerTest, InverseDynamicsComparisonFixedBase)
+{
+    typedef FixBaseFDSystem<TestIrb4600::Dynamics> IrbSystem;
+
+    const size_t STATE_DIM = IrbSystem::STATE_DIM;
+    const size_t CONTROL_DIM = IrbSystem::CONTROL_DIM;
+
+    std::shared_ptr<IrbSystem> irbSystem(new IrbSystem);
+    std::shared_ptr<IrbSystem> irbSystem2(new IrbSystem);
+
+    RbdInverseDynamicsLinearizer<IrbSystem> idLinearizer(irbSystem);
+    core::SystemLinearizer<STATE_DIM, CONTROL_DIM> systemLinearizer(irbSystem2, true);
+
+    core::StateVector<STATE_DIM> x;
+    core::ControlVector<CONTROL_DIM> u;
+
+    size_t nTests = 500;
+    for (size_t i = 0; i < nTests; i++)
+    {
+        x.setRandom();
+        u.setRandom();
+
+        auto A_id = idLinearizer.getDerivativeState(x, u, 0.0);
+        auto B_id = idLinearizer.getDerivativeControl(x, u, 0.0);
+
+        auto A_system = systemLinearizer.getDerivativeState(x, u, 0.0);
+        auto B_system = systemLinearizer.getDerivativeControl(x, u, 0.0);
+
+        ASSERT_LT((A_id - A_system).array().abs().maxCoeff(), 1e-5);
+
+        ASSERT_LT((B_id - B_system).array().abs().maxCoeff(), 1e-4);
+
+        // at other joint positions, the control derivative must not be reused from the state derivative
+        x.setRandom();
+        B_id = idLinearizer.getDerivativeControl(x, u, 0.0);
+        B_system = systemLinearizer.getDerivativeControl(x, u, 0.0);
+
+        ASSERT_LT((B_id - B_system).array().abs().maxCoeff(), 1e-4);
+    }
+}
+
+TEST(RBDLinearizerTest, InverseDynamicsComparisonFloatingBase)
+{
+    typedef FloatingBaseFDSystem<TestHyQ::Dynamics, false, false> HyQSystem;
+
+    const size_t STATE_DIM = HyQSystem::STATE_DIM;
+    const size_t CONTROL_DIM = HyQSystem::CONTROL_DIM;
+
+    std::shared_ptr<HyQSystem> hyqSystem(new HyQSystem);
+    std::shared_ptr<HyQSystem> hyqSystem2(new HyQSystem);
+
+    RbdInverseDynamicsLinearizer<HyQSystem> idLinearizer(hyqSystem);
+    RbdLinearizer<HyQSystem> rbdLinearizer(hyqSystem2, true);
+
+    core::StateVector<STATE_DIM> x;
+    core::ControlVector<CONTROL_DIM> u;
+
+    size_t nTests = 500;
+    for (size_t i = 0; i < nTests; i++)
+    {
+        x.setRandom();
+        u.setRandom();
+
+        auto A_id = idLinearizer.getDerivativeState(x, u, 0.0);
+        auto B_id = idLinearizer.getDerivativeControl(x, u, 0.0);
+
+        auto A_rbd = rbdLinearizer.getDerivativeState(x, u, 0.0);
+        auto B_rbd = rbdLinearizer.getDerivativeControl(x, u, 0.0);
+
+        ASSERT_LT((A_id - A_rbd).array().abs().maxCoeff(), 1e-5);
+
+        ASSERT_LT((B_id - B_rbd).array().abs().maxCoeff(), 1e-4);
+    }
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);